@@ -22,9 +22,12 @@ public class MultiplayerSessions : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"Networking",
 				"OnlineSubsystemUtils",
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"Sockets",
+				"TraceLog"
 			}
 		);
 	}
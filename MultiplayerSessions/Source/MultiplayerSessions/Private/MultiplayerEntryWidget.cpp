@@ -14,9 +14,12 @@
 #include "GameFramework/PlayerState.h"
 #include "Interfaces/OnlineIdentityInterface.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/StringBuilder.h"
 #include "MultiplayerSessionListItem.h"
 #include "MultiplayerSessionProfileProvider.h"
+#include "MultiplayerSessionsStats.h"
 #include "MultiplayerSessionsSubsystem.h"
+#include "MultiplayerSessionsTrace.h"
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemUtils.h"
 
@@ -98,17 +101,36 @@ bool UMultiplayerEntryWidget::Initialize()
 	SessionsListView->SetSelectionMode(ESelectionMode::Single);
 	SessionsListView->OnItemSelectionChanged().AddUObject(this, &ThisClass::HandleSessionListSelectionChanged);
 	SessionsHeaderContainer->SetVisibility(ESlateVisibility::Visible);
+	OnNativeVisibilityChanged.AddUObject(this, &ThisClass::HandleNativeVisibilityChanged);
 	return true;
 }
 
+void UMultiplayerEntryWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+	HandleNativeVisibilityChanged(GetVisibility());
+}
+
 void UMultiplayerEntryWidget::NativeDestruct()
 {
 	SessionsListView->OnItemSelectionChanged().RemoveAll(this);
+	if (MultiplayerSessionsSubsystem != nullptr)
+	{
+		MultiplayerSessionsSubsystem->SetAutoRefreshPausedForLocalPlayer(GetOwningLocalPlayer(), true);
+	}
 	UnbindSubsystemDelegates();
 	ClearSessionListItems();
 	Super::NativeDestruct();
 }
 
+void UMultiplayerEntryWidget::HandleNativeVisibilityChanged(ESlateVisibility InVisibility)
+{
+	if (MultiplayerSessionsSubsystem != nullptr)
+	{
+		MultiplayerSessionsSubsystem->SetAutoRefreshPausedForLocalPlayer(GetOwningLocalPlayer(), InVisibility == ESlateVisibility::Collapsed || InVisibility == ESlateVisibility::Hidden);
+	}
+}
+
 void UMultiplayerEntryWidget::HandleHostButtonClicked()
 {
 	RequestCreateSession();
@@ -190,6 +212,10 @@ void UMultiplayerEntryWidget::HandleBackButtonClicked()
 void UMultiplayerEntryWidget::HandleLanModeCheckStateChanged(bool bIsChecked)
 {
 	bForceLanMode = bIsChecked;
+	if (MultiplayerSessionsSubsystem != nullptr)
+	{
+		MultiplayerSessionsSubsystem->StopAutoRefreshForLocalPlayer(GetOwningLocalPlayer());
+	}
 	UpdateConnectionModeText();
 	ClearSessionListItems();
 	SetStatusText(BuildCurrentModeStatusText());
@@ -197,6 +223,11 @@ void UMultiplayerEntryWidget::HandleLanModeCheckStateChanged(bool bIsChecked)
 
 void UMultiplayerEntryWidget::HandleCreateSessionCompleted(bool bWasSuccessful)
 {
+	if (IsEventForAnotherLocalPlayer() == true || (MultiplayerSessionsSubsystem != nullptr && MultiplayerSessionsSubsystem->GetPublishingSessionName() != NAME_GameSession))
+	{
+		return;
+	}
+
 	SetBusyState(false);
 	if (bWasSuccessful == false)
 	{
@@ -221,6 +252,11 @@ void UMultiplayerEntryWidget::HandleCreateSessionCompleted(bool bWasSuccessful)
 
 void UMultiplayerEntryWidget::HandleSessionSearchCompleted(bool bWasSuccessful, const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries)
 {
+	if (IsEventForAnotherLocalPlayer() == true || (MultiplayerSessionsSubsystem != nullptr && MultiplayerSessionsSubsystem->IsPublishingBackgroundRefresh() == true))
+	{
+		return;
+	}
+
 	SetBusyState(false);
 	if (bWasSuccessful == false)
 	{
@@ -244,8 +280,53 @@ void UMultiplayerEntryWidget::HandleSessionSearchCompleted(bool bWasSuccessful,
 	SetStatusText(FString::Printf(TEXT("Found %d session(s)."), BrowserEntries.Num()));
 }
 
+void UMultiplayerEntryWidget::HandleBrowserEntriesUpdated(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries)
+{
+	if (bIsBusy == true || IsEventForAnotherLocalPlayer() == true)
+	{
+		return;
+	}
+
+	FString SelectedEntryId;
+	const FMultiplayerSessionBrowserEntry* SelectedBrowserEntry = GetSelectedBrowserEntry();
+	if (SelectedBrowserEntry != nullptr)
+	{
+		SelectedEntryId = SelectedBrowserEntry->EntryId;
+	}
+
+	BuildSessionListItems(BrowserEntries);
+	if (SelectedEntryId.IsEmpty() == true)
+	{
+		return;
+	}
+
+	for (UMultiplayerSessionListItem* ListItem : SessionListItems)
+	{
+		if (ListItem != nullptr && ListItem->GetBrowserEntry().EntryId == SelectedEntryId)
+		{
+			SessionsListView->SetSelectedItem(ListItem);
+			break;
+		}
+	}
+}
+
+void UMultiplayerEntryWidget::HandleBrowserEntriesChanged(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, const FMultiplayerSessionBrowserChangeSet& ChangeSet)
+{
+	if (bIsBusy == true || IsEventForAnotherLocalPlayer() == true || MultiplayerSessionsSubsystem == nullptr || MultiplayerSessionsSubsystem->IsPublishingBackgroundRefresh() == false)
+	{
+		return;
+	}
+
+	ApplyBrowserChangeSet(BrowserEntries, ChangeSet);
+}
+
 void UMultiplayerEntryWidget::HandleJoinSessionRequestCompleted(EMultiplayerJoinSessionResult Result)
 {
+	if (IsEventForAnotherLocalPlayer() == true || (MultiplayerSessionsSubsystem != nullptr && MultiplayerSessionsSubsystem->GetPublishingSessionName() != NAME_GameSession))
+	{
+		return;
+	}
+
 	SetBusyState(false);
 
 	switch (Result)
@@ -298,6 +379,11 @@ void UMultiplayerEntryWidget::HandleJoinSessionRequestCompleted(EMultiplayerJoin
 
 void UMultiplayerEntryWidget::HandleTravelRequestCompleted(bool bWasSuccessful)
 {
+	if (IsEventForAnotherLocalPlayer() == true)
+	{
+		return;
+	}
+
 	SetBusyState(false);
 	if (bWasSuccessful == true)
 	{
@@ -315,6 +401,11 @@ void UMultiplayerEntryWidget::HandleTravelRequestCompleted(bool bWasSuccessful)
 
 void UMultiplayerEntryWidget::HandleSessionFailure(EMultiplayerSessionFailureReason FailureReason)
 {
+	if (IsEventForAnotherLocalPlayer() == true)
+	{
+		return;
+	}
+
 	SetBusyState(false);
 	SetStatusText(BuildFailureMessage(FailureReason));
 }
@@ -329,6 +420,8 @@ void UMultiplayerEntryWidget::BindSubsystemDelegates()
 
 	MultiplayerSessionsSubsystem->OnCreateSessionRequestComplete.AddDynamic(this, &ThisClass::HandleCreateSessionCompleted);
 	MultiplayerSessionsSubsystem->OnSessionSearchCompleted.AddDynamic(this, &ThisClass::HandleSessionSearchCompleted);
+	MultiplayerSessionsSubsystem->OnBrowserEntriesUpdated.AddDynamic(this, &ThisClass::HandleBrowserEntriesUpdated);
+	MultiplayerSessionsSubsystem->OnBrowserEntriesChanged.AddDynamic(this, &ThisClass::HandleBrowserEntriesChanged);
 	MultiplayerSessionsSubsystem->OnJoinSessionRequestCompleted.AddDynamic(this, &ThisClass::HandleJoinSessionRequestCompleted);
 	MultiplayerSessionsSubsystem->OnTravelRequestCompleted.AddDynamic(this, &ThisClass::HandleTravelRequestCompleted);
 	MultiplayerSessionsSubsystem->OnSessionFailure.AddDynamic(this, &ThisClass::HandleSessionFailure);
@@ -343,6 +436,8 @@ void UMultiplayerEntryWidget::UnbindSubsystemDelegates()
 
 	MultiplayerSessionsSubsystem->OnCreateSessionRequestComplete.RemoveAll(this);
 	MultiplayerSessionsSubsystem->OnSessionSearchCompleted.RemoveAll(this);
+	MultiplayerSessionsSubsystem->OnBrowserEntriesUpdated.RemoveAll(this);
+	MultiplayerSessionsSubsystem->OnBrowserEntriesChanged.RemoveAll(this);
 	MultiplayerSessionsSubsystem->OnJoinSessionRequestCompleted.RemoveAll(this);
 	MultiplayerSessionsSubsystem->OnTravelRequestCompleted.RemoveAll(this);
 	MultiplayerSessionsSubsystem->OnSessionFailure.RemoveAll(this);
@@ -419,7 +514,7 @@ void UMultiplayerEntryWidget::RequestFindSessions()
 	}
 
 	FMultiplayerSessionSearchRequest SearchRequest;
-	SearchRequest.MaxSearchResults = 200;
+	SearchRequest.MaxSearchResults = MultiplayerSessionsSubsystem->GetDefaultMaxSearchResults();
 	SearchRequest.DesiredMatchType = MatchType;
 	SearchRequest.DesiredBuildId = SessionBuildId;
 	SearchRequest.DesiredSessionSchemaVersion = 1;
@@ -429,10 +524,17 @@ void UMultiplayerEntryWidget::RequestFindSessions()
 	ClearSessionListItems();
 	SetStatusText(TEXT("Searching sessions..."));
 	MultiplayerSessionsSubsystem->FindSessionsForLocalPlayer(GetOwningLocalPlayer(), SearchRequest);
+
+	if (bAutoRefreshSessions == true)
+	{
+		MultiplayerSessionsSubsystem->StartAutoRefresh(GetOwningLocalPlayer(), SearchRequest);
+	}
 }
 
 void UMultiplayerEntryWidget::BuildSessionListItems(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries)
 {
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_BuildSessionListItems);
+	SCOPE_CYCLE_COUNTER(STAT_MultiplayerSessions_ListRebuild);
 	SessionsListView->ClearSelection();
 	SessionsListView->ClearListItems();
 	SessionListItems.Reset();
@@ -455,6 +557,93 @@ void UMultiplayerEntryWidget::BuildSessionListItems(const TArray<FMultiplayerSes
 	SetBusyState(false);
 }
 
+void UMultiplayerEntryWidget::ApplyBrowserChangeSet(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, const FMultiplayerSessionBrowserChangeSet& ChangeSet)
+{
+	if (ChangeSet.IsEmpty() == true)
+	{
+		return;
+	}
+
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_ApplyBrowserChangeSet);
+	const bool bStructureChanged = ChangeSet.AddedEntryIndices.Num() > 0 || ChangeSet.RemovedEntryIds.Num() > 0 || ChangeSet.bOrderChanged == true || SessionListItems.Num() != BrowserEntries.Num();
+	if (bStructureChanged == false)
+	{
+		for (const FMultiplayerSessionEntryUpdate& EntryUpdate : ChangeSet.UpdatedEntries)
+		{
+			if (SessionListItems.IsValidIndex(EntryUpdate.EntryIndex) == true && SessionListItems[EntryUpdate.EntryIndex] != nullptr)
+			{
+				SessionListItems[EntryUpdate.EntryIndex]->Initialize(BrowserEntries[EntryUpdate.EntryIndex]);
+			}
+		}
+
+		SessionsListView->RegenerateAllEntries();
+		UpdateJoinButtonState();
+		return;
+	}
+
+	UMultiplayerSessionListItem* SelectedListItem = Cast<UMultiplayerSessionListItem>(SessionsListView->GetSelectedItem());
+	TMap<FString, UMultiplayerSessionListItem*> ListItemsByEntryId;
+	ListItemsByEntryId.Reserve(SessionListItems.Num());
+	for (UMultiplayerSessionListItem* ListItem : SessionListItems)
+	{
+		if (ListItem != nullptr)
+		{
+			ListItemsByEntryId.Add(ListItem->GetBrowserEntry().EntryId, ListItem);
+		}
+	}
+
+	TBitArray<> UpdatedEntryMask(false, BrowserEntries.Num());
+	for (const FMultiplayerSessionEntryUpdate& EntryUpdate : ChangeSet.UpdatedEntries)
+	{
+		if (UpdatedEntryMask.IsValidIndex(EntryUpdate.EntryIndex) == true)
+		{
+			UpdatedEntryMask[EntryUpdate.EntryIndex] = true;
+		}
+	}
+
+	TArray<TObjectPtr<UMultiplayerSessionListItem>> NewListItems;
+	NewListItems.Reserve(BrowserEntries.Num());
+	for (int32 EntryIndex = 0; EntryIndex < BrowserEntries.Num(); EntryIndex++)
+	{
+		const FMultiplayerSessionBrowserEntry& BrowserEntry = BrowserEntries[EntryIndex];
+		UMultiplayerSessionListItem* ListItem = nullptr;
+		UMultiplayerSessionListItem* const* ExistingListItem = ListItemsByEntryId.Find(BrowserEntry.EntryId);
+		if (ExistingListItem != nullptr)
+		{
+			ListItem = *ExistingListItem;
+			if (UpdatedEntryMask[EntryIndex] == true)
+			{
+				ListItem->Initialize(BrowserEntry);
+			}
+		}
+		else
+		{
+			ListItem = NewObject<UMultiplayerSessionListItem>(this);
+			if (ListItem == nullptr)
+			{
+				continue;
+			}
+
+			ListItem->Initialize(BrowserEntry);
+		}
+
+		NewListItems.Add(ListItem);
+	}
+
+	SessionListItems = MoveTemp(NewListItems);
+	SessionsListView->SetListItems(SessionListItems);
+	if (ChangeSet.UpdatedEntries.Num() > 0)
+	{
+		SessionsListView->RegenerateAllEntries();
+	}
+
+	if (SelectedListItem != nullptr && SessionListItems.Contains(SelectedListItem) == true)
+	{
+		SessionsListView->SetSelectedItem(SelectedListItem);
+	}
+	UpdateJoinButtonState();
+}
+
 void UMultiplayerEntryWidget::ClearSessionListItems()
 {
 	SessionsListView->ClearSelection();
@@ -526,6 +715,11 @@ bool UMultiplayerEntryWidget::ShouldUseLanMode() const
 	return false;
 }
 
+bool UMultiplayerEntryWidget::IsEventForAnotherLocalPlayer() const
+{
+	return MultiplayerSessionsSubsystem != nullptr && MultiplayerSessionsSubsystem->IsPublishingForLocalPlayer(GetOwningLocalPlayer()) == false;
+}
+
 FString UMultiplayerEntryWidget::ResolveLocalNicknameForSession() const
 {
 	const APlayerController* OwningPlayerController = GetOwningPlayer();
@@ -613,19 +807,22 @@ FString UMultiplayerEntryWidget::BuildSessionDisplayName(const FString& InHostNi
 
 FString UMultiplayerEntryWidget::BuildSelectedSessionStatusText(const FMultiplayerSessionBrowserEntry& BrowserEntry) const
 {
-	FString PingText = TEXT("--");
+	TStringBuilder<256> SelectedText;
+	SelectedText << TEXT("Host: ") << BrowserEntry.HostDisplayName << TEXT(" | Status: ") << BrowserEntry.StatusText << TEXT(" | Free Slots: ") << FMath::Max(0, BrowserEntry.OpenPublicConnections) << TEXT(" | Ping: ");
 	if (BrowserEntry.PingInMs >= 0)
 	{
-		PingText = FString::Printf(TEXT("%d ms"), BrowserEntry.PingInMs);
+		SelectedText << BrowserEntry.PingInMs << TEXT(" ms");
+	}
+	else
+	{
+		SelectedText << TEXT("--");
 	}
 
-	FString SelectedText = FString::Printf(TEXT("Host: %s | Status: %s | Free Slots: %d | Ping: %s"), *BrowserEntry.HostDisplayName, *BrowserEntry.StatusText, FMath::Max(0, BrowserEntry.OpenPublicConnections), *PingText);
 	if (BrowserEntry.bCanJoin == false && BrowserEntry.JoinDisabledReasonText.IsEmpty() == false)
 	{
-		SelectedText.Append(TEXT(" | "));
-		SelectedText.Append(BrowserEntry.JoinDisabledReasonText);
+		SelectedText << TEXT(" | ") << BrowserEntry.JoinDisabledReasonText;
 	}
-	return SelectedText;
+	return FString(SelectedText.ToView());
 }
 
 FString UMultiplayerEntryWidget::BuildCurrentModeStatusText() const
@@ -714,6 +911,10 @@ FString UMultiplayerEntryWidget::BuildFailureMessage(EMultiplayerSessionFailureR
 		return TEXT("The platform invitation interface is unavailable.");
 	case EMultiplayerSessionFailureReason::FriendSessionNotFound:
 		return TEXT("The friend is not currently in a joinable session.");
+	case EMultiplayerSessionFailureReason::NoMatchFound:
+		return TEXT("No suitable session was found.");
+	case EMultiplayerSessionFailureReason::SessionNameMismatch:
+		return TEXT("The selected session cannot be joined into that session slot.");
 	default:
 		return TEXT("Unknown session failure.");
 	}
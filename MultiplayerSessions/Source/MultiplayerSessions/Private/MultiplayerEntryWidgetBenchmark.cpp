@@ -0,0 +1,208 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerEntryWidget.h"
+
+#include "Components/ListView.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "MultiplayerSessionListItem.h"
+#include "MultiplayerSessionsBenchmark.h"
+#include "MultiplayerSessionsSyntheticResults.h"
+#include "UObject/UObjectIterator.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	using namespace MultiplayerSessionsBenchmark;
+
+	constexpr int32 MaxScrollSteps = 64;
+
+	UMultiplayerEntryWidget* FindEntryWidget(UWorld* World)
+	{
+		UMultiplayerEntryWidget* FallbackWidget = nullptr;
+		for (TObjectIterator<UMultiplayerEntryWidget> It; It; ++It)
+		{
+			UMultiplayerEntryWidget* EntryWidget = *It;
+			if (EntryWidget == nullptr || EntryWidget->IsTemplate() == true || (World != nullptr && EntryWidget->GetWorld() != World))
+			{
+				continue;
+			}
+
+			if (EntryWidget->IsInViewport() == true)
+			{
+				return EntryWidget;
+			}
+
+			if (FallbackWidget == nullptr)
+			{
+				FallbackWidget = EntryWidget;
+			}
+		}
+
+		return FallbackWidget;
+	}
+
+	void TickListWidget(UListView* ListView)
+	{
+		const TSharedRef<SWidget> ListWidget = ListView->TakeWidget();
+		const FGeometry& Geometry = ListView->GetCachedGeometry();
+		ListWidget->SlatePrepass(Geometry.Scale);
+		ListWidget->Tick(Geometry, FPlatformTime::Seconds(), 0.0f);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchWidgetCommand(
+		TEXT("ms.Bench.Widget"),
+		TEXT("Fills the session browser with synthetic entries and measures list rebuild, layout, and scrolling. Usage: ms.Bench.Widget [EntryCount]. Without a count it runs 100, 1000 and 10000."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UMultiplayerEntryWidget* EntryWidget = FindEntryWidget(World);
+			if (EntryWidget == nullptr)
+			{
+				Ar.Log(TEXT("No multiplayer entry widget is constructed."));
+				return;
+			}
+
+			TArray<int32> EntryCounts;
+			if (Args.Num() > 0)
+			{
+				EntryCounts.Add(FMath::Max(1, FCString::Atoi(*Args[0])));
+			}
+			else
+			{
+				EntryCounts = { 100, 1000, 10000 };
+			}
+
+			for (const int32 EntryCount : EntryCounts)
+			{
+				if (EntryWidget->RunRenderBenchmark(EntryCount, Ar) == false)
+				{
+					return;
+				}
+			}
+		}));
+}
+
+bool UMultiplayerEntryWidget::RunRenderBenchmark(int32 EntryCount, FOutputDevice& Ar)
+{
+	if (bIsBusy == true)
+	{
+		Ar.Log(TEXT("Widget benchmark skipped: the menu is busy."));
+		return false;
+	}
+
+	if (SessionsListView == nullptr || SessionsListView->GetCachedGeometry().GetLocalSize().IsNearlyZero() == true)
+	{
+		Ar.Log(TEXT("Widget benchmark skipped: the session list has not been laid out. Add the widget to the viewport first."));
+		return false;
+	}
+
+	MultiplayerSessionsSynthetic::FSyntheticResultOptions SyntheticOptions;
+	SyntheticOptions.MatchType = MatchType;
+	SyntheticOptions.Seed = EntryCount;
+
+	TArray<FMultiplayerSessionBrowserEntry> BrowserEntries;
+	MultiplayerSessionsSynthetic::MakeBrowserEntries(EntryCount, SyntheticOptions, BrowserEntries);
+
+	TArray<FMultiplayerSessionBrowserEntry> PreviousBrowserEntries;
+	PreviousBrowserEntries.Reserve(SessionListItems.Num());
+	for (const UMultiplayerSessionListItem* ListItem : SessionListItems)
+	{
+		if (ListItem != nullptr)
+		{
+			PreviousBrowserEntries.Add(ListItem->GetBrowserEntry());
+		}
+	}
+
+	int32 GeneratedCount = 0;
+	int32 ReleasedCount = 0;
+	const FDelegateHandle GeneratedHandle = SessionsListView->OnEntryWidgetGenerated().AddLambda([&GeneratedCount](UUserWidget&)
+	{
+		GeneratedCount++;
+	});
+	const FDelegateHandle ReleasedHandle = SessionsListView->OnEntryWidgetReleased().AddLambda([&ReleasedCount](UUserWidget&)
+	{
+		ReleasedCount++;
+	});
+
+	FBenchmarkCountingMalloc* const CountingMalloc = GetBenchmarkCountingMalloc();
+	const auto BeginCounting = [CountingMalloc]()
+	{
+		if (CountingMalloc != nullptr)
+		{
+			CountingMalloc->BeginCounting();
+		}
+	};
+	const auto EndCounting = [CountingMalloc](int64& OutAllocations, int64& OutBytes)
+	{
+		OutAllocations = -1;
+		OutBytes = -1;
+		if (CountingMalloc != nullptr)
+		{
+			CountingMalloc->EndCounting();
+			OutAllocations = CountingMalloc->GetAllocationCount();
+			OutBytes = CountingMalloc->GetAllocatedBytes();
+		}
+	};
+
+	int64 RebuildAllocations = 0;
+	int64 RebuildBytes = 0;
+	BeginCounting();
+	double StartSeconds = FPlatformTime::Seconds();
+	BuildSessionListItems(BrowserEntries);
+	const double RebuildMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	EndCounting(RebuildAllocations, RebuildBytes);
+
+	int64 LayoutAllocations = 0;
+	int64 LayoutBytes = 0;
+	BeginCounting();
+	StartSeconds = FPlatformTime::Seconds();
+	SessionsListView->SetScrollOffset(0.0f);
+	TickListWidget(SessionsListView);
+	const double LayoutMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	EndCounting(LayoutAllocations, LayoutBytes);
+	const int32 VisibleRows = FMath::Max(1, SessionsListView->GetDisplayedEntryWidgets().Num());
+	const int32 LayoutGeneratedCount = GeneratedCount;
+
+	const int32 ScrollSteps = FMath::Min(MaxScrollSteps, FMath::Max(0, EntryCount - VisibleRows) / VisibleRows);
+	GeneratedCount = 0;
+	ReleasedCount = 0;
+	int64 ScrollAllocations = 0;
+	int64 ScrollBytes = 0;
+	BeginCounting();
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Step = 1; Step <= ScrollSteps; Step++)
+	{
+		SessionsListView->SetScrollOffset(static_cast<float>(Step * VisibleRows));
+		TickListWidget(SessionsListView);
+	}
+	const double ScrollMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	EndCounting(ScrollAllocations, ScrollBytes);
+
+	SessionsListView->OnEntryWidgetGenerated().Remove(GeneratedHandle);
+	SessionsListView->OnEntryWidgetReleased().Remove(ReleasedHandle);
+
+	Ar.Logf(TEXT("Widget benchmark: %d entries, %d visible rows."), EntryCount, VisibleRows);
+	Ar.Logf(TEXT("  Rebuild   %10.3f ms %10lld allocs %12lld bytes %8.2f allocs/entry"), RebuildMilliseconds, RebuildAllocations, RebuildBytes, static_cast<double>(RebuildAllocations) / FMath::Max(1, EntryCount));
+	Ar.Logf(TEXT("  Layout    %10.3f ms %10lld allocs %8d generated %8.2f allocs/visible row"), LayoutMilliseconds, LayoutAllocations, LayoutGeneratedCount, static_cast<double>(LayoutAllocations) / VisibleRows);
+	if (ScrollSteps > 0)
+	{
+		Ar.Logf(TEXT("  Scroll    %10.3f ms/page %6d pages %8.2f generated/page %8.2f released/page %8.2f allocs/visible row"), ScrollMilliseconds / ScrollSteps, ScrollSteps, static_cast<double>(GeneratedCount) / ScrollSteps, static_cast<double>(ReleasedCount) / ScrollSteps, static_cast<double>(ScrollAllocations) / (static_cast<double>(ScrollSteps) * VisibleRows));
+	}
+	else
+	{
+		Ar.Log(TEXT("  Scroll    skipped: every entry fits on one page."));
+	}
+
+	if (CountingMalloc == nullptr)
+	{
+		Ar.Logf(TEXT("  Allocation counts read -1. Start with -%s to count them."), CountAllocationsParam);
+	}
+
+	BuildSessionListItems(PreviousBrowserEntries);
+	SessionsListView->SetScrollOffset(0.0f);
+	return true;
+}
+
+#endif
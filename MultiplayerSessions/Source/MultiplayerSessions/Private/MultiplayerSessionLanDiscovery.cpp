@@ -0,0 +1,711 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionLanDiscovery.h"
+
+#include "MultiplayerSessionPing.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Common/UdpSocketReceiver.h"
+#include "Misc/Guid.h"
+#include "IPAddress.h"
+#include "OnlineSubsystemTypes.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+namespace
+{
+	constexpr uint8 BeaconFlagAllowJoinInProgress = 1 << 0;
+	constexpr uint8 BeaconFlagDedicated = 1 << 1;
+	constexpr int32 MaxStringBytes = 1024;
+	constexpr int32 SearchReceiveBufferBytes = 512 * 1024;
+	constexpr int32 MaxTrackedSenders = 1024;
+	constexpr double MinReplyIntervalSeconds = 0.05;
+	constexpr uint32 AssumedSubnetMask = 0xffffff00;
+
+	class FBeaconWriter
+	{
+	public:
+		explicit FBeaconWriter(TArray<uint8>& InBuffer)
+			: Buffer(InBuffer)
+		{
+		}
+
+		void WriteUInt8(uint8 Value)
+		{
+			Buffer.Add(Value);
+		}
+
+		void WriteUInt16(uint16 Value)
+		{
+			WriteLittleEndian(Value, 2);
+		}
+
+		void WriteUInt32(uint32 Value)
+		{
+			WriteLittleEndian(Value, 4);
+		}
+
+		void WriteUInt64(uint64 Value)
+		{
+			WriteLittleEndian(Value, 8);
+		}
+
+		void WriteString(const FString& Value)
+		{
+			const FTCHARToUTF8 Utf8Value(*Value);
+			const int32 Length = FMath::Min(Utf8Value.Length(), MaxStringBytes);
+			WriteUInt16(static_cast<uint16>(Length));
+			Buffer.Append(reinterpret_cast<const uint8*>(Utf8Value.Get()), Length);
+		}
+
+		bool WriteVariant(const FVariantData& Data)
+		{
+			const EOnlineKeyValuePairDataType::Type Type = Data.GetType();
+			switch (Type)
+			{
+			case EOnlineKeyValuePairDataType::Int32:
+			{
+				int32 Value = 0;
+				Data.GetValue(Value);
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteUInt32(static_cast<uint32>(Value));
+				return true;
+			}
+			case EOnlineKeyValuePairDataType::UInt32:
+			{
+				uint32 Value = 0;
+				Data.GetValue(Value);
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteUInt32(Value);
+				return true;
+			}
+			case EOnlineKeyValuePairDataType::Int64:
+			{
+				int64 Value = 0;
+				Data.GetValue(Value);
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteUInt64(static_cast<uint64>(Value));
+				return true;
+			}
+			case EOnlineKeyValuePairDataType::UInt64:
+			{
+				uint64 Value = 0;
+				Data.GetValue(Value);
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteUInt64(Value);
+				return true;
+			}
+			case EOnlineKeyValuePairDataType::Float:
+			{
+				float Value = 0.0f;
+				uint32 Bits = 0;
+				Data.GetValue(Value);
+				FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteUInt32(Bits);
+				return true;
+			}
+			case EOnlineKeyValuePairDataType::Double:
+			{
+				double Value = 0.0;
+				uint64 Bits = 0;
+				Data.GetValue(Value);
+				FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteUInt64(Bits);
+				return true;
+			}
+			case EOnlineKeyValuePairDataType::Bool:
+			{
+				bool bValue = false;
+				Data.GetValue(bValue);
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteUInt8(bValue == true ? 1 : 0);
+				return true;
+			}
+			case EOnlineKeyValuePairDataType::String:
+			{
+				FString Value;
+				Data.GetValue(Value);
+				WriteUInt8(static_cast<uint8>(Type));
+				WriteString(Value);
+				return true;
+			}
+			default:
+				return false;
+			}
+		}
+
+	private:
+		void WriteLittleEndian(uint64 Value, int32 ByteCount)
+		{
+			for (int32 ByteIndex = 0; ByteIndex < ByteCount; ByteIndex++)
+			{
+				Buffer.Add(static_cast<uint8>((Value >> (8 * ByteIndex)) & 0xff));
+			}
+		}
+
+	private:
+		TArray<uint8>& Buffer;
+	};
+
+	class FBeaconReader
+	{
+	public:
+		FBeaconReader(const uint8* InData, int32 InSize)
+			: Data(InData)
+			, Size(InSize)
+		{
+		}
+
+		bool HasError() const
+		{
+			return bError;
+		}
+
+		uint8 ReadUInt8()
+		{
+			return static_cast<uint8>(ReadLittleEndian(1));
+		}
+
+		uint16 ReadUInt16()
+		{
+			return static_cast<uint16>(ReadLittleEndian(2));
+		}
+
+		uint32 ReadUInt32()
+		{
+			return static_cast<uint32>(ReadLittleEndian(4));
+		}
+
+		uint64 ReadUInt64()
+		{
+			return ReadLittleEndian(8);
+		}
+
+		FString ReadString()
+		{
+			const int32 Length = ReadUInt16();
+			if (bError == true || Length > Size - Offset)
+			{
+				bError = true;
+				return FString();
+			}
+
+			const FUTF8ToTCHAR Converter(reinterpret_cast<const UTF8CHAR*>(Data + Offset), Length);
+			Offset += Length;
+			return FString(Converter.Length(), Converter.Get());
+		}
+
+		bool ReadVariant(FVariantData& OutData)
+		{
+			switch (ReadUInt8())
+			{
+			case EOnlineKeyValuePairDataType::Int32:
+				OutData.SetValue(static_cast<int32>(ReadUInt32()));
+				break;
+			case EOnlineKeyValuePairDataType::UInt32:
+				OutData.SetValue(ReadUInt32());
+				break;
+			case EOnlineKeyValuePairDataType::Int64:
+				OutData.SetValue(static_cast<int64>(ReadUInt64()));
+				break;
+			case EOnlineKeyValuePairDataType::UInt64:
+				OutData.SetValue(ReadUInt64());
+				break;
+			case EOnlineKeyValuePairDataType::Float:
+			{
+				const uint32 Bits = ReadUInt32();
+				float Value = 0.0f;
+				FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+				OutData.SetValue(Value);
+				break;
+			}
+			case EOnlineKeyValuePairDataType::Double:
+			{
+				const uint64 Bits = ReadUInt64();
+				double Value = 0.0;
+				FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+				OutData.SetValue(Value);
+				break;
+			}
+			case EOnlineKeyValuePairDataType::Bool:
+				OutData.SetValue(ReadUInt8() != 0);
+				break;
+			case EOnlineKeyValuePairDataType::String:
+				OutData.SetValue(ReadString());
+				break;
+			default:
+				bError = true;
+				break;
+			}
+
+			return bError == false;
+		}
+
+	private:
+		uint64 ReadLittleEndian(int32 ByteCount)
+		{
+			if (bError == true || ByteCount > Size - Offset)
+			{
+				bError = true;
+				return 0;
+			}
+
+			uint64 Value = 0;
+			for (int32 ByteIndex = 0; ByteIndex < ByteCount; ByteIndex++)
+			{
+				Value |= static_cast<uint64>(Data[Offset + ByteIndex]) << (8 * ByteIndex);
+			}
+
+			Offset += ByteCount;
+			return Value;
+		}
+
+	private:
+		const uint8* Data = nullptr;
+		int32 Size = 0;
+		int32 Offset = 0;
+		bool bError = false;
+	};
+}
+
+void MultiplayerSessionLan::WriteBeacon(const FNamedOnlineSession& Session, uint64 HostInstanceId, int32 GamePort, TArray<uint8>& OutBeaconBody)
+{
+	OutBeaconBody.Reset();
+	FBeaconWriter Writer(OutBeaconBody);
+	Writer.WriteUInt8(ProtocolVersion);
+	Writer.WriteUInt64(HostInstanceId);
+	Writer.WriteUInt16(static_cast<uint16>(FMath::Clamp(GamePort, 0, 65535)));
+	Writer.WriteUInt16(static_cast<uint16>(FMath::Clamp(Session.SessionSettings.NumPublicConnections, 0, 65535)));
+	Writer.WriteUInt16(static_cast<uint16>(FMath::Clamp(Session.NumOpenPublicConnections, 0, 65535)));
+
+	uint8 Flags = 0;
+	if (Session.SessionSettings.bAllowJoinInProgress == true)
+	{
+		Flags |= BeaconFlagAllowJoinInProgress;
+	}
+
+	if (Session.SessionSettings.bIsDedicated == true)
+	{
+		Flags |= BeaconFlagDedicated;
+	}
+
+	Writer.WriteUInt8(Flags);
+	Writer.WriteString(Session.OwningUserName);
+
+	const int32 SettingCountOffset = OutBeaconBody.Num();
+	Writer.WriteUInt8(0);
+
+	uint8 SettingCount = 0;
+	for (const TPair<FName, FOnlineSessionSetting>& Setting : Session.SessionSettings.Settings)
+	{
+		if (Setting.Value.AdvertisementType < EOnlineDataAdvertisementType::ViaOnlineService || SettingCount == MAX_uint8)
+		{
+			continue;
+		}
+
+		const int32 SettingOffset = OutBeaconBody.Num();
+		Writer.WriteString(Setting.Key.ToString());
+		if (Writer.WriteVariant(Setting.Value.Data) == false || BeaconHeaderSize + OutBeaconBody.Num() > MaxBeaconSize)
+		{
+			OutBeaconBody.SetNum(SettingOffset);
+			continue;
+		}
+
+		SettingCount++;
+	}
+
+	OutBeaconBody[SettingCountOffset] = SettingCount;
+}
+
+bool MultiplayerSessionLan::ReadBeacon(const uint8* Data, int32 Size, const FIPv4Address& HostAddress, uint64& OutHostInstanceId, FOnlineSessionSearchResult& OutSearchResult)
+{
+	FBeaconReader Reader(Data, Size);
+	if (Reader.ReadUInt8() != ProtocolVersion)
+	{
+		return false;
+	}
+
+	const uint64 HostInstanceId = Reader.ReadUInt64();
+	const uint16 GamePort = Reader.ReadUInt16();
+	const uint16 MaxPlayers = Reader.ReadUInt16();
+	const uint16 OpenPlayers = Reader.ReadUInt16();
+	const uint8 Flags = Reader.ReadUInt8();
+	const FString OwningUserName = Reader.ReadString();
+	const uint8 SettingCount = Reader.ReadUInt8();
+
+	FOnlineSessionSearchResult SearchResult;
+	FOnlineSessionSettings& SessionSettings = SearchResult.Session.SessionSettings;
+	SessionSettings.bIsLANMatch = true;
+	SessionSettings.bShouldAdvertise = true;
+	SessionSettings.NumPublicConnections = MaxPlayers;
+	SessionSettings.bAllowJoinInProgress = (Flags & BeaconFlagAllowJoinInProgress) != 0;
+	SessionSettings.bIsDedicated = (Flags & BeaconFlagDedicated) != 0;
+
+	for (int32 SettingIndex = 0; SettingIndex < SettingCount; SettingIndex++)
+	{
+		const FString Key = Reader.ReadString();
+		FVariantData Value;
+		if (Reader.ReadVariant(Value) == false)
+		{
+			return false;
+		}
+
+		const FName KeyName(*Key, FNAME_Find);
+		if (KeyName.IsNone() == false)
+		{
+			SessionSettings.Settings.Add(KeyName, FOnlineSessionSetting(Value, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing));
+		}
+	}
+
+	if (Reader.HasError() == true || GamePort == 0)
+	{
+		return false;
+	}
+
+	const TSharedRef<FMultiplayerSessionLanSessionInfo> SessionInfo = MakeShared<FMultiplayerSessionLanSessionInfo>(FIPv4Endpoint(HostAddress, GamePort), HostInstanceId);
+	SearchResult.Session.SessionInfo = SessionInfo;
+	SearchResult.Session.OwningUserId = SessionInfo->GetSessionIdRef();
+	SearchResult.Session.OwningUserName = OwningUserName;
+	SearchResult.Session.NumOpenPublicConnections = OpenPlayers;
+
+	OutHostInstanceId = HostInstanceId;
+	OutSearchResult = MoveTemp(SearchResult);
+	return true;
+}
+
+bool MultiplayerSessionLan::GetHostEndpoint(const FOnlineSessionSearchResult& SearchResult, FIPv4Endpoint& OutEndpoint)
+{
+	const TSharedPtr<FOnlineSessionInfo>& SessionInfo = SearchResult.Session.SessionInfo;
+	if (SessionInfo.IsValid() == false || SessionInfo->GetSessionId().GetType() != SessionIdType)
+	{
+		return false;
+	}
+
+	OutEndpoint = static_cast<const FMultiplayerSessionLanSessionInfo*>(SessionInfo.Get())->GetHostEndpoint();
+	return true;
+}
+
+FMultiplayerSessionLanSessionInfo::FMultiplayerSessionLanSessionInfo(const FIPv4Endpoint& InHostEndpoint, uint64 InHostInstanceId)
+	: HostEndpoint(InHostEndpoint)
+	, SessionId(FUniqueNetIdString::Create(FString::Printf(TEXT("%016llx"), static_cast<unsigned long long>(InHostInstanceId)), MultiplayerSessionLan::SessionIdType))
+{
+}
+
+FString FMultiplayerSessionLanSessionInfo::ToDebugString() const
+{
+	return FString::Printf(TEXT("HostEndpoint: %s SessionId: %s"), *HostEndpoint.ToString(), *SessionId->ToDebugString());
+}
+
+FMultiplayerSessionLanHost::~FMultiplayerSessionLanHost()
+{
+	Stop();
+}
+
+bool FMultiplayerSessionLanHost::Start(int32 BasePort, int32 PortCount, int32 InMaxRepliesPerSecond)
+{
+	Stop();
+
+	for (int32 PortOffset = 0; PortOffset < FMath::Max(1, PortCount) && Socket == nullptr; PortOffset++)
+	{
+		const int32 Port = BasePort + PortOffset;
+		if (Port <= 0 || Port > 65535)
+		{
+			break;
+		}
+
+		Socket = FUdpSocketBuilder(TEXT("MultiplayerSessionsLanHost"))
+			.AsNonBlocking()
+			.BoundToAddress(FIPv4Address::Any)
+			.BoundToPort(Port)
+			.WithBroadcast()
+			.Build();
+		if (Socket != nullptr)
+		{
+			BoundPort = Port;
+		}
+	}
+
+	if (Socket == nullptr)
+	{
+		return false;
+	}
+
+	const FGuid InstanceGuid = FGuid::NewGuid();
+	InstanceId = ((static_cast<uint64>(InstanceGuid.A) << 32) | InstanceGuid.B) ^ ((static_cast<uint64>(InstanceGuid.C) << 32) | InstanceGuid.D);
+
+	{
+		FScopeLock Lock(&BeaconLock);
+		MaxRepliesPerSecond = FMath::Max(1, InMaxRepliesPerSecond);
+		ReplyTokens = MaxRepliesPerSecond;
+		LastTokenRefillSeconds = FPlatformTime::Seconds();
+		RepliesSent = 0;
+		QueriesDropped = 0;
+	}
+
+	Receiver = new FUdpSocketReceiver(Socket, FTimespan::FromMilliseconds(50), TEXT("MultiplayerSessionsLanHost"));
+	Receiver->OnDataReceived().BindRaw(this, &FMultiplayerSessionLanHost::HandleDataReceived);
+	Receiver->Start();
+	return true;
+}
+
+void FMultiplayerSessionLanHost::Stop()
+{
+	MultiplayerSessionPing::DestroyUdpSocket(Socket, Receiver);
+	BoundPort = 0;
+
+	FScopeLock Lock(&BeaconLock);
+	BeaconBody.Reset();
+	LastReplySecondsBySender.Reset();
+}
+
+void FMultiplayerSessionLanHost::SetBeacon(const TArray<uint8>& InBeaconBody)
+{
+	if (MultiplayerSessionLan::BeaconHeaderSize + InBeaconBody.Num() > MultiplayerSessionLan::MaxBeaconSize)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&BeaconLock);
+	BeaconBody = InBeaconBody;
+}
+
+void FMultiplayerSessionLanHost::GetCounters(uint32& OutRepliesSent, uint32& OutQueriesDropped)
+{
+	FScopeLock Lock(&BeaconLock);
+	OutRepliesSent = RepliesSent;
+	OutQueriesDropped = QueriesDropped;
+}
+
+void FMultiplayerSessionLanHost::HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender)
+{
+	if (Socket == nullptr || Data->Num() != MultiplayerSessionLan::QuerySize || MultiplayerSessionPing::ReadUInt32(Data->GetData()) != MultiplayerSessionLan::QueryMagic)
+	{
+		return;
+	}
+
+	uint8 Reply[MultiplayerSessionLan::MaxBeaconSize];
+	int32 ReplySize = 0;
+	{
+		FScopeLock Lock(&BeaconLock);
+		if (BeaconBody.Num() == 0)
+		{
+			return;
+		}
+
+		if (ConsumeReplyBudget(Sender, FPlatformTime::Seconds()) == false)
+		{
+			QueriesDropped++;
+			return;
+		}
+
+		MultiplayerSessionPing::WriteUInt32(Reply, MultiplayerSessionLan::BeaconMagic);
+		FMemory::Memcpy(Reply + 4, Data->GetData() + 4, 8);
+		FMemory::Memcpy(Reply + MultiplayerSessionLan::BeaconHeaderSize, BeaconBody.GetData(), BeaconBody.Num());
+		ReplySize = MultiplayerSessionLan::BeaconHeaderSize + BeaconBody.Num();
+		RepliesSent++;
+	}
+
+	int32 BytesSent = 0;
+	Socket->SendTo(Reply, ReplySize, BytesSent, *Sender.ToInternetAddr());
+}
+
+bool FMultiplayerSessionLanHost::ConsumeReplyBudget(const FIPv4Endpoint& Sender, double CurrentSeconds)
+{
+	ReplyTokens = FMath::Min(MaxRepliesPerSecond, ReplyTokens + (CurrentSeconds - LastTokenRefillSeconds) * MaxRepliesPerSecond);
+	LastTokenRefillSeconds = CurrentSeconds;
+	if (ReplyTokens < 1.0)
+	{
+		return false;
+	}
+
+	const uint64 SenderKey = (static_cast<uint64>(Sender.Address.Value) << 16) | Sender.Port;
+	if (const double* LastReplySeconds = LastReplySecondsBySender.Find(SenderKey))
+	{
+		if (CurrentSeconds - *LastReplySeconds < MinReplyIntervalSeconds)
+		{
+			return false;
+		}
+	}
+
+	if (LastReplySecondsBySender.Num() >= MaxTrackedSenders)
+	{
+		for (TMap<uint64, double>::TIterator It = LastReplySecondsBySender.CreateIterator(); It; ++It)
+		{
+			if (CurrentSeconds - It.Value() >= MinReplyIntervalSeconds)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	LastReplySecondsBySender.Add(SenderKey, CurrentSeconds);
+	ReplyTokens -= 1.0;
+	return true;
+}
+
+FMultiplayerSessionLanSearch::FMultiplayerSessionLanSearch(int32 InBasePort, int32 InPortCount, int32 InQueryAttempts, double InQueryIntervalSeconds, int32 InMaxHosts)
+	: BasePort(InBasePort)
+	, PortCount(FMath::Max(1, InPortCount))
+	, QueryAttempts(FMath::Max(1, InQueryAttempts))
+	, QueryIntervalSeconds(FMath::Max(0.01, InQueryIntervalSeconds))
+	, MaxHosts(FMath::Max(1, InMaxHosts))
+{
+}
+
+FMultiplayerSessionLanSearch::~FMultiplayerSessionLanSearch()
+{
+	Stop();
+}
+
+bool FMultiplayerSessionLanSearch::Start()
+{
+	Stop();
+
+	Socket = FUdpSocketBuilder(TEXT("MultiplayerSessionsLanSearch"))
+		.AsNonBlocking()
+		.BoundToPort(0)
+		.WithBroadcast()
+		.WithReceiveBufferSize(SearchReceiveBufferBytes)
+		.Build();
+	if (Socket == nullptr)
+	{
+		return false;
+	}
+
+	Receiver = new FUdpSocketReceiver(Socket, FTimespan::FromMilliseconds(10), TEXT("MultiplayerSessionsLanSearch"));
+	Receiver->OnDataReceived().BindRaw(this, &FMultiplayerSessionLanSearch::HandleDataReceived);
+	Receiver->Start();
+
+	QueryAddresses.Reset();
+	QueryAddresses.Add(FIPv4Address::LanBroadcast);
+	QueryAddresses.Add(FIPv4Address::InternalLoopback);
+
+	TArray<TSharedPtr<FInternetAddr>> AdapterAddresses;
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (SocketSubsystem != nullptr && SocketSubsystem->GetLocalAdapterAddresses(AdapterAddresses) == true)
+	{
+		for (const TSharedPtr<FInternetAddr>& AdapterAddress : AdapterAddresses)
+		{
+			uint32 AdapterIp = 0;
+			if (AdapterAddress.IsValid() == false || AdapterAddress->GetProtocolType() != FNetworkProtocolTypes::IPv4)
+			{
+				continue;
+			}
+
+			AdapterAddress->GetIp(AdapterIp);
+			const FIPv4Address Address(AdapterIp);
+			if (AdapterIp == 0 || Address.IsLoopbackAddress() == true)
+			{
+				continue;
+			}
+
+			QueryAddresses.AddUnique(FIPv4Address(AdapterIp | ~AssumedSubnetMask));
+		}
+	}
+
+	Nonce = static_cast<uint32>(FMath::Rand()) ^ (static_cast<uint32>(FPlatformTime::Cycles()) << 1);
+	SeenHostIds.Reset();
+	QuerySendSeconds.Reset();
+	NextQuerySeconds = 0.0;
+	DuplicateCount = 0;
+	return true;
+}
+
+void FMultiplayerSessionLanSearch::Stop()
+{
+	MultiplayerSessionPing::DestroyUdpSocket(Socket, Receiver);
+	Replies.Empty();
+}
+
+void FMultiplayerSessionLanSearch::Tick(double CurrentSeconds, TArray<FHost>& OutNewHosts)
+{
+	if (Socket == nullptr)
+	{
+		return;
+	}
+
+	if (QuerySendSeconds.Num() < QueryAttempts && CurrentSeconds >= NextQuerySeconds)
+	{
+		SendQueries(CurrentSeconds);
+	}
+
+	FReply Reply;
+	while (Replies.Dequeue(Reply) == true)
+	{
+		const uint8* ReplyData = Reply.Data.GetData();
+		if (MultiplayerSessionPing::ReadUInt32(ReplyData + 4) != Nonce)
+		{
+			continue;
+		}
+
+		const uint32 Sequence = MultiplayerSessionPing::ReadUInt32(ReplyData + 8);
+		if (Sequence >= static_cast<uint32>(QuerySendSeconds.Num()))
+		{
+			continue;
+		}
+
+		const uint8* BeaconBody = ReplyData + MultiplayerSessionLan::BeaconHeaderSize;
+		const int32 BeaconBodySize = Reply.Data.Num() - MultiplayerSessionLan::BeaconHeaderSize;
+		const uint64 PeekedInstanceId = static_cast<uint64>(MultiplayerSessionPing::ReadUInt32(BeaconBody + 1)) | (static_cast<uint64>(MultiplayerSessionPing::ReadUInt32(BeaconBody + 5)) << 32);
+		if (SeenHostIds.Contains(PeekedInstanceId) == true)
+		{
+			DuplicateCount++;
+			continue;
+		}
+
+		if (SeenHostIds.Num() >= MaxHosts)
+		{
+			continue;
+		}
+
+		FHost Host;
+		if (MultiplayerSessionLan::ReadBeacon(BeaconBody, BeaconBodySize, Reply.SenderAddress, Host.InstanceId, Host.SearchResult) == false)
+		{
+			continue;
+		}
+
+		SeenHostIds.Add(Host.InstanceId);
+		Host.SearchResult.PingInMs = FMath::Max(0, FMath::RoundToInt((Reply.ReceiveSeconds - QuerySendSeconds[Sequence]) * 1000.0));
+		OutNewHosts.Add(MoveTemp(Host));
+	}
+}
+
+void FMultiplayerSessionLanSearch::SendQueries(double CurrentSeconds)
+{
+	uint8 Query[MultiplayerSessionLan::QuerySize];
+	MultiplayerSessionPing::WriteUInt32(Query, MultiplayerSessionLan::QueryMagic);
+	MultiplayerSessionPing::WriteUInt32(Query + 4, Nonce);
+	MultiplayerSessionPing::WriteUInt32(Query + 8, static_cast<uint32>(QuerySendSeconds.Num()));
+	QuerySendSeconds.Add(CurrentSeconds);
+	NextQuerySeconds = CurrentSeconds + QueryIntervalSeconds;
+
+	for (int32 PortOffset = 0; PortOffset < PortCount; PortOffset++)
+	{
+		const int32 Port = BasePort + PortOffset;
+		if (Port <= 0 || Port > 65535)
+		{
+			break;
+		}
+
+		for (const FIPv4Address& QueryAddress : QueryAddresses)
+		{
+			int32 BytesSent = 0;
+			Socket->SendTo(Query, MultiplayerSessionLan::QuerySize, BytesSent, *FIPv4Endpoint(QueryAddress, static_cast<uint16>(Port)).ToInternetAddr());
+		}
+	}
+}
+
+void FMultiplayerSessionLanSearch::HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender)
+{
+	if (Data->Num() < MultiplayerSessionLan::BeaconHeaderSize + 9 || Data->Num() > MultiplayerSessionLan::MaxBeaconSize || MultiplayerSessionPing::ReadUInt32(Data->GetData()) != MultiplayerSessionLan::BeaconMagic)
+	{
+		return;
+	}
+
+	FReply Reply;
+	Reply.Data.Append(Data->GetData(), Data->Num());
+	Reply.SenderAddress = Sender.Address;
+	Reply.ReceiveSeconds = FPlatformTime::Seconds();
+	Replies.Enqueue(MoveTemp(Reply));
+}
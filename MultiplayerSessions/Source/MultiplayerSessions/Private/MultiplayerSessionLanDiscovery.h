@@ -0,0 +1,177 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "OnlineSessionSettings.h"
+#include "Serialization/ArrayReader.h"
+
+class FSocket;
+class FUdpSocketReceiver;
+
+namespace MultiplayerSessionLan
+{
+	inline constexpr uint32 QueryMagic = 0x4D534C51;
+	inline constexpr uint32 BeaconMagic = 0x4D534C42;
+	inline constexpr uint8 ProtocolVersion = 1;
+	inline constexpr int32 QuerySize = 12;
+	inline constexpr int32 BeaconHeaderSize = 12;
+	inline constexpr int32 MaxBeaconSize = 1200;
+
+	inline const FName SessionIdType(TEXT("MultiplayerSessionsLan"));
+
+	void WriteBeacon(const FNamedOnlineSession& Session, uint64 HostInstanceId, int32 GamePort, TArray<uint8>& OutBeaconBody);
+	bool ReadBeacon(const uint8* Data, int32 Size, const FIPv4Address& HostAddress, uint64& OutHostInstanceId, FOnlineSessionSearchResult& OutSearchResult);
+	bool GetHostEndpoint(const FOnlineSessionSearchResult& SearchResult, FIPv4Endpoint& OutEndpoint);
+}
+
+class FMultiplayerSessionLanSessionInfo : public FOnlineSessionInfo
+{
+public:
+	FMultiplayerSessionLanSessionInfo(const FIPv4Endpoint& InHostEndpoint, uint64 InHostInstanceId);
+
+	virtual const uint8* GetBytes() const override
+	{
+		return nullptr;
+	}
+
+	virtual int32 GetSize() const override
+	{
+		return sizeof(FIPv4Endpoint) + sizeof(uint64);
+	}
+
+	virtual bool IsValid() const override
+	{
+		return SessionId->IsValid();
+	}
+
+	virtual FString ToString() const override
+	{
+		return SessionId->ToString();
+	}
+
+	virtual FString ToDebugString() const override;
+
+	virtual const FUniqueNetId& GetSessionId() const override
+	{
+		return *SessionId;
+	}
+
+	const FIPv4Endpoint& GetHostEndpoint() const
+	{
+		return HostEndpoint;
+	}
+
+	FUniqueNetIdRef GetSessionIdRef() const
+	{
+		return SessionId;
+	}
+
+private:
+	FIPv4Endpoint HostEndpoint;
+	FUniqueNetIdRef SessionId;
+};
+
+class FMultiplayerSessionLanHost
+{
+public:
+	~FMultiplayerSessionLanHost();
+
+	bool Start(int32 BasePort, int32 PortCount, int32 InMaxRepliesPerSecond);
+	void Stop();
+	void SetBeacon(const TArray<uint8>& InBeaconBody);
+	void GetCounters(uint32& OutRepliesSent, uint32& OutQueriesDropped);
+
+	bool IsRunning() const
+	{
+		return Socket != nullptr;
+	}
+
+	int32 GetPort() const
+	{
+		return BoundPort;
+	}
+
+	uint64 GetInstanceId() const
+	{
+		return InstanceId;
+	}
+
+private:
+	void HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender);
+	bool ConsumeReplyBudget(const FIPv4Endpoint& Sender, double CurrentSeconds);
+
+private:
+	FSocket* Socket = nullptr;
+	FUdpSocketReceiver* Receiver = nullptr;
+	int32 BoundPort = 0;
+	uint64 InstanceId = 0;
+
+	FCriticalSection BeaconLock;
+	TArray<uint8> BeaconBody;
+	TMap<uint64, double> LastReplySecondsBySender;
+	double MaxRepliesPerSecond = 200.0;
+	double ReplyTokens = 0.0;
+	double LastTokenRefillSeconds = 0.0;
+	uint32 RepliesSent = 0;
+	uint32 QueriesDropped = 0;
+};
+
+class FMultiplayerSessionLanSearch
+{
+public:
+	struct FHost
+	{
+		uint64 InstanceId = 0;
+		FOnlineSessionSearchResult SearchResult;
+	};
+
+	FMultiplayerSessionLanSearch(int32 InBasePort, int32 InPortCount, int32 InQueryAttempts, double InQueryIntervalSeconds, int32 InMaxHosts);
+	~FMultiplayerSessionLanSearch();
+
+	bool Start();
+	void Stop();
+	void Tick(double CurrentSeconds, TArray<FHost>& OutNewHosts);
+
+	int32 GetHostCount() const
+	{
+		return SeenHostIds.Num();
+	}
+
+	int32 GetDuplicateCount() const
+	{
+		return DuplicateCount;
+	}
+
+private:
+	struct FReply
+	{
+		TArray<uint8> Data;
+		FIPv4Address SenderAddress;
+		double ReceiveSeconds = 0.0;
+	};
+
+	void SendQueries(double CurrentSeconds);
+	void HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender);
+
+private:
+	FSocket* Socket = nullptr;
+	FUdpSocketReceiver* Receiver = nullptr;
+	TQueue<FReply, EQueueMode::Spsc> Replies;
+	TArray<FIPv4Address, TInlineAllocator<4>> QueryAddresses;
+
+	TSet<uint64> SeenHostIds;
+	TArray<double, TInlineAllocator<8>> QuerySendSeconds;
+	uint32 Nonce = 0;
+	double NextQuerySeconds = 0.0;
+	int32 DuplicateCount = 0;
+
+	int32 BasePort = 0;
+	int32 PortCount = 1;
+	int32 QueryAttempts = 3;
+	double QueryIntervalSeconds = 0.15;
+	int32 MaxHosts = 200;
+};
@@ -0,0 +1,176 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionLanDiscovery.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr int32 TestBasePort = 47788;
+	constexpr int32 TestPortCount = 4;
+	constexpr int32 TestGamePort = 7777;
+	constexpr double TestWaitSeconds = 1.0;
+
+	const FName TestMapNameKey(TEXT("MultiplayerSessionsLanTestMap"));
+
+	void WriteTestBeacon(uint64 HostInstanceId, int32 PaddingSettingCount, TArray<uint8>& OutBeaconBody)
+	{
+		FOnlineSessionSettings SessionSettings;
+		SessionSettings.NumPublicConnections = 8;
+		SessionSettings.bIsLANMatch = true;
+		SessionSettings.bAllowJoinInProgress = true;
+		SessionSettings.Set(TestMapNameKey, FString(TEXT("TestMap")), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		for (int32 SettingIndex = 0; SettingIndex < PaddingSettingCount; SettingIndex++)
+		{
+			const FName Key(*FString::Printf(TEXT("MultiplayerSessionsLanTestPadding%d"), SettingIndex));
+			SessionSettings.Set(Key, FString::ChrN(100, TEXT('x')), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		}
+
+		FNamedOnlineSession Session(NAME_GameSession, SessionSettings);
+		Session.OwningUserName = TEXT("LanTestHost");
+		Session.NumOpenPublicConnections = 5;
+		MultiplayerSessionLan::WriteBeacon(Session, HostInstanceId, TestGamePort, OutBeaconBody);
+	}
+
+	TArray<FMultiplayerSessionLanSearch::FHost> RunSearch(FMultiplayerSessionLanSearch& Search)
+	{
+		TArray<FMultiplayerSessionLanSearch::FHost> Hosts;
+		const double EndSeconds = FPlatformTime::Seconds() + TestWaitSeconds;
+		while (FPlatformTime::Seconds() < EndSeconds)
+		{
+			Search.Tick(FPlatformTime::Seconds(), Hosts);
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		return Hosts;
+	}
+
+	const FMultiplayerSessionLanSearch::FHost* FindHost(const TArray<FMultiplayerSessionLanSearch::FHost>& Hosts, uint64 InstanceId)
+	{
+		return Hosts.FindByPredicate([InstanceId](const FMultiplayerSessionLanSearch::FHost& Host)
+		{
+			return Host.InstanceId == InstanceId;
+		});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionLanRoundTripTest, "MultiplayerSessions.LanDiscovery.RoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMultiplayerSessionLanRoundTripTest::RunTest(const FString& Parameters)
+{
+	FMultiplayerSessionLanHost Host;
+	if (TestTrue(TEXT("Host binds a discovery port"), Host.Start(TestBasePort, TestPortCount, 200)) == false)
+	{
+		return false;
+	}
+
+	TArray<uint8> BeaconBody;
+	WriteTestBeacon(Host.GetInstanceId(), 0, BeaconBody);
+	Host.SetBeacon(BeaconBody);
+
+	FMultiplayerSessionLanSearch Search(TestBasePort, TestPortCount, 3, 0.1, 16);
+	if (TestTrue(TEXT("Search opens its socket"), Search.Start()) == false)
+	{
+		return false;
+	}
+
+	const TArray<FMultiplayerSessionLanSearch::FHost> Hosts = RunSearch(Search);
+	const FMultiplayerSessionLanSearch::FHost* FoundHost = FindHost(Hosts, Host.GetInstanceId());
+	if (TestNotNull(TEXT("Host answered over loopback"), FoundHost) == false)
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Host is listed once"), Hosts.FilterByPredicate([&Host](const FMultiplayerSessionLanSearch::FHost& Entry) { return Entry.InstanceId == Host.GetInstanceId(); }).Num(), 1);
+	TestTrue(TEXT("Repeated replies are counted as duplicates"), Search.GetDuplicateCount() >= 2);
+
+	const FOnlineSessionSearchResult& SearchResult = FoundHost->SearchResult;
+	FIPv4Endpoint HostEndpoint;
+	TestTrue(TEXT("Result carries the host endpoint"), MultiplayerSessionLan::GetHostEndpoint(SearchResult, HostEndpoint));
+	TestEqual(TEXT("Game port"), static_cast<int32>(HostEndpoint.Port), TestGamePort);
+	TestEqual(TEXT("Max players"), SearchResult.Session.SessionSettings.NumPublicConnections, 8);
+	TestEqual(TEXT("Open players"), SearchResult.Session.NumOpenPublicConnections, 5);
+	TestEqual(TEXT("Owner name"), SearchResult.Session.OwningUserName, FString(TEXT("LanTestHost")));
+	TestTrue(TEXT("Join in progress flag"), SearchResult.Session.SessionSettings.bAllowJoinInProgress);
+
+	FString MapName;
+	TestTrue(TEXT("Advertised setting survives"), SearchResult.Session.SessionSettings.Get(TestMapNameKey, MapName));
+	TestEqual(TEXT("Advertised setting value"), MapName, FString(TEXT("TestMap")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionLanRateLimitTest, "MultiplayerSessions.LanDiscovery.RateLimit", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMultiplayerSessionLanRateLimitTest::RunTest(const FString& Parameters)
+{
+	FMultiplayerSessionLanHost Host;
+	if (TestTrue(TEXT("Host binds a discovery port"), Host.Start(TestBasePort, TestPortCount, 1)) == false)
+	{
+		return false;
+	}
+
+	TArray<uint8> BeaconBody;
+	WriteTestBeacon(Host.GetInstanceId(), 0, BeaconBody);
+	Host.SetBeacon(BeaconBody);
+
+	constexpr int32 QueryAttempts = 5;
+	FMultiplayerSessionLanSearch Search(TestBasePort, TestPortCount, QueryAttempts, 0.01, 16);
+	if (TestTrue(TEXT("Search opens its socket"), Search.Start()) == false)
+	{
+		return false;
+	}
+
+	const TArray<FMultiplayerSessionLanSearch::FHost> Hosts = RunSearch(Search);
+	TestNotNull(TEXT("First query is answered"), FindHost(Hosts, Host.GetInstanceId()));
+
+	uint32 RepliesSent = 0;
+	uint32 QueriesDropped = 0;
+	Host.GetCounters(RepliesSent, QueriesDropped);
+	TestEqual(TEXT("Only the budgeted reply is sent"), static_cast<int32>(RepliesSent), 1);
+	TestTrue(TEXT("Queries over budget are dropped"), QueriesDropped >= static_cast<uint32>(QueryAttempts - 1));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionLanBeaconSizeTest, "MultiplayerSessions.LanDiscovery.BeaconSize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMultiplayerSessionLanBeaconSizeTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 PaddingSettingCount = 40;
+	FMultiplayerSessionLanHost Host;
+	if (TestTrue(TEXT("Host binds a discovery port"), Host.Start(TestBasePort, TestPortCount, 200)) == false)
+	{
+		return false;
+	}
+
+	TArray<uint8> BeaconBody;
+	WriteTestBeacon(Host.GetInstanceId(), PaddingSettingCount, BeaconBody);
+	TestTrue(TEXT("Beacon fits in one datagram"), MultiplayerSessionLan::BeaconHeaderSize + BeaconBody.Num() <= MultiplayerSessionLan::MaxBeaconSize);
+
+	uint64 InstanceId = 0;
+	FOnlineSessionSearchResult SearchResult;
+	TestFalse(TEXT("Cut beacon is rejected"), MultiplayerSessionLan::ReadBeacon(BeaconBody.GetData(), BeaconBody.Num() - 1, FIPv4Address::InternalLoopback, InstanceId, SearchResult));
+
+	Host.SetBeacon(BeaconBody);
+	FMultiplayerSessionLanSearch Search(TestBasePort, TestPortCount, 1, 0.1, 16);
+	if (TestTrue(TEXT("Search opens its socket"), Search.Start()) == false)
+	{
+		return false;
+	}
+
+	const TArray<FMultiplayerSessionLanSearch::FHost> Hosts = RunSearch(Search);
+	const FMultiplayerSessionLanSearch::FHost* FoundHost = FindHost(Hosts, Host.GetInstanceId());
+	if (TestNotNull(TEXT("Full beacon is received"), FoundHost) == false)
+	{
+		return false;
+	}
+
+	const int32 SettingCount = FoundHost->SearchResult.Session.SessionSettings.Settings.Num();
+	TestTrue(TEXT("Settings that fit are kept"), SettingCount > 1);
+	TestTrue(TEXT("Settings that do not fit are left out"), SettingCount < PaddingSettingCount + 1);
+	TestTrue(TEXT("Settings written before the limit are kept"), FoundHost->SearchResult.Session.SessionSettings.Settings.Contains(TestMapNameKey));
+	return true;
+}
+
+#endif
@@ -5,4 +5,21 @@
 void UMultiplayerSessionListItem::Initialize(const FMultiplayerSessionBrowserEntry& InBrowserEntry)
 {
 	BrowserEntry = InBrowserEntry;
+	BuildDisplayTexts();
+}
+
+void UMultiplayerSessionListItem::BuildDisplayTexts()
+{
+	HostText = FText::FromString(BrowserEntry.HostDisplayName);
+	StatusText = FText::FromString(BrowserEntry.StatusText);
+	FreeSlotsText = FText::AsNumber(FMath::Max(0, BrowserEntry.OpenPublicConnections));
+
+	if (BrowserEntry.PingInMs >= 0)
+	{
+		PingText = FText::Format(NSLOCTEXT("MultiplayerSessions", "PingFormat", "{0} ms"), FText::AsNumber(BrowserEntry.PingInMs));
+	}
+	else
+	{
+		PingText = NSLOCTEXT("MultiplayerSessions", "UnknownPing", "--");
+	}
 }
@@ -0,0 +1,663 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionPing.h"
+
+#include "Common/UdpSocketBuilder.h"
+#include "Common/UdpSocketReceiver.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+namespace
+{
+	constexpr double MaxRepliesPerSecond = 500.0;
+	constexpr double SenderRepliesPerSecond = 20.0;
+	constexpr double SenderReplyBurst = 8.0;
+	constexpr int32 MaxTrackedReplySenders = 1024;
+}
+
+void MultiplayerSessionPing::WriteUInt32(uint8* Buffer, uint32 Value)
+{
+	Buffer[0] = static_cast<uint8>(Value & 0xff);
+	Buffer[1] = static_cast<uint8>((Value >> 8) & 0xff);
+	Buffer[2] = static_cast<uint8>((Value >> 16) & 0xff);
+	Buffer[3] = static_cast<uint8>((Value >> 24) & 0xff);
+}
+
+uint32 MultiplayerSessionPing::ReadUInt32(const uint8* Buffer)
+{
+	return static_cast<uint32>(Buffer[0]) | (static_cast<uint32>(Buffer[1]) << 8) | (static_cast<uint32>(Buffer[2]) << 16) | (static_cast<uint32>(Buffer[3]) << 24);
+}
+
+void MultiplayerSessionPing::DestroyUdpSocket(FSocket*& Socket, FUdpSocketReceiver*& Receiver)
+{
+	if (Receiver != nullptr)
+	{
+		Receiver->Stop();
+		delete Receiver;
+		Receiver = nullptr;
+	}
+
+	if (Socket != nullptr)
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+}
+
+FMultiplayerSessionPingResponder::~FMultiplayerSessionPingResponder()
+{
+	Stop();
+}
+
+bool FMultiplayerSessionPingResponder::Start(int32 Port)
+{
+	Stop();
+
+	if (Port <= 0 || Port > 65535)
+	{
+		return false;
+	}
+
+	Socket = FUdpSocketBuilder(TEXT("MultiplayerSessionsPingResponder"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToPort(Port)
+		.Build();
+	if (Socket == nullptr)
+	{
+		return false;
+	}
+
+	BoundPort = Port;
+	ReplyTokens = MaxRepliesPerSecond;
+	LastReplyRefillSeconds = FPlatformTime::Seconds();
+	Receiver = new FUdpSocketReceiver(Socket, FTimespan::FromMilliseconds(50), TEXT("MultiplayerSessionsPingResponder"));
+	Receiver->OnDataReceived().BindRaw(this, &FMultiplayerSessionPingResponder::HandleDataReceived);
+	Receiver->Start();
+	return true;
+}
+
+void FMultiplayerSessionPingResponder::Stop()
+{
+	MultiplayerSessionPing::DestroyUdpSocket(Socket, Receiver);
+	BoundPort = 0;
+	ReplyBucketsBySender.Reset();
+
+	FScopeLock Lock(&ReservationLock);
+	Reservations.Reset();
+	OpenSlots = 0;
+}
+
+void FMultiplayerSessionPingResponder::ConfigureReservations(bool bEnabled, double InReservationSeconds, int32 InMaxReservationsPerAddress)
+{
+	FScopeLock Lock(&ReservationLock);
+	bReservationsEnabled = bEnabled;
+	ReservationSeconds = FMath::Max(1.0, InReservationSeconds);
+	MaxReservationsPerAddress = FMath::Max(1, InMaxReservationsPerAddress);
+	if (bReservationsEnabled == false)
+	{
+		Reservations.Reset();
+	}
+}
+
+void FMultiplayerSessionPingResponder::SetOpenSlots(int32 InOpenSlots)
+{
+	FScopeLock Lock(&ReservationLock);
+	OpenSlots = FMath::Max(0, InOpenSlots);
+}
+
+bool FMultiplayerSessionPingResponder::ConsumeReservation(const FString& PlayerId)
+{
+	FScopeLock Lock(&ReservationLock);
+	PurgeExpiredReservations(FPlatformTime::Seconds());
+
+	if (PlayerId.IsEmpty() == true)
+	{
+		return false;
+	}
+
+	const int32 ReservationIndex = Reservations.IndexOfByPredicate([&PlayerId](const FReservation& Reservation) { return Reservation.PlayerId == PlayerId; });
+	if (ReservationIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Reservations.RemoveAtSwap(ReservationIndex);
+	return true;
+}
+
+void FMultiplayerSessionPingResponder::ClearReservations()
+{
+	FScopeLock Lock(&ReservationLock);
+	Reservations.Reset();
+}
+
+int32 FMultiplayerSessionPingResponder::GetReservedSlotCount(double CurrentSeconds)
+{
+	FScopeLock Lock(&ReservationLock);
+	PurgeExpiredReservations(CurrentSeconds);
+	return Reservations.Num();
+}
+
+uint32 FMultiplayerSessionPingResponder::GetReservationRequestCount()
+{
+	FScopeLock Lock(&ReservationLock);
+	return ReservationRequestCount;
+}
+
+void FMultiplayerSessionPingResponder::PurgeExpiredReservations(double CurrentSeconds)
+{
+	Reservations.RemoveAllSwap([CurrentSeconds](const FReservation& Reservation)
+	{
+		return CurrentSeconds >= Reservation.ExpirySeconds;
+	});
+}
+
+void FMultiplayerSessionPingResponder::HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender)
+{
+	if (Data.IsValid() == false || Data->Num() < 4)
+	{
+		return;
+	}
+
+	const uint32 Magic = MultiplayerSessionPing::ReadUInt32(Data->GetData());
+	if (Magic == MultiplayerSessionPing::ReservationRequestMagic && Data->Num() >= MultiplayerSessionPing::ReservationRequestHeaderSize && Data->Num() <= MultiplayerSessionPing::ReservationRequestHeaderSize + MultiplayerSessionPing::MaxReservationPlayerIdBytes)
+	{
+		if (ConsumeReplyBudget(Sender, FPlatformTime::Seconds()) == false)
+		{
+			return;
+		}
+
+		HandleReservationRequest(Data->GetData(), Data->Num(), Sender);
+		return;
+	}
+
+	if (Magic == MultiplayerSessionPing::ReservationReleaseMagic && Data->Num() == MultiplayerSessionPing::ReservationReleaseSize)
+	{
+		HandleReservationRelease(Data->GetData(), Sender);
+		return;
+	}
+
+	if (Data->Num() != MultiplayerSessionPing::PacketSize || Magic != MultiplayerSessionPing::PacketMagic)
+	{
+		return;
+	}
+
+	if (ConsumeReplyBudget(Sender, FPlatformTime::Seconds()) == false)
+	{
+		return;
+	}
+
+	int32 BytesSent = 0;
+	Socket->SendTo(Data->GetData(), Data->Num(), BytesSent, *Sender.ToInternetAddr());
+}
+
+bool FMultiplayerSessionPingResponder::ConsumeReplyBudget(const FIPv4Endpoint& Sender, double CurrentSeconds)
+{
+	ReplyTokens = FMath::Min(MaxRepliesPerSecond, ReplyTokens + (CurrentSeconds - LastReplyRefillSeconds) * MaxRepliesPerSecond);
+	LastReplyRefillSeconds = CurrentSeconds;
+	if (ReplyTokens < 1.0)
+	{
+		return false;
+	}
+
+	const uint64 SenderKey = (static_cast<uint64>(Sender.Address.Value) << 16) | Sender.Port;
+	FReplyBucket* Bucket = ReplyBucketsBySender.Find(SenderKey);
+	if (Bucket == nullptr)
+	{
+		if (ReplyBucketsBySender.Num() >= MaxTrackedReplySenders)
+		{
+			for (TMap<uint64, FReplyBucket>::TIterator It = ReplyBucketsBySender.CreateIterator(); It; ++It)
+			{
+				if (It.Value().Tokens + (CurrentSeconds - It.Value().LastRefillSeconds) * SenderRepliesPerSecond >= SenderReplyBurst)
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			if (ReplyBucketsBySender.Num() >= MaxTrackedReplySenders)
+			{
+				return false;
+			}
+		}
+
+		Bucket = &ReplyBucketsBySender.Add(SenderKey, FReplyBucket{ SenderReplyBurst, CurrentSeconds });
+	}
+
+	Bucket->Tokens = FMath::Min(SenderReplyBurst, Bucket->Tokens + (CurrentSeconds - Bucket->LastRefillSeconds) * SenderRepliesPerSecond);
+	Bucket->LastRefillSeconds = CurrentSeconds;
+	if (Bucket->Tokens < 1.0)
+	{
+		return false;
+	}
+
+	Bucket->Tokens -= 1.0;
+	ReplyTokens -= 1.0;
+	return true;
+}
+
+void FMultiplayerSessionPingResponder::HandleReservationRequest(const uint8* Request, int32 RequestSize, const FIPv4Endpoint& Sender)
+{
+	const uint32 Ticket = MultiplayerSessionPing::ReadUInt32(Request + 8);
+	const int32 PlayerIdBytes = static_cast<int32>(Request[12]) | (static_cast<int32>(Request[13]) << 8);
+	if (PlayerIdBytes != RequestSize - MultiplayerSessionPing::ReservationRequestHeaderSize)
+	{
+		return;
+	}
+
+	const FUTF8ToTCHAR PlayerIdConverter(reinterpret_cast<const UTF8CHAR*>(Request + MultiplayerSessionPing::ReservationRequestHeaderSize), PlayerIdBytes);
+	const FString PlayerId(PlayerIdConverter.Length(), PlayerIdConverter.Get());
+	if (PlayerId.IsEmpty() == true)
+	{
+		return;
+	}
+
+	const uint32 Address = Sender.Address.Value;
+	const double CurrentSeconds = FPlatformTime::Seconds();
+
+	MultiplayerSessionPing::EReservationResult Result = MultiplayerSessionPing::EReservationResult::Rejected;
+	{
+		FScopeLock Lock(&ReservationLock);
+		if (bReservationsEnabled == false)
+		{
+			return;
+		}
+
+		PurgeExpiredReservations(CurrentSeconds);
+		FReservation* Reservation = Reservations.FindByPredicate([Address, Ticket](const FReservation& Existing)
+		{
+			return Existing.Address == Address && Existing.Ticket == Ticket;
+		});
+
+		if (Reservation != nullptr)
+		{
+			if (Reservation->PlayerId == PlayerId)
+			{
+				Reservation->ExpirySeconds = CurrentSeconds + ReservationSeconds;
+				Result = MultiplayerSessionPing::EReservationResult::Granted;
+			}
+		}
+		else if (Reservations.ContainsByPredicate([&PlayerId](const FReservation& Existing) { return Existing.PlayerId == PlayerId; }) == true)
+		{
+			Result = MultiplayerSessionPing::EReservationResult::Granted;
+		}
+		else
+		{
+			ReservationRequestCount++;
+			int32 AddressReservations = 0;
+			for (const FReservation& Existing : Reservations)
+			{
+				AddressReservations += Existing.Address == Address ? 1 : 0;
+			}
+
+			if (Reservations.Num() < OpenSlots && AddressReservations < MaxReservationsPerAddress)
+			{
+				FReservation& NewReservation = Reservations.AddDefaulted_GetRef();
+				NewReservation.Address = Address;
+				NewReservation.Ticket = Ticket;
+				NewReservation.PlayerId = PlayerId;
+				NewReservation.ExpirySeconds = CurrentSeconds + ReservationSeconds;
+				Result = MultiplayerSessionPing::EReservationResult::Granted;
+			}
+		}
+	}
+
+	uint8 Reply[MultiplayerSessionPing::ReservationReplySize];
+	MultiplayerSessionPing::WriteUInt32(Reply, MultiplayerSessionPing::ReservationReplyMagic);
+	FMemory::Memcpy(Reply + 4, Request + 4, 8);
+	MultiplayerSessionPing::WriteUInt32(Reply + 12, static_cast<uint32>(Result));
+
+	int32 BytesSent = 0;
+	Socket->SendTo(Reply, MultiplayerSessionPing::ReservationReplySize, BytesSent, *Sender.ToInternetAddr());
+}
+
+void FMultiplayerSessionPingResponder::HandleReservationRelease(const uint8* Request, const FIPv4Endpoint& Sender)
+{
+	const uint32 Address = Sender.Address.Value;
+	const uint32 Ticket = MultiplayerSessionPing::ReadUInt32(Request + 8);
+
+	FScopeLock Lock(&ReservationLock);
+	Reservations.RemoveAllSwap([Address, Ticket](const FReservation& Reservation)
+	{
+		return Reservation.Address == Address && Reservation.Ticket == Ticket;
+	});
+}
+
+FMultiplayerSessionSlotReserver::FMultiplayerSessionSlotReserver(int32 InAttempts, double InAttemptTimeoutSeconds)
+	: Attempts(FMath::Max(1, InAttempts))
+	, AttemptTimeoutSeconds(FMath::Max(0.05, InAttemptTimeoutSeconds))
+{
+}
+
+FMultiplayerSessionSlotReserver::~FMultiplayerSessionSlotReserver()
+{
+	Stop();
+}
+
+bool FMultiplayerSessionSlotReserver::Start(const FIPv4Endpoint& InHostEndpoint, const FString& InPlayerId)
+{
+	Stop();
+
+	Socket = FUdpSocketBuilder(TEXT("MultiplayerSessionsSlotReserver"))
+		.AsNonBlocking()
+		.BoundToPort(0)
+		.Build();
+	if (Socket == nullptr)
+	{
+		return false;
+	}
+
+	Receiver = new FUdpSocketReceiver(Socket, FTimespan::FromMilliseconds(10), TEXT("MultiplayerSessionsSlotReserver"));
+	Receiver->OnDataReceived().BindRaw(this, &FMultiplayerSessionSlotReserver::HandleDataReceived);
+	Receiver->Start();
+
+	const FTCHARToUTF8 PlayerIdConverter(*InPlayerId);
+	PlayerIdUtf8.Reset();
+	if (PlayerIdConverter.Length() <= MultiplayerSessionPing::MaxReservationPlayerIdBytes)
+	{
+		PlayerIdUtf8.Append(reinterpret_cast<const uint8*>(PlayerIdConverter.Get()), PlayerIdConverter.Length());
+	}
+
+	HostEndpoint = InHostEndpoint;
+	bGranted = false;
+	Nonce = static_cast<uint32>(FMath::Rand()) ^ (static_cast<uint32>(FPlatformTime::Cycles()) << 1);
+	Ticket = static_cast<uint32>(FMath::Rand()) ^ (static_cast<uint32>(FPlatformTime::Cycles64() >> 7));
+	AttemptsSent = 0;
+	return SendRequest(FPlatformTime::Seconds());
+}
+
+void FMultiplayerSessionSlotReserver::Stop()
+{
+	MultiplayerSessionPing::DestroyUdpSocket(Socket, Receiver);
+	Replies.Empty();
+}
+
+void FMultiplayerSessionSlotReserver::Release()
+{
+	if (bGranted == false)
+	{
+		return;
+	}
+
+	bGranted = false;
+	FSocket* ReleaseSocket = FUdpSocketBuilder(TEXT("MultiplayerSessionsSlotRelease"))
+		.AsNonBlocking()
+		.BoundToPort(0)
+		.Build();
+	if (ReleaseSocket == nullptr)
+	{
+		return;
+	}
+
+	uint8 Packet[MultiplayerSessionPing::ReservationReleaseSize];
+	MultiplayerSessionPing::WriteUInt32(Packet, MultiplayerSessionPing::ReservationReleaseMagic);
+	MultiplayerSessionPing::WriteUInt32(Packet + 4, Nonce);
+	MultiplayerSessionPing::WriteUInt32(Packet + 8, Ticket);
+
+	int32 BytesSent = 0;
+	ReleaseSocket->SendTo(Packet, MultiplayerSessionPing::ReservationReleaseSize, BytesSent, *HostEndpoint.ToInternetAddr());
+
+	FUdpSocketReceiver* NoReceiver = nullptr;
+	MultiplayerSessionPing::DestroyUdpSocket(ReleaseSocket, NoReceiver);
+}
+
+MultiplayerSessionPing::EReservationResult FMultiplayerSessionSlotReserver::Tick(double CurrentSeconds)
+{
+	if (Socket == nullptr)
+	{
+		return MultiplayerSessionPing::EReservationResult::NoReply;
+	}
+
+	uint32 ReplyResult = 0;
+	while (Replies.Dequeue(ReplyResult) == true)
+	{
+		if (ReplyResult == static_cast<uint32>(MultiplayerSessionPing::EReservationResult::Granted) || ReplyResult == static_cast<uint32>(MultiplayerSessionPing::EReservationResult::Rejected))
+		{
+			bGranted = ReplyResult == static_cast<uint32>(MultiplayerSessionPing::EReservationResult::Granted);
+			Stop();
+			return static_cast<MultiplayerSessionPing::EReservationResult>(ReplyResult);
+		}
+	}
+
+	if (CurrentSeconds - LastSendSeconds < AttemptTimeoutSeconds)
+	{
+		return MultiplayerSessionPing::EReservationResult::None;
+	}
+
+	if (AttemptsSent >= Attempts || SendRequest(CurrentSeconds) == false)
+	{
+		Stop();
+		return MultiplayerSessionPing::EReservationResult::NoReply;
+	}
+
+	return MultiplayerSessionPing::EReservationResult::None;
+}
+
+bool FMultiplayerSessionSlotReserver::SendRequest(double CurrentSeconds)
+{
+	uint8 Packet[MultiplayerSessionPing::ReservationRequestHeaderSize + MultiplayerSessionPing::MaxReservationPlayerIdBytes];
+	MultiplayerSessionPing::WriteUInt32(Packet, MultiplayerSessionPing::ReservationRequestMagic);
+	MultiplayerSessionPing::WriteUInt32(Packet + 4, Nonce);
+	MultiplayerSessionPing::WriteUInt32(Packet + 8, Ticket);
+	Packet[12] = static_cast<uint8>(PlayerIdUtf8.Num() & 0xff);
+	Packet[13] = static_cast<uint8>((PlayerIdUtf8.Num() >> 8) & 0xff);
+	FMemory::Memcpy(Packet + MultiplayerSessionPing::ReservationRequestHeaderSize, PlayerIdUtf8.GetData(), PlayerIdUtf8.Num());
+	const int32 PacketSize = MultiplayerSessionPing::ReservationRequestHeaderSize + PlayerIdUtf8.Num();
+
+	AttemptsSent++;
+	LastSendSeconds = CurrentSeconds;
+
+	int32 BytesSent = 0;
+	return Socket->SendTo(Packet, PacketSize, BytesSent, *HostEndpoint.ToInternetAddr()) == true && BytesSent == PacketSize;
+}
+
+void FMultiplayerSessionSlotReserver::HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender)
+{
+	if (Data.IsValid() == false || Data->Num() != MultiplayerSessionPing::ReservationReplySize)
+	{
+		return;
+	}
+
+	const uint8* Packet = Data->GetData();
+	if (MultiplayerSessionPing::ReadUInt32(Packet) != MultiplayerSessionPing::ReservationReplyMagic || MultiplayerSessionPing::ReadUInt32(Packet + 4) != Nonce || MultiplayerSessionPing::ReadUInt32(Packet + 8) != Ticket)
+	{
+		return;
+	}
+
+	Replies.Enqueue(MultiplayerSessionPing::ReadUInt32(Packet + 12));
+}
+
+FMultiplayerSessionPingProber::FMultiplayerSessionPingProber(int32 InMaxProbesInFlight, int32 InAttemptsPerTarget, double InProbeTimeoutSeconds)
+	: MaxProbesInFlight(FMath::Max(1, InMaxProbesInFlight))
+	, AttemptsPerTarget(FMath::Max(1, InAttemptsPerTarget))
+	, ProbeTimeoutSeconds(FMath::Max(0.05, InProbeTimeoutSeconds))
+{
+}
+
+FMultiplayerSessionPingProber::~FMultiplayerSessionPingProber()
+{
+	Stop();
+}
+
+bool FMultiplayerSessionPingProber::Start(TArray<FTarget>&& Targets)
+{
+	Stop();
+
+	if (Targets.Num() == 0)
+	{
+		return false;
+	}
+
+	Nonce = static_cast<uint32>(FMath::Rand()) ^ (static_cast<uint32>(FPlatformTime::Cycles()) << 1);
+	if (OpenSocket() == false)
+	{
+		return false;
+	}
+
+	TargetStates.Reserve(Targets.Num());
+	for (FTarget& Target : Targets)
+	{
+		FTargetState& TargetState = TargetStates.AddDefaulted_GetRef();
+		TargetState.Target = MoveTemp(Target);
+	}
+
+	return true;
+}
+
+void FMultiplayerSessionPingProber::Stop()
+{
+	CloseSocket();
+	Replies.Empty();
+	TargetStates.Reset();
+	PendingProbes.Reset();
+	NextTargetIndex = 0;
+}
+
+bool FMultiplayerSessionPingProber::Tick(double CurrentSeconds, TArray<FMeasurement>& OutMeasurements)
+{
+	if (IsActive() == false)
+	{
+		return false;
+	}
+
+	FReply Reply;
+	while (Replies.Dequeue(Reply) == true)
+	{
+		FPendingProbe PendingProbe;
+		if (PendingProbes.RemoveAndCopyValue(Reply.Sequence, PendingProbe) == false)
+		{
+			continue;
+		}
+
+		FTargetState& TargetState = TargetStates[PendingProbe.TargetIndex];
+		const int32 PingInMs = FMath::Max(0, FMath::RoundToInt((Reply.ReceiveSeconds - PendingProbe.SendSeconds) * 1000.0));
+		if (TargetState.BestPingInMs < 0 || PingInMs < TargetState.BestPingInMs)
+		{
+			TargetState.BestPingInMs = PingInMs;
+
+			FMeasurement& Measurement = OutMeasurements.AddDefaulted_GetRef();
+			Measurement.EntryId = TargetState.Target.EntryId;
+			Measurement.PingInMs = PingInMs;
+		}
+
+		FinishProbe(PendingProbe.TargetIndex);
+	}
+
+	for (TMap<uint32, FPendingProbe>::TIterator It = PendingProbes.CreateIterator(); It; ++It)
+	{
+		if (CurrentSeconds - It.Value().SendSeconds >= ProbeTimeoutSeconds)
+		{
+			FinishProbe(It.Value().TargetIndex);
+			It.RemoveCurrent();
+		}
+	}
+
+	SendNextProbes();
+
+	if (PendingProbes.Num() > 0)
+	{
+		return true;
+	}
+
+	for (const FTargetState& TargetState : TargetStates)
+	{
+		if (TargetState.AttemptsFinished < AttemptsPerTarget)
+		{
+			return true;
+		}
+	}
+
+	Stop();
+	return false;
+}
+
+bool FMultiplayerSessionPingProber::OpenSocket()
+{
+	Socket = FUdpSocketBuilder(TEXT("MultiplayerSessionsPingProber"))
+		.AsNonBlocking()
+		.BoundToPort(0)
+		.Build();
+	if (Socket == nullptr)
+	{
+		return false;
+	}
+
+	Receiver = new FUdpSocketReceiver(Socket, FTimespan::FromMilliseconds(10), TEXT("MultiplayerSessionsPingProber"));
+	Receiver->OnDataReceived().BindRaw(this, &FMultiplayerSessionPingProber::HandleDataReceived);
+	Receiver->Start();
+	return true;
+}
+
+void FMultiplayerSessionPingProber::CloseSocket()
+{
+	MultiplayerSessionPing::DestroyUdpSocket(Socket, Receiver);
+}
+
+void FMultiplayerSessionPingProber::SendNextProbes()
+{
+	if (Socket == nullptr)
+	{
+		return;
+	}
+
+	uint8 Packet[MultiplayerSessionPing::PacketSize];
+	for (int32 Scanned = 0; Scanned < TargetStates.Num() && PendingProbes.Num() < MaxProbesInFlight; Scanned++)
+	{
+		const int32 TargetIndex = NextTargetIndex;
+		NextTargetIndex = (NextTargetIndex + 1) % TargetStates.Num();
+
+		FTargetState& TargetState = TargetStates[TargetIndex];
+		if (TargetState.bProbeInFlight == true || TargetState.AttemptsSent >= AttemptsPerTarget)
+		{
+			continue;
+		}
+
+		const uint32 Sequence = NextSequence++;
+		MultiplayerSessionPing::WriteUInt32(Packet, MultiplayerSessionPing::PacketMagic);
+		MultiplayerSessionPing::WriteUInt32(Packet + 4, Nonce);
+		MultiplayerSessionPing::WriteUInt32(Packet + 8, Sequence);
+
+		TargetState.AttemptsSent++;
+
+		int32 BytesSent = 0;
+		const double SendSeconds = FPlatformTime::Seconds();
+		if (Socket->SendTo(Packet, MultiplayerSessionPing::PacketSize, BytesSent, *TargetState.Target.Endpoint.ToInternetAddr()) == false || BytesSent != MultiplayerSessionPing::PacketSize)
+		{
+			TargetState.AttemptsFinished++;
+			continue;
+		}
+
+		TargetState.bProbeInFlight = true;
+		FPendingProbe& PendingProbe = PendingProbes.Add(Sequence);
+		PendingProbe.TargetIndex = TargetIndex;
+		PendingProbe.SendSeconds = SendSeconds;
+	}
+}
+
+void FMultiplayerSessionPingProber::FinishProbe(int32 TargetIndex)
+{
+	FTargetState& TargetState = TargetStates[TargetIndex];
+	TargetState.bProbeInFlight = false;
+	TargetState.AttemptsFinished++;
+}
+
+void FMultiplayerSessionPingProber::HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender)
+{
+	const double ReceiveSeconds = FPlatformTime::Seconds();
+	if (Data.IsValid() == false || Data->Num() != MultiplayerSessionPing::PacketSize)
+	{
+		return;
+	}
+
+	const uint8* Packet = Data->GetData();
+	if (MultiplayerSessionPing::ReadUInt32(Packet) != MultiplayerSessionPing::PacketMagic || MultiplayerSessionPing::ReadUInt32(Packet + 4) != Nonce)
+	{
+		return;
+	}
+
+	FReply Reply;
+	Reply.Sequence = MultiplayerSessionPing::ReadUInt32(Packet + 8);
+	Reply.ReceiveSeconds = ReceiveSeconds;
+	Replies.Enqueue(Reply);
+}
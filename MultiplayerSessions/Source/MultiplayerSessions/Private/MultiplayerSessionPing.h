@@ -0,0 +1,212 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "HAL/CriticalSection.h"
+#include "Serialization/ArrayReader.h"
+
+class FSocket;
+class FUdpSocketReceiver;
+class IOnlineSession;
+class FOnlineSessionSearchResult;
+
+namespace MultiplayerSessionPing
+{
+	inline constexpr uint32 PacketMagic = 0x4D535047;
+	inline constexpr int32 PacketSize = 12;
+	inline constexpr uint32 ReservationRequestMagic = 0x4D535251;
+	inline constexpr uint32 ReservationReplyMagic = 0x4D535252;
+	inline constexpr uint32 ReservationReleaseMagic = 0x4D53524C;
+	inline constexpr int32 ReservationRequestHeaderSize = 14;
+	inline constexpr int32 MaxReservationPlayerIdBytes = 256;
+	inline constexpr int32 ReservationReleaseSize = 12;
+	inline constexpr int32 ReservationReplySize = 16;
+
+	enum class EReservationResult : uint8
+	{
+		None,
+		Granted,
+		Rejected,
+		NoReply
+	};
+
+	bool ResolveProbeEndpoint(IOnlineSession& SessionInterface, const FOnlineSessionSearchResult& SearchResult, FIPv4Endpoint& OutEndpoint);
+	void WriteUInt32(uint8* Buffer, uint32 Value);
+	uint32 ReadUInt32(const uint8* Buffer);
+	void DestroyUdpSocket(FSocket*& Socket, FUdpSocketReceiver*& Receiver);
+}
+
+class FMultiplayerSessionPingResponder
+{
+public:
+	~FMultiplayerSessionPingResponder();
+
+	bool Start(int32 Port);
+	void Stop();
+
+	bool IsRunning() const
+	{
+		return Socket != nullptr;
+	}
+
+	int32 GetPort() const
+	{
+		return BoundPort;
+	}
+
+	void ConfigureReservations(bool bEnabled, double InReservationSeconds, int32 InMaxReservationsPerAddress);
+	void SetOpenSlots(int32 InOpenSlots);
+	bool ConsumeReservation(const FString& PlayerId);
+	void ClearReservations();
+	int32 GetReservedSlotCount(double CurrentSeconds);
+	uint32 GetReservationRequestCount();
+
+private:
+	void HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender);
+	void HandleReservationRequest(const uint8* Request, int32 RequestSize, const FIPv4Endpoint& Sender);
+	void HandleReservationRelease(const uint8* Request, const FIPv4Endpoint& Sender);
+	void PurgeExpiredReservations(double CurrentSeconds);
+	bool ConsumeReplyBudget(const FIPv4Endpoint& Sender, double CurrentSeconds);
+
+private:
+	struct FReplyBucket
+	{
+		double Tokens = 0.0;
+		double LastRefillSeconds = 0.0;
+	};
+
+	struct FReservation
+	{
+		uint32 Address = 0;
+		uint32 Ticket = 0;
+		FString PlayerId;
+		double ExpirySeconds = 0.0;
+	};
+
+	FSocket* Socket = nullptr;
+	FUdpSocketReceiver* Receiver = nullptr;
+	int32 BoundPort = 0;
+
+	TMap<uint64, FReplyBucket> ReplyBucketsBySender;
+	double ReplyTokens = 0.0;
+	double LastReplyRefillSeconds = 0.0;
+
+	FCriticalSection ReservationLock;
+	TArray<FReservation> Reservations;
+	int32 OpenSlots = 0;
+	int32 MaxReservationsPerAddress = 4;
+	uint32 ReservationRequestCount = 0;
+	double ReservationSeconds = 30.0;
+	bool bReservationsEnabled = false;
+};
+
+class FMultiplayerSessionSlotReserver
+{
+public:
+	FMultiplayerSessionSlotReserver(int32 InAttempts, double InAttemptTimeoutSeconds);
+	~FMultiplayerSessionSlotReserver();
+
+	bool Start(const FIPv4Endpoint& InHostEndpoint, const FString& InPlayerId);
+	void Stop();
+	void Release();
+	MultiplayerSessionPing::EReservationResult Tick(double CurrentSeconds);
+
+private:
+	bool SendRequest(double CurrentSeconds);
+	void HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender);
+
+private:
+	FSocket* Socket = nullptr;
+	FUdpSocketReceiver* Receiver = nullptr;
+	TQueue<uint32, EQueueMode::Spsc> Replies;
+
+	FIPv4Endpoint HostEndpoint;
+	TArray<uint8> PlayerIdUtf8;
+	uint32 Nonce = 0;
+	uint32 Ticket = 0;
+	int32 AttemptsSent = 0;
+	double LastSendSeconds = 0.0;
+	bool bGranted = false;
+
+	int32 Attempts = 3;
+	double AttemptTimeoutSeconds = 0.5;
+};
+
+class FMultiplayerSessionPingProber
+{
+public:
+	struct FTarget
+	{
+		FString EntryId;
+		FIPv4Endpoint Endpoint;
+	};
+
+	struct FMeasurement
+	{
+		FString EntryId;
+		int32 PingInMs = -1;
+	};
+
+	FMultiplayerSessionPingProber(int32 InMaxProbesInFlight, int32 InAttemptsPerTarget, double InProbeTimeoutSeconds);
+	~FMultiplayerSessionPingProber();
+
+	bool Start(TArray<FTarget>&& Targets);
+	void Stop();
+	bool Tick(double CurrentSeconds, TArray<FMeasurement>& OutMeasurements);
+
+	bool IsActive() const
+	{
+		return TargetStates.Num() > 0;
+	}
+
+	int32 GetProbesInFlight() const
+	{
+		return PendingProbes.Num();
+	}
+
+private:
+	struct FTargetState
+	{
+		FTarget Target;
+		int32 AttemptsSent = 0;
+		int32 AttemptsFinished = 0;
+		int32 BestPingInMs = -1;
+		bool bProbeInFlight = false;
+	};
+
+	struct FPendingProbe
+	{
+		int32 TargetIndex = INDEX_NONE;
+		double SendSeconds = 0.0;
+	};
+
+	struct FReply
+	{
+		uint32 Sequence = 0;
+		double ReceiveSeconds = 0.0;
+	};
+
+	bool OpenSocket();
+	void CloseSocket();
+	void SendNextProbes();
+	void FinishProbe(int32 TargetIndex);
+	void HandleDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender);
+
+private:
+	FSocket* Socket = nullptr;
+	FUdpSocketReceiver* Receiver = nullptr;
+	TQueue<FReply, EQueueMode::Spsc> Replies;
+
+	TArray<FTargetState> TargetStates;
+	TMap<uint32, FPendingProbe> PendingProbes;
+	int32 NextTargetIndex = 0;
+	uint32 NextSequence = 1;
+	uint32 Nonce = 0;
+
+	int32 MaxProbesInFlight = 4;
+	int32 AttemptsPerTarget = 3;
+	double ProbeTimeoutSeconds = 1.0;
+};
@@ -0,0 +1,184 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionPing.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr int32 TestResponderPort = 47798;
+	constexpr double TestWaitSeconds = 1.0;
+	constexpr double TestReservationSeconds = 1.0;
+	constexpr double TestProbeTimeoutSeconds = 0.2;
+
+	MultiplayerSessionPing::EReservationResult RunReserver(FMultiplayerSessionSlotReserver& Reserver, const FString& PlayerId)
+	{
+		if (Reserver.Start(FIPv4Endpoint(FIPv4Address::InternalLoopback, TestResponderPort), PlayerId) == false)
+		{
+			return MultiplayerSessionPing::EReservationResult::NoReply;
+		}
+
+		const double EndSeconds = FPlatformTime::Seconds() + TestWaitSeconds;
+		while (FPlatformTime::Seconds() < EndSeconds)
+		{
+			const MultiplayerSessionPing::EReservationResult Result = Reserver.Tick(FPlatformTime::Seconds());
+			if (Result != MultiplayerSessionPing::EReservationResult::None)
+			{
+				return Result;
+			}
+
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		return MultiplayerSessionPing::EReservationResult::None;
+	}
+
+	int32 RunProber(FMultiplayerSessionPingProber& Prober, TArray<FMultiplayerSessionPingProber::FMeasurement>& OutMeasurements)
+	{
+		int32 MaxProbesInFlight = 0;
+		const double EndSeconds = FPlatformTime::Seconds() + TestWaitSeconds;
+		while (Prober.Tick(FPlatformTime::Seconds(), OutMeasurements) == true && FPlatformTime::Seconds() < EndSeconds)
+		{
+			MaxProbesInFlight = FMath::Max(MaxProbesInFlight, Prober.GetProbesInFlight());
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		return MaxProbesInFlight;
+	}
+
+	FMultiplayerSessionPingProber::FTarget MakeTarget(const FString& EntryId, int32 Port)
+	{
+		FMultiplayerSessionPingProber::FTarget Target;
+		Target.EntryId = EntryId;
+		Target.Endpoint = FIPv4Endpoint(FIPv4Address::InternalLoopback, Port);
+		return Target;
+	}
+
+	bool WaitForReservedSlotCount(FMultiplayerSessionPingResponder& Responder, int32 ExpectedCount, double WaitSeconds)
+	{
+		const double EndSeconds = FPlatformTime::Seconds() + WaitSeconds;
+		while (Responder.GetReservedSlotCount(FPlatformTime::Seconds()) != ExpectedCount)
+		{
+			if (FPlatformTime::Seconds() >= EndSeconds)
+			{
+				return false;
+			}
+
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionSlotReservationTest, "MultiplayerSessions.Ping.SlotReservation", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMultiplayerSessionSlotReservationTest::RunTest(const FString& Parameters)
+{
+	FMultiplayerSessionPingResponder Responder;
+	if (TestTrue(TEXT("Responder binds its port"), Responder.Start(TestResponderPort)) == false)
+	{
+		return false;
+	}
+
+	Responder.ConfigureReservations(true, TestReservationSeconds, 4);
+	Responder.SetOpenSlots(1);
+
+	FMultiplayerSessionSlotReserver FirstReserver(3, 0.2);
+	TestTrue(TEXT("Open slot is granted"), RunReserver(FirstReserver, TEXT("FirstPlayer")) == MultiplayerSessionPing::EReservationResult::Granted);
+	TestEqual(TEXT("Granted slot is reserved"), Responder.GetReservedSlotCount(FPlatformTime::Seconds()), 1);
+
+	FMultiplayerSessionSlotReserver SecondReserver(3, 0.2);
+	TestTrue(TEXT("Request is rejected when full"), RunReserver(SecondReserver, TEXT("SecondPlayer")) == MultiplayerSessionPing::EReservationResult::Rejected);
+
+	FMultiplayerSessionSlotReserver RepeatReserver(3, 0.2);
+	TestTrue(TEXT("Held net id is answered as granted"), RunReserver(RepeatReserver, TEXT("FirstPlayer")) == MultiplayerSessionPing::EReservationResult::Granted);
+	TestEqual(TEXT("Held net id takes no second slot"), Responder.GetReservedSlotCount(FPlatformTime::Seconds()), 1);
+
+	FMultiplayerSessionSlotReserver AnonymousReserver(1, 0.2);
+	TestTrue(TEXT("Request without a net id is ignored"), RunReserver(AnonymousReserver, FString()) == MultiplayerSessionPing::EReservationResult::NoReply);
+
+	TestFalse(TEXT("Other player cannot consume the reservation"), Responder.ConsumeReservation(TEXT("SecondPlayer")));
+	TestFalse(TEXT("Player without a net id cannot consume the reservation"), Responder.ConsumeReservation(FString()));
+
+	FirstReserver.Release();
+	TestTrue(TEXT("Released slot is freed"), WaitForReservedSlotCount(Responder, 0, TestWaitSeconds));
+
+	FMultiplayerSessionSlotReserver ExpiringReserver(3, 0.2);
+	TestTrue(TEXT("Freed slot is granted again"), RunReserver(ExpiringReserver, TEXT("SecondPlayer")) == MultiplayerSessionPing::EReservationResult::Granted);
+	TestTrue(TEXT("Unused slot expires"), WaitForReservedSlotCount(Responder, 0, TestReservationSeconds + TestWaitSeconds));
+	TestFalse(TEXT("Expired reservation cannot be consumed"), Responder.ConsumeReservation(TEXT("SecondPlayer")));
+
+	FMultiplayerSessionSlotReserver ConsumedReserver(3, 0.2);
+	TestTrue(TEXT("Expired slot is granted again"), RunReserver(ConsumedReserver, TEXT("FirstPlayer")) == MultiplayerSessionPing::EReservationResult::Granted);
+	TestTrue(TEXT("Own reservation is consumed at login"), Responder.ConsumeReservation(TEXT("FirstPlayer")));
+	TestEqual(TEXT("Consumed slot is freed"), Responder.GetReservedSlotCount(FPlatformTime::Seconds()), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionPingRoundTripTest, "MultiplayerSessions.Ping.RoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMultiplayerSessionPingRoundTripTest::RunTest(const FString& Parameters)
+{
+	FMultiplayerSessionPingResponder Responder;
+	if (TestTrue(TEXT("Responder binds its port"), Responder.Start(TestResponderPort)) == false)
+	{
+		return false;
+	}
+
+	constexpr int32 TargetCount = 4;
+	constexpr int32 MaxProbesInFlight = 2;
+	TArray<FMultiplayerSessionPingProber::FTarget> Targets;
+	for (int32 TargetIndex = 0; TargetIndex < TargetCount; TargetIndex++)
+	{
+		Targets.Add(MakeTarget(FString::Printf(TEXT("Host%d"), TargetIndex), TestResponderPort));
+	}
+
+	FMultiplayerSessionPingProber Prober(MaxProbesInFlight, 2, TestProbeTimeoutSeconds);
+	if (TestTrue(TEXT("Prober opens its socket"), Prober.Start(MoveTemp(Targets))) == false)
+	{
+		return false;
+	}
+
+	TArray<FMultiplayerSessionPingProber::FMeasurement> Measurements;
+	const int32 ObservedProbesInFlight = RunProber(Prober, Measurements);
+	TestFalse(TEXT("Prober finishes"), Prober.IsActive());
+	TestTrue(TEXT("Probes were sent"), ObservedProbesInFlight > 0);
+	TestTrue(TEXT("In-flight cap is respected"), ObservedProbesInFlight <= MaxProbesInFlight);
+
+	for (int32 TargetIndex = 0; TargetIndex < TargetCount; TargetIndex++)
+	{
+		const FString EntryId = FString::Printf(TEXT("Host%d"), TargetIndex);
+		const FMultiplayerSessionPingProber::FMeasurement* Measurement = Measurements.FindByPredicate([&EntryId](const FMultiplayerSessionPingProber::FMeasurement& Entry) { return Entry.EntryId == EntryId; });
+		if (TestNotNull(*FString::Printf(TEXT("%s answered over loopback"), *EntryId), Measurement) == true)
+		{
+			TestTrue(*FString::Printf(TEXT("%s round trip is not negative"), *EntryId), Measurement->PingInMs >= 0);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionPingTimeoutTest, "MultiplayerSessions.Ping.Timeout", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMultiplayerSessionPingTimeoutTest::RunTest(const FString& Parameters)
+{
+	TArray<FMultiplayerSessionPingProber::FTarget> Targets;
+	Targets.Add(MakeTarget(TEXT("UnboundHost"), TestResponderPort + 1));
+
+	FMultiplayerSessionPingProber Prober(1, 2, TestProbeTimeoutSeconds);
+	if (TestTrue(TEXT("Prober opens its socket"), Prober.Start(MoveTemp(Targets))) == false)
+	{
+		return false;
+	}
+
+	TArray<FMultiplayerSessionPingProber::FMeasurement> Measurements;
+	RunProber(Prober, Measurements);
+	TestFalse(TEXT("Unanswered probes time out"), Prober.IsActive());
+	TestEqual(TEXT("Unbound port is not measured"), Measurements.Num(), 0);
+	return true;
+}
+
+#endif
@@ -69,19 +69,10 @@ void UMultiplayerSessionRowWidget::RefreshFromListItem()
 		return;
 	}
 
-	const FMultiplayerSessionBrowserEntry& BrowserEntry = CurrentListItem->GetBrowserEntry();
-	HostValueText->SetText(FText::FromString(BrowserEntry.HostDisplayName));
-	StatusValueText->SetText(FText::FromString(BrowserEntry.StatusText));
-	FreeSlotsValueText->SetText(FText::AsNumber(FMath::Max(0, BrowserEntry.OpenPublicConnections)));
-
-	if (BrowserEntry.PingInMs >= 0)
-	{
-		PingValueText->SetText(FText::Format(NSLOCTEXT("MultiplayerSessions", "PingFormat", "{0} ms"), FText::AsNumber(BrowserEntry.PingInMs)));
-	}
-	else
-	{
-		PingValueText->SetText(NSLOCTEXT("MultiplayerSessions", "UnknownPing", "--"));
-	}
+	HostValueText->SetText(CurrentListItem->GetHostText());
+	StatusValueText->SetText(CurrentListItem->GetStatusText());
+	FreeSlotsValueText->SetText(CurrentListItem->GetFreeSlotsText());
+	PingValueText->SetText(CurrentListItem->GetPingText());
 }
 
 void UMultiplayerSessionRowWidget::SetSelectedVisual(bool bInSelected)
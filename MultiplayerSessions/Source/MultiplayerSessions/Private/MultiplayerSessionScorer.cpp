@@ -0,0 +1,10 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionScorer.h"
+
+#include "MultiplayerSessionsSubsystem.h"
+
+float UMultiplayerSessionWeightedScorer::ScoreSessionEntry_Implementation(const FMultiplayerSessionBrowserEntry& BrowserEntry, const FMultiplayerSessionScoringWeights& ScoringWeights) const
+{
+	return UMultiplayerSessionsSubsystem::ScoreBrowserEntry(BrowserEntry, ScoringWeights);
+}
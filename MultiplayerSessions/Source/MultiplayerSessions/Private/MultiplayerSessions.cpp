@@ -2,11 +2,49 @@
 
 #include "MultiplayerSessions.h"
 
+#include "MultiplayerSessionsBenchmark.h"
+#include "MultiplayerSessionsStats.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+DEFINE_STAT(STAT_MultiplayerSessions_FilterResults);
+DEFINE_STAT(STAT_MultiplayerSessions_BuildEntries);
+DEFINE_STAT(STAT_MultiplayerSessions_SortEntries);
+DEFINE_STAT(STAT_MultiplayerSessions_ListRebuild);
+DEFINE_STAT(STAT_MultiplayerSessions_SearchesIssued);
+DEFINE_STAT(STAT_MultiplayerSessions_RawResults);
+DEFINE_STAT(STAT_MultiplayerSessions_ResultsDropped);
+DEFINE_STAT(STAT_MultiplayerSessions_EntriesBuilt);
+DEFINE_STAT(STAT_MultiplayerSessions_BlockedIncompatibleBuild);
+DEFINE_STAT(STAT_MultiplayerSessions_BlockedIncompatibleSchema);
+DEFINE_STAT(STAT_MultiplayerSessions_BlockedStatusUnavailable);
+DEFINE_STAT(STAT_MultiplayerSessions_BlockedMatchStarting);
+DEFINE_STAT(STAT_MultiplayerSessions_BlockedSessionFull);
+DEFINE_STAT(STAT_MultiplayerSessions_BlockedJoinInProgressDisabled);
+DEFINE_STAT(STAT_MultiplayerSessions_BroadcastsPerSecond);
+DEFINE_STAT(STAT_MultiplayerSessions_CachedBytes);
+DEFINE_STAT(STAT_MultiplayerSessions_BootToAdvertisedSeconds);
+DEFINE_STAT(STAT_MultiplayerSessions_JoinsDelayed);
+DEFINE_STAT(STAT_MultiplayerSessions_JoinAdmissionDelaySeconds);
+DEFINE_STAT(STAT_MultiplayerSessions_HostJoinAttemptsPerSecond);
+DEFINE_STAT(STAT_MultiplayerSessions_HostBusyRaised);
+DEFINE_STAT(STAT_MultiplayerSessions_LanBeaconsReceived);
+DEFINE_STAT(STAT_MultiplayerSessions_LanDuplicateBeacons);
+DEFINE_STAT(STAT_MultiplayerSessions_LanFirstResultMs);
+DEFINE_STAT(STAT_MultiplayerSessions_LanRepliesSent);
+DEFINE_STAT(STAT_MultiplayerSessions_LanQueriesDropped);
+
 #define LOCTEXT_NAMESPACE "FMultiplayerSessionsModule"
 
 void FMultiplayerSessionsModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+#if !UE_BUILD_SHIPPING
+	if (FParse::Param(FCommandLine::Get(), MultiplayerSessionsBenchmark::CountAllocationsParam) == true)
+	{
+		MultiplayerSessionsBenchmark::InstallBenchmarkCountingMalloc();
+	}
+#endif
 }
 
 void FMultiplayerSessionsModule::ShutdownModule()
@@ -0,0 +1,211 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/OutputDevice.h"
+#include <atomic>
+
+#if !UE_BUILD_SHIPPING
+
+namespace MultiplayerSessionsBenchmark
+{
+	class FBenchmarkCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FBenchmarkCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		void BeginCounting()
+		{
+			Reset();
+			CountingThreadId.store(FPlatformTLS::GetCurrentThreadId(), std::memory_order_release);
+		}
+
+		void EndCounting()
+		{
+			CountingThreadId.store(0, std::memory_order_release);
+		}
+
+		void Reset()
+		{
+			AllocationCount = 0;
+			AllocatedBytes = 0;
+			LiveBytes = 0;
+			PeakLiveBytes = 0;
+		}
+
+		int64 GetAllocationCount() const
+		{
+			return AllocationCount;
+		}
+
+		int64 GetAllocatedBytes() const
+		{
+			return AllocatedBytes;
+		}
+
+		int64 GetPeakLiveBytes() const
+		{
+			return PeakLiveBytes;
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			void* Result = InnerMalloc->Malloc(Count, Alignment);
+			TrackAllocation(Result);
+			return Result;
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			TrackFree(Original);
+			void* Result = InnerMalloc->Realloc(Original, Count, Alignment);
+			TrackAllocation(Result);
+			return Result;
+		}
+
+		virtual void Free(void* Original) override
+		{
+			TrackFree(Original);
+			InnerMalloc->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return InnerMalloc->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return InnerMalloc->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			InnerMalloc->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+		{
+			InnerMalloc->GetAllocatorStats(OutStats);
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return InnerMalloc->IsInternallyThreadSafe();
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return InnerMalloc->ValidateHeap();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return InnerMalloc->GetDescriptiveName();
+		}
+
+	private:
+		bool IsCountingThread() const
+		{
+			const uint32 ThreadId = CountingThreadId.load(std::memory_order_acquire);
+			return ThreadId != 0 && ThreadId == FPlatformTLS::GetCurrentThreadId();
+		}
+
+		void TrackAllocation(void* Result)
+		{
+			if (Result == nullptr || IsCountingThread() == false)
+			{
+				return;
+			}
+
+			SIZE_T Size = 0;
+			InnerMalloc->GetAllocationSize(Result, Size);
+			AllocationCount++;
+			AllocatedBytes += static_cast<int64>(Size);
+			LiveBytes += static_cast<int64>(Size);
+			PeakLiveBytes = FMath::Max(PeakLiveBytes, LiveBytes);
+		}
+
+		void TrackFree(void* Original)
+		{
+			if (Original == nullptr || IsCountingThread() == false)
+			{
+				return;
+			}
+
+			SIZE_T Size = 0;
+			if (InnerMalloc->GetAllocationSize(Original, Size) == true)
+			{
+				LiveBytes -= static_cast<int64>(Size);
+			}
+		}
+
+	private:
+		FMalloc* InnerMalloc = nullptr;
+		std::atomic<uint32> CountingThreadId = 0;
+		int64 AllocationCount = 0;
+		int64 AllocatedBytes = 0;
+		int64 LiveBytes = 0;
+		int64 PeakLiveBytes = 0;
+	};
+
+	inline const TCHAR* CountAllocationsParam = TEXT("MultiplayerSessionsCountAllocs");
+
+	void InstallBenchmarkCountingMalloc();
+	FBenchmarkCountingMalloc* GetBenchmarkCountingMalloc();
+
+	class FBenchmarkStageTimer
+	{
+	public:
+		FBenchmarkStageTimer(const TCHAR* InStageName, int32 InResultCount, FOutputDevice& InAr)
+			: StageName(InStageName)
+			, ResultCount(InResultCount)
+			, Ar(InAr)
+			, CountingMalloc(GetBenchmarkCountingMalloc())
+		{
+			if (CountingMalloc != nullptr)
+			{
+				CountingMalloc->BeginCounting();
+			}
+
+			StartSeconds = FPlatformTime::Seconds();
+		}
+
+		~FBenchmarkStageTimer()
+		{
+			const double ElapsedMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+			if (CountingMalloc == nullptr)
+			{
+				Ar.Logf(TEXT("%8d %-10s %12.3f %12s %14s %14s"), ResultCount, StageName, ElapsedMilliseconds, TEXT("n/a"), TEXT("n/a"), TEXT("n/a"));
+				return;
+			}
+
+			CountingMalloc->EndCounting();
+			Ar.Logf(TEXT("%8d %-10s %12.3f %12lld %14lld %14lld"), ResultCount, StageName, ElapsedMilliseconds, CountingMalloc->GetAllocationCount(), CountingMalloc->GetAllocatedBytes(), CountingMalloc->GetPeakLiveBytes());
+		}
+
+	private:
+		const TCHAR* StageName = nullptr;
+		int32 ResultCount = 0;
+		FOutputDevice& Ar;
+		FBenchmarkCountingMalloc* CountingMalloc = nullptr;
+		double StartSeconds = 0.0;
+	};
+}
+
+#endif
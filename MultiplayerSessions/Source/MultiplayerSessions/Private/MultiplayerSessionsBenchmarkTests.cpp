@@ -0,0 +1,141 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+#include "MultiplayerEntryWidget.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/OutputDevice.h"
+#include "Slate/WidgetRenderer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const TCHAR* EntryWidgetClassPath = TEXT("/MultiplayerSessions/WBP_OnlineEntry.WBP_OnlineEntry_C");
+	const FVector2D WidgetBenchmarkDrawSize(1920.0, 1080.0);
+
+	class FBenchmarkTestOutput final : public FOutputDevice
+	{
+	public:
+		explicit FBenchmarkTestOutput(FAutomationTestBase& InTest)
+			: Test(InTest)
+		{
+		}
+
+		virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+		{
+			Test.AddInfo(V);
+		}
+
+	private:
+		FAutomationTestBase& Test;
+	};
+
+	class FScopedBenchmarkGameInstance
+	{
+	public:
+		FScopedBenchmarkGameInstance()
+		{
+			GameInstance = NewObject<UGameInstance>(GEngine);
+			GameInstance->AddToRoot();
+			GameInstance->InitializeStandalone();
+		}
+
+		~FScopedBenchmarkGameInstance()
+		{
+			UWorld* World = GameInstance->GetWorld();
+			GameInstance->Shutdown();
+			if (World != nullptr)
+			{
+				GEngine->DestroyWorldContext(World);
+				World->DestroyWorld(false);
+			}
+
+			GameInstance->RemoveFromRoot();
+		}
+
+		UMultiplayerSessionsSubsystem* GetSubsystem() const
+		{
+			return GameInstance->GetSubsystem<UMultiplayerSessionsSubsystem>();
+		}
+
+		UWorld* GetWorld() const
+		{
+			return GameInstance->GetWorld();
+		}
+
+	private:
+		UGameInstance* GameInstance = nullptr;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionsSearchBenchmarkTest, "MultiplayerSessions.Perf.SearchPipeline", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FMultiplayerSessionsSearchBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FScopedBenchmarkGameInstance GameInstance;
+	UMultiplayerSessionsSubsystem* Subsystem = GameInstance.GetSubsystem();
+	if (TestNotNull(TEXT("Subsystem is created"), Subsystem) == false)
+	{
+		return false;
+	}
+
+	FBenchmarkTestOutput Output(*this);
+	for (const int32 ResultCount : { 100, 1000, 10000, 100000 })
+	{
+		if (TestTrue(*FString::Printf(TEXT("Benchmark runs %d results"), ResultCount), Subsystem->RunSearchBenchmark(ResultCount, Output)) == false)
+		{
+			return false;
+		}
+
+		TestTrue(*FString::Printf(TEXT("%d results are published to the browser"), ResultCount), Subsystem->GetCachedBrowserEntries().Num() > 0);
+		TestFalse(*FString::Printf(TEXT("Subsystem is idle after %d results"), ResultCount), Subsystem->IsBusy());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiplayerSessionsWidgetBenchmarkTest, "MultiplayerSessions.Perf.WidgetList", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FMultiplayerSessionsWidgetBenchmarkTest::RunTest(const FString& Parameters)
+{
+	if (FSlateApplication::IsInitialized() == false)
+	{
+		AddInfo(TEXT("Widget benchmark needs Slate. Skipped."));
+		return true;
+	}
+
+	UClass* EntryWidgetClass = LoadClass<UMultiplayerEntryWidget>(nullptr, EntryWidgetClassPath);
+	if (TestNotNull(TEXT("Entry widget class loads"), EntryWidgetClass) == false)
+	{
+		return false;
+	}
+
+	FScopedBenchmarkGameInstance GameInstance;
+	UMultiplayerEntryWidget* EntryWidget = CreateWidget<UMultiplayerEntryWidget>(GameInstance.GetWorld(), EntryWidgetClass);
+	if (TestNotNull(TEXT("Entry widget is created"), EntryWidget) == false)
+	{
+		return false;
+	}
+
+	FWidgetRenderer WidgetRenderer(false);
+	UTextureRenderTarget2D* RenderTarget = FWidgetRenderer::CreateTargetFor(WidgetBenchmarkDrawSize, TF_Bilinear, false);
+	RenderTarget->AddToRoot();
+	WidgetRenderer.DrawWidget(RenderTarget, EntryWidget->TakeWidget(), WidgetBenchmarkDrawSize, 0.0f);
+
+	FBenchmarkTestOutput Output(*this);
+	for (const int32 EntryCount : { 100, 1000, 10000 })
+	{
+		TestTrue(*FString::Printf(TEXT("Benchmark runs %d entries"), EntryCount), EntryWidget->RunRenderBenchmark(EntryCount, Output));
+	}
+
+	RenderTarget->RemoveFromRoot();
+	EntryWidget->RemoveFromParent();
+	return true;
+}
+
+#endif
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsDiagnostics.h"
+
+void FMultiplayerSessionLatencyHistogram::AddSample(double Milliseconds)
+{
+	Milliseconds = FMath::Max(0.0, Milliseconds);
+	BucketCounts[GetBucketIndex(Milliseconds)]++;
+
+	if (SampleCount == 0 || Milliseconds < MinMilliseconds)
+	{
+		MinMilliseconds = Milliseconds;
+	}
+
+	MaxMilliseconds = FMath::Max(MaxMilliseconds, Milliseconds);
+	TotalMilliseconds += Milliseconds;
+	SampleCount++;
+}
+
+void FMultiplayerSessionLatencyHistogram::Reset()
+{
+	FMemory::Memzero(BucketCounts, sizeof(BucketCounts));
+	SampleCount = 0;
+	MinMilliseconds = 0.0;
+	MaxMilliseconds = 0.0;
+	TotalMilliseconds = 0.0;
+}
+
+double FMultiplayerSessionLatencyHistogram::GetPercentile(double Percentile) const
+{
+	if (SampleCount == 0)
+	{
+		return 0.0;
+	}
+
+	const uint32 TargetRank = FMath::Clamp(static_cast<uint32>(FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 1.0) * SampleCount)), 1u, SampleCount);
+	uint32 CumulativeCount = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; BucketIndex++)
+	{
+		CumulativeCount += BucketCounts[BucketIndex];
+		if (CumulativeCount >= TargetRank)
+		{
+			return FMath::Clamp(GetBucketUpperBound(BucketIndex), MinMilliseconds, MaxMilliseconds);
+		}
+	}
+
+	return MaxMilliseconds;
+}
+
+int32 FMultiplayerSessionLatencyHistogram::GetBucketIndex(double Milliseconds)
+{
+	if (Milliseconds < 1.0)
+	{
+		return 0;
+	}
+
+	const int32 BucketIndex = 1 + FMath::FloorToInt32(FMath::Log2(Milliseconds) * BucketsPerDoubling);
+	return FMath::Clamp(BucketIndex, 1, NumBuckets - 1);
+}
+
+double FMultiplayerSessionLatencyHistogram::GetBucketUpperBound(int32 BucketIndex)
+{
+	return FMath::Pow(2.0, static_cast<double>(BucketIndex) / BucketsPerDoubling);
+}
+
+FMultiplayerSessionOperationStats::FMultiplayerSessionOperationStats(int32 InNumOperations, int32 InNumSteps)
+	: NumSteps(InNumSteps)
+{
+	Operations.SetNum(InNumOperations);
+	for (FOperationEntry& Operation : Operations)
+	{
+		Operation.Steps.SetNum(NumSteps);
+	}
+}
+
+void FMultiplayerSessionOperationStats::RecordStep(int32 OperationIndex, int32 StepIndex, double Milliseconds)
+{
+	if (Operations.IsValidIndex(OperationIndex) == false || StepIndex < 0 || StepIndex >= NumSteps)
+	{
+		return;
+	}
+
+	Operations[OperationIndex].Steps[StepIndex].AddSample(Milliseconds);
+}
+
+void FMultiplayerSessionOperationStats::RecordOperation(int32 OperationIndex, double Milliseconds, EMultiplayerSessionFailureReason FailureReason)
+{
+	if (Operations.IsValidIndex(OperationIndex) == false)
+	{
+		return;
+	}
+
+	FOperationEntry& Operation = Operations[OperationIndex];
+	Operation.Total.AddSample(Milliseconds);
+	if (FailureReason == EMultiplayerSessionFailureReason::None)
+	{
+		Operation.SuccessCount++;
+		return;
+	}
+
+	Operation.FailureCounts.FindOrAdd(FailureReason)++;
+}
+
+void FMultiplayerSessionOperationStats::Reset()
+{
+	for (FOperationEntry& Operation : Operations)
+	{
+		Operation.Total.Reset();
+		for (FMultiplayerSessionLatencyHistogram& Step : Operation.Steps)
+		{
+			Step.Reset();
+		}
+
+		Operation.SuccessCount = 0;
+		Operation.FailureCounts.Reset();
+	}
+}
+
+void FMultiplayerSessionFlightRecorder::Record(const FMultiplayerSessionFlightRecord& FlightRecord)
+{
+	Records[TotalRecorded % Capacity] = FlightRecord;
+	TotalRecorded++;
+}
+
+void FMultiplayerSessionFlightRecorder::Reset()
+{
+	TotalRecorded = 0;
+}
+
+const FMultiplayerSessionFlightRecord& FMultiplayerSessionFlightRecorder::GetRecord(int32 Index) const
+{
+	const uint64 OldestIndex = TotalRecorded > Capacity ? TotalRecorded % Capacity : 0;
+	return Records[(OldestIndex + static_cast<uint64>(Index)) % Capacity];
+}
+
+const TCHAR* FMultiplayerSessionFlightRecorder::EventToString(EMultiplayerSessionFlightEvent Event)
+{
+	switch (Event)
+	{
+	case EMultiplayerSessionFlightEvent::OperationBegin:
+		return TEXT("Begin");
+	case EMultiplayerSessionFlightEvent::StepChanged:
+		return TEXT("Step");
+	case EMultiplayerSessionFlightEvent::OperationCompleted:
+		return TEXT("Completed");
+	case EMultiplayerSessionFlightEvent::FlowStateChanged:
+		return TEXT("FlowState");
+	case EMultiplayerSessionFlightEvent::Failure:
+		return TEXT("Failure");
+	case EMultiplayerSessionFlightEvent::NetworkFailure:
+		return TEXT("NetworkFailure");
+	case EMultiplayerSessionFlightEvent::TravelFailure:
+		return TEXT("TravelFailure");
+	default:
+		return TEXT("Unknown");
+	}
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiplayerSessionsTypes.h"
+
+class FMultiplayerSessionLatencyHistogram
+{
+public:
+	static constexpr int32 BucketsPerDoubling = 8;
+	static constexpr int32 NumBuckets = 144;
+
+	void AddSample(double Milliseconds);
+	void Reset();
+	double GetPercentile(double Percentile) const;
+
+	uint32 GetSampleCount() const
+	{
+		return SampleCount;
+	}
+
+	double GetMinMilliseconds() const
+	{
+		return SampleCount > 0 ? MinMilliseconds : 0.0;
+	}
+
+	double GetMaxMilliseconds() const
+	{
+		return MaxMilliseconds;
+	}
+
+	double GetMeanMilliseconds() const
+	{
+		return SampleCount > 0 ? TotalMilliseconds / static_cast<double>(SampleCount) : 0.0;
+	}
+
+private:
+	static int32 GetBucketIndex(double Milliseconds);
+	static double GetBucketUpperBound(int32 BucketIndex);
+
+private:
+	uint32 BucketCounts[NumBuckets] = {};
+	uint32 SampleCount = 0;
+	double MinMilliseconds = 0.0;
+	double MaxMilliseconds = 0.0;
+	double TotalMilliseconds = 0.0;
+};
+
+class FMultiplayerSessionOperationStats
+{
+public:
+	FMultiplayerSessionOperationStats(int32 InNumOperations, int32 InNumSteps);
+
+	void RecordStep(int32 OperationIndex, int32 StepIndex, double Milliseconds);
+	void RecordOperation(int32 OperationIndex, double Milliseconds, EMultiplayerSessionFailureReason FailureReason);
+	void Reset();
+
+	int32 GetNumOperations() const
+	{
+		return Operations.Num();
+	}
+
+	int32 GetNumSteps() const
+	{
+		return NumSteps;
+	}
+
+	const FMultiplayerSessionLatencyHistogram& GetOperationHistogram(int32 OperationIndex) const
+	{
+		return Operations[OperationIndex].Total;
+	}
+
+	const FMultiplayerSessionLatencyHistogram& GetStepHistogram(int32 OperationIndex, int32 StepIndex) const
+	{
+		return Operations[OperationIndex].Steps[StepIndex];
+	}
+
+	int32 GetSuccessCount(int32 OperationIndex) const
+	{
+		return Operations[OperationIndex].SuccessCount;
+	}
+
+	const TMap<EMultiplayerSessionFailureReason, int32>& GetFailureCounts(int32 OperationIndex) const
+	{
+		return Operations[OperationIndex].FailureCounts;
+	}
+
+private:
+	struct FOperationEntry
+	{
+		FMultiplayerSessionLatencyHistogram Total;
+		TArray<FMultiplayerSessionLatencyHistogram> Steps;
+		int32 SuccessCount = 0;
+		TMap<EMultiplayerSessionFailureReason, int32> FailureCounts;
+	};
+
+	TArray<FOperationEntry> Operations;
+	int32 NumSteps = 0;
+};
+
+enum class EMultiplayerSessionFlightEvent : uint8
+{
+	OperationBegin,
+	StepChanged,
+	OperationCompleted,
+	FlowStateChanged,
+	Failure,
+	NetworkFailure,
+	TravelFailure
+};
+
+struct FMultiplayerSessionFlightRecord
+{
+	double Seconds = 0.0;
+	uint64 Generation = 0;
+	EMultiplayerSessionFlightEvent Event = EMultiplayerSessionFlightEvent::OperationBegin;
+	uint8 OperationType = 0;
+	uint8 OperationStep = 0;
+	EMultiplayerSessionFlowState FlowState = EMultiplayerSessionFlowState::Idle;
+	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
+	int8 LocalUserNum = INDEX_NONE;
+};
+
+class FMultiplayerSessionFlightRecorder
+{
+public:
+	static constexpr int32 Capacity = 256;
+
+	void Record(const FMultiplayerSessionFlightRecord& FlightRecord);
+	void Reset();
+	const FMultiplayerSessionFlightRecord& GetRecord(int32 Index) const;
+	static const TCHAR* EventToString(EMultiplayerSessionFlightEvent Event);
+
+	int32 GetNumRecords() const
+	{
+		return static_cast<int32>(FMath::Min<uint64>(TotalRecorded, Capacity));
+	}
+
+	uint64 GetTotalRecorded() const
+	{
+		return TotalRecorded;
+	}
+
+private:
+	FMultiplayerSessionFlightRecord Records[Capacity];
+	uint64 TotalRecorded = 0;
+};
@@ -0,0 +1,927 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsFakeSession.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsSubsystem.h"
+#include "MultiplayerSessionsSyntheticResults.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "OnlineSubsystemTypes.h"
+
+namespace
+{
+	const FName FakeNetIdType(TEXT("FakeSession"));
+
+	int32 ToIndex(EMultiplayerSessionsFakeCall Call)
+	{
+		return FMath::Clamp(static_cast<int32>(Call), 0, static_cast<int32>(EMultiplayerSessionsFakeCall::Count) - 1);
+	}
+}
+
+FMultiplayerSessionsFakeSession::FMultiplayerSessionsFakeSession(int32 InSeed)
+	: FakeHostId(FUniqueNetIdString::Create(TEXT("FakeHost"), FakeNetIdType))
+	, ConnectString(TEXT("127.0.0.1:7777"))
+	, RandomStream(InSeed)
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMultiplayerSessionsFakeSession::Tick), 0.0f);
+}
+
+FMultiplayerSessionsFakeSession::~FMultiplayerSessionsFakeSession()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+void FMultiplayerSessionsFakeSession::SetCallSettings(EMultiplayerSessionsFakeCall Call, const FMultiplayerSessionsFakeCallSettings& Settings)
+{
+	FMultiplayerSessionsFakeCallSettings& CallSetting = CallSettings[ToIndex(Call)];
+	CallSetting = Settings;
+	CallSetting.MinLatencySeconds = FMath::Max(0.0f, Settings.MinLatencySeconds);
+	CallSetting.MaxLatencySeconds = FMath::Max(CallSetting.MinLatencySeconds, Settings.MaxLatencySeconds);
+	CallSetting.FailureRate = FMath::Clamp(Settings.FailureRate, 0.0f, 1.0f);
+	CallSetting.DropRate = FMath::Clamp(Settings.DropRate, 0.0f, 1.0f);
+	CallSetting.LateRate = FMath::Clamp(Settings.LateRate, 0.0f, 1.0f);
+	CallSetting.LateDelaySeconds = FMath::Max(0.0f, Settings.LateDelaySeconds);
+}
+
+void FMultiplayerSessionsFakeSession::SetAllCallSettings(const FMultiplayerSessionsFakeCallSettings& Settings)
+{
+	for (int32 CallIndex = 0; CallIndex < static_cast<int32>(EMultiplayerSessionsFakeCall::Count); CallIndex++)
+	{
+		SetCallSettings(static_cast<EMultiplayerSessionsFakeCall>(CallIndex), Settings);
+	}
+}
+
+const FMultiplayerSessionsFakeCallSettings& FMultiplayerSessionsFakeSession::GetCallSettings(EMultiplayerSessionsFakeCall Call) const
+{
+	return CallSettings[ToIndex(Call)];
+}
+
+void FMultiplayerSessionsFakeSession::SetPreserveCompletionOrder(bool bInPreserveCompletionOrder)
+{
+	bPreserveCompletionOrder = bInPreserveCompletionOrder;
+}
+
+void FMultiplayerSessionsFakeSession::SetScriptedSearchResults(TArray<FOnlineSessionSearchResult>&& SearchResults)
+{
+	ScriptedSearchResults = MoveTemp(SearchResults);
+}
+
+void FMultiplayerSessionsFakeSession::SetSyntheticSearchResults(int32 ResultCount, const FString& MatchType, int32 BuildId, int32 SessionSchemaVersion)
+{
+	MultiplayerSessionsSynthetic::FSyntheticResultOptions SyntheticOptions;
+	SyntheticOptions.MatchType = MatchType;
+	SyntheticOptions.BuildId = BuildId;
+	SyntheticOptions.SessionSchemaVersion = SessionSchemaVersion;
+	SyntheticOptions.Seed = RandomStream.GetInitialSeed();
+	MultiplayerSessionsSynthetic::MakeSearchResults(FMath::Max(0, ResultCount), SyntheticOptions, ScriptedSearchResults);
+}
+
+void FMultiplayerSessionsFakeSession::SetConnectString(const FString& InConnectString)
+{
+	ConnectString = InConnectString;
+}
+
+const FMultiplayerSessionsFakeCallCounters& FMultiplayerSessionsFakeSession::GetCallCounters(EMultiplayerSessionsFakeCall Call) const
+{
+	return CallCounters[ToIndex(Call)];
+}
+
+void FMultiplayerSessionsFakeSession::ResetCallCounters()
+{
+	for (FMultiplayerSessionsFakeCallCounters& Counters : CallCounters)
+	{
+		Counters = FMultiplayerSessionsFakeCallCounters();
+	}
+}
+
+int32 FMultiplayerSessionsFakeSession::GetNumPendingCompletions() const
+{
+	return PendingCompletions.Num();
+}
+
+int32 FMultiplayerSessionsFakeSession::GetNumBoundDelegateLists() const
+{
+	int32 BoundLists = 0;
+	BoundLists += OnCreateSessionCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnFindSessionsCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnCancelFindSessionsCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnJoinSessionCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnDestroySessionCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnUpdateSessionCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnStartSessionCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnEndSessionCompleteDelegates.IsBound() == true ? 1 : 0;
+	BoundLists += OnSessionUserInviteAcceptedDelegates.IsBound() == true ? 1 : 0;
+	for (int32 LocalUserNum = 0; LocalUserNum < MAX_LOCAL_PLAYERS; LocalUserNum++)
+	{
+		BoundLists += OnFindFriendSessionCompleteDelegates[LocalUserNum].IsBound() == true ? 1 : 0;
+	}
+
+	return BoundLists;
+}
+
+SIZE_T FMultiplayerSessionsFakeSession::GetDelegateAllocatedSize() const
+{
+	SIZE_T AllocatedSize = 0;
+	AllocatedSize += OnCreateSessionCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnFindSessionsCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnCancelFindSessionsCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnJoinSessionCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnDestroySessionCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnUpdateSessionCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnStartSessionCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnEndSessionCompleteDelegates.GetAllocatedSize();
+	AllocatedSize += OnSessionUserInviteAcceptedDelegates.GetAllocatedSize();
+	for (int32 LocalUserNum = 0; LocalUserNum < MAX_LOCAL_PLAYERS; LocalUserNum++)
+	{
+		AllocatedSize += OnFindFriendSessionCompleteDelegates[LocalUserNum].GetAllocatedSize();
+	}
+
+	return AllocatedSize;
+}
+
+void FMultiplayerSessionsFakeSession::DumpFakeState(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Fake session interface: Sessions=%d Pending=%d Dropped=%d ScriptedResults=%d PreserveOrder=%d ActiveSearch=%d"), Sessions.Num(), PendingCompletions.Num(), DroppedCalls.Num(), ScriptedSearchResults.Num(), bPreserveCompletionOrder == true ? 1 : 0, ActiveSearch.IsValid() == true ? 1 : 0);
+	Ar.Logf(TEXT("%-10s %10s %10s %8s %8s %8s %8s %8s %8s %8s %8s %8s"), TEXT("Call"), TEXT("MinMs"), TEXT("MaxMs"), TEXT("Fail"), TEXT("Drop"), TEXT("Late"), TEXT("Issued"), TEXT("Rejected"), TEXT("Done"), TEXT("Failed"), TEXT("Dropped"), TEXT("Cancel"));
+	for (int32 CallIndex = 0; CallIndex < static_cast<int32>(EMultiplayerSessionsFakeCall::Count); CallIndex++)
+	{
+		const FMultiplayerSessionsFakeCallSettings& Settings = CallSettings[CallIndex];
+		const FMultiplayerSessionsFakeCallCounters& Counters = CallCounters[CallIndex];
+		Ar.Logf(
+			TEXT("%-10s %10.1f %10.1f %8.2f %8.2f %8.2f %8d %8d %8d %8d %8d %8d"),
+			CallToString(static_cast<EMultiplayerSessionsFakeCall>(CallIndex)),
+			Settings.MinLatencySeconds * 1000.0f,
+			Settings.MaxLatencySeconds * 1000.0f,
+			Settings.FailureRate,
+			Settings.DropRate,
+			Settings.LateRate,
+			Counters.Issued,
+			Counters.Rejected,
+			Counters.Completed,
+			Counters.Failed,
+			Counters.Dropped,
+			Counters.Cancelled
+		);
+	}
+}
+
+const TCHAR* FMultiplayerSessionsFakeSession::CallToString(EMultiplayerSessionsFakeCall Call)
+{
+	switch (Call)
+	{
+	case EMultiplayerSessionsFakeCall::Create:
+		return TEXT("Create");
+	case EMultiplayerSessionsFakeCall::Find:
+		return TEXT("Find");
+	case EMultiplayerSessionsFakeCall::FindFriend:
+		return TEXT("FindFriend");
+	case EMultiplayerSessionsFakeCall::Join:
+		return TEXT("Join");
+	case EMultiplayerSessionsFakeCall::Destroy:
+		return TEXT("Destroy");
+	case EMultiplayerSessionsFakeCall::Update:
+		return TEXT("Update");
+	case EMultiplayerSessionsFakeCall::Start:
+		return TEXT("Start");
+	case EMultiplayerSessionsFakeCall::End:
+		return TEXT("End");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+bool FMultiplayerSessionsFakeSession::BeginCall(EMultiplayerSessionsFakeCall Call, FName SessionName, TFunction<void(bool)>&& Complete)
+{
+	const FMultiplayerSessionsFakeCallSettings& Settings = CallSettings[ToIndex(Call)];
+	FMultiplayerSessionsFakeCallCounters& Counters = CallCounters[ToIndex(Call)];
+	Counters.Issued++;
+
+	if (RandomStream.FRand() < Settings.DropRate)
+	{
+		Counters.Dropped++;
+		DroppedCalls.Add({Call, SessionName});
+		return true;
+	}
+
+	FPendingCompletion& PendingCompletion = PendingCompletions.AddDefaulted_GetRef();
+	PendingCompletion.Sequence = NextSequence++;
+	PendingCompletion.Call = Call;
+	PendingCompletion.bSucceeded = RandomStream.FRand() >= Settings.FailureRate;
+	PendingCompletion.Complete = MoveTemp(Complete);
+
+	double LatencySeconds = RandomStream.FRandRange(Settings.MinLatencySeconds, Settings.MaxLatencySeconds);
+	if (RandomStream.FRand() < Settings.LateRate)
+	{
+		LatencySeconds += Settings.LateDelaySeconds;
+		Counters.Late++;
+	}
+
+	PendingCompletion.DueSeconds = FPlatformTime::Seconds() + LatencySeconds;
+	if (bPreserveCompletionOrder == true && PendingCompletions.Num() > 1)
+	{
+		PendingCompletion.DueSeconds = FMath::Max(PendingCompletion.DueSeconds, PendingCompletions[PendingCompletions.Num() - 2].DueSeconds);
+	}
+
+	return true;
+}
+
+bool FMultiplayerSessionsFakeSession::Tick(float DeltaTime)
+{
+	if (PendingCompletions.Num() == 0)
+	{
+		return true;
+	}
+
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	TArray<FPendingCompletion> DueCompletions;
+	for (int32 Index = PendingCompletions.Num() - 1; Index >= 0; Index--)
+	{
+		if (PendingCompletions[Index].DueSeconds <= CurrentSeconds)
+		{
+			DueCompletions.Add(MoveTemp(PendingCompletions[Index]));
+			PendingCompletions.RemoveAt(Index);
+		}
+	}
+
+	DueCompletions.Sort([](const FPendingCompletion& Left, const FPendingCompletion& Right)
+	{
+		if (Left.DueSeconds != Right.DueSeconds)
+		{
+			return Left.DueSeconds < Right.DueSeconds;
+		}
+
+		return Left.Sequence < Right.Sequence;
+	});
+
+	for (FPendingCompletion& DueCompletion : DueCompletions)
+	{
+		FMultiplayerSessionsFakeCallCounters& Counters = CallCounters[ToIndex(DueCompletion.Call)];
+		if (DueCompletion.bSucceeded == true)
+		{
+			Counters.Completed++;
+		}
+		else
+		{
+			Counters.Failed++;
+		}
+
+		DueCompletion.Complete(DueCompletion.bSucceeded);
+	}
+
+	return true;
+}
+
+bool FMultiplayerSessionsFakeSession::RemoveDroppedCall(EMultiplayerSessionsFakeCall Call, FName SessionName)
+{
+	return DroppedCalls.RemoveAll([Call, SessionName](const FDroppedCall& DroppedCall)
+	{
+		return DroppedCall.Call == Call && DroppedCall.SessionName == SessionName;
+	}) > 0;
+}
+
+void FMultiplayerSessionsFakeSession::CancelDroppedSessionCalls(FName SessionName)
+{
+	for (const EMultiplayerSessionsFakeCall Call : {EMultiplayerSessionsFakeCall::Create, EMultiplayerSessionsFakeCall::Join})
+	{
+		CallCounters[ToIndex(Call)].Cancelled += RemoveDroppedCall(Call, SessionName) == true ? 1 : 0;
+	}
+}
+
+EOnJoinSessionCompleteResult::Type FMultiplayerSessionsFakeSession::PickJoinFailure()
+{
+	const float Roll = RandomStream.FRand();
+	if (Roll < 0.4f)
+	{
+		return EOnJoinSessionCompleteResult::SessionIsFull;
+	}
+	if (Roll < 0.7f)
+	{
+		return EOnJoinSessionCompleteResult::SessionDoesNotExist;
+	}
+
+	return EOnJoinSessionCompleteResult::UnknownError;
+}
+
+FUniqueNetIdPtr FMultiplayerSessionsFakeSession::CreateSessionIdFromString(const FString& SessionIdStr)
+{
+	return FUniqueNetIdString::Create(SessionIdStr, FakeNetIdType);
+}
+
+FNamedOnlineSession* FMultiplayerSessionsFakeSession::GetNamedSession(FName SessionName)
+{
+	for (const TUniquePtr<FNamedOnlineSession>& Session : Sessions)
+	{
+		if (Session->SessionName == SessionName)
+		{
+			return Session.Get();
+		}
+	}
+
+	return nullptr;
+}
+
+void FMultiplayerSessionsFakeSession::RemoveNamedSession(FName SessionName)
+{
+	DroppedCalls.RemoveAll([SessionName](const FDroppedCall& DroppedCall)
+	{
+		return DroppedCall.SessionName == SessionName;
+	});
+
+	Sessions.RemoveAll([SessionName](const TUniquePtr<FNamedOnlineSession>& Session)
+	{
+		return Session->SessionName == SessionName;
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::HasPresenceSession()
+{
+	for (const TUniquePtr<FNamedOnlineSession>& Session : Sessions)
+	{
+		if (Session->SessionSettings.bUsesPresence == true)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+EOnlineSessionState::Type FMultiplayerSessionsFakeSession::GetSessionState(FName SessionName) const
+{
+	for (const TUniquePtr<FNamedOnlineSession>& Session : Sessions)
+	{
+		if (Session->SessionName == SessionName)
+		{
+			return Session->SessionState;
+		}
+	}
+
+	return EOnlineSessionState::NoSession;
+}
+
+bool FMultiplayerSessionsFakeSession::CreateSession(int32 HostingPlayerNum, FName SessionName, const FOnlineSessionSettings& NewSessionSettings)
+{
+	return BeginCreateSession(SessionName, NewSessionSettings);
+}
+
+bool FMultiplayerSessionsFakeSession::CreateSession(const FUniqueNetId& HostingPlayerId, FName SessionName, const FOnlineSessionSettings& NewSessionSettings)
+{
+	return BeginCreateSession(SessionName, NewSessionSettings);
+}
+
+bool FMultiplayerSessionsFakeSession::BeginCreateSession(FName SessionName, const FOnlineSessionSettings& NewSessionSettings)
+{
+	if (GetNamedSession(SessionName) != nullptr)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Create)].Rejected++;
+		return false;
+	}
+
+	FNamedOnlineSession* Session = AddNamedSession(SessionName, NewSessionSettings);
+	Session->SessionState = EOnlineSessionState::Creating;
+	Session->OwningUserId = FakeHostId;
+	Session->OwningUserName = TEXT("FakeHost");
+	Session->NumOpenPublicConnections = NewSessionSettings.NumPublicConnections;
+	Session->NumOpenPrivateConnections = NewSessionSettings.NumPrivateConnections;
+	Session->bHosting = true;
+
+	return BeginCall(EMultiplayerSessionsFakeCall::Create, SessionName, [this, SessionName](bool bSucceeded)
+	{
+		FNamedOnlineSession* CreatedSession = GetNamedSession(SessionName);
+		if (CreatedSession != nullptr)
+		{
+			if (bSucceeded == true)
+			{
+				CreatedSession->SessionState = EOnlineSessionState::Pending;
+			}
+			else
+			{
+				RemoveNamedSession(SessionName);
+			}
+		}
+
+		TriggerOnCreateSessionCompleteDelegates(SessionName, bSucceeded == true && CreatedSession != nullptr);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::StartSession(FName SessionName)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session == nullptr)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Start)].Rejected++;
+		return false;
+	}
+
+	const EOnlineSessionState::Type PreviousState = Session->SessionState;
+	Session->SessionState = EOnlineSessionState::Starting;
+	return BeginCall(EMultiplayerSessionsFakeCall::Start, SessionName, [this, SessionName, PreviousState](bool bSucceeded)
+	{
+		FNamedOnlineSession* StartedSession = GetNamedSession(SessionName);
+		if (StartedSession != nullptr)
+		{
+			StartedSession->SessionState = bSucceeded == true ? EOnlineSessionState::InProgress : PreviousState;
+		}
+
+		TriggerOnStartSessionCompleteDelegates(SessionName, bSucceeded == true && StartedSession != nullptr);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::UpdateSession(FName SessionName, FOnlineSessionSettings& UpdatedSessionSettings, bool bShouldRefreshOnlineData)
+{
+	if (GetNamedSession(SessionName) == nullptr)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Update)].Rejected++;
+		return false;
+	}
+
+	return BeginCall(EMultiplayerSessionsFakeCall::Update, SessionName, [this, SessionName, UpdatedSessionSettings](bool bSucceeded)
+	{
+		FNamedOnlineSession* UpdatedSession = GetNamedSession(SessionName);
+		if (UpdatedSession != nullptr && bSucceeded == true)
+		{
+			UpdatedSession->SessionSettings = UpdatedSessionSettings;
+		}
+
+		TriggerOnUpdateSessionCompleteDelegates(SessionName, bSucceeded == true && UpdatedSession != nullptr);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::EndSession(FName SessionName)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session == nullptr)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::End)].Rejected++;
+		return false;
+	}
+
+	const EOnlineSessionState::Type PreviousState = Session->SessionState;
+	Session->SessionState = EOnlineSessionState::Ending;
+	return BeginCall(EMultiplayerSessionsFakeCall::End, SessionName, [this, SessionName, PreviousState](bool bSucceeded)
+	{
+		FNamedOnlineSession* EndedSession = GetNamedSession(SessionName);
+		if (EndedSession != nullptr)
+		{
+			EndedSession->SessionState = bSucceeded == true ? EOnlineSessionState::Ended : PreviousState;
+		}
+
+		TriggerOnEndSessionCompleteDelegates(SessionName, bSucceeded == true && EndedSession != nullptr);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::DestroySession(FName SessionName, const FOnDestroySessionCompleteDelegate& CompletionDelegate)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session == nullptr)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Destroy)].Rejected++;
+		return false;
+	}
+
+	if (Session->SessionState == EOnlineSessionState::Destroying && RemoveDroppedCall(EMultiplayerSessionsFakeCall::Destroy, SessionName) == false)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Destroy)].Rejected++;
+		return false;
+	}
+
+	CancelDroppedSessionCalls(SessionName);
+	const EOnlineSessionState::Type PreviousState = Session->SessionState == EOnlineSessionState::Destroying ? EOnlineSessionState::Pending : Session->SessionState;
+	Session->SessionState = EOnlineSessionState::Destroying;
+	return BeginCall(EMultiplayerSessionsFakeCall::Destroy, SessionName, [this, SessionName, PreviousState, CompletionDelegate](bool bSucceeded)
+	{
+		FNamedOnlineSession* DestroyedSession = GetNamedSession(SessionName);
+		if (DestroyedSession != nullptr)
+		{
+			if (bSucceeded == true)
+			{
+				RemoveNamedSession(SessionName);
+			}
+			else
+			{
+				DestroyedSession->SessionState = PreviousState;
+			}
+		}
+
+		CompletionDelegate.ExecuteIfBound(SessionName, bSucceeded);
+		TriggerOnDestroySessionCompleteDelegates(SessionName, bSucceeded);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::IsPlayerInSession(FName SessionName, const FUniqueNetId& UniqueId)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session == nullptr)
+	{
+		return false;
+	}
+
+	for (const FUniqueNetIdRef& RegisteredPlayer : Session->RegisteredPlayers)
+	{
+		if (*RegisteredPlayer == UniqueId)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FMultiplayerSessionsFakeSession::StartMatchmaking(const TArray<FUniqueNetIdRef>& LocalPlayers, FName SessionName, const FOnlineSessionSettings& NewSessionSettings, TSharedRef<FOnlineSessionSearch>& SearchSettings)
+{
+	return false;
+}
+
+bool FMultiplayerSessionsFakeSession::CancelMatchmaking(int32 SearchingPlayerNum, FName SessionName)
+{
+	return false;
+}
+
+bool FMultiplayerSessionsFakeSession::CancelMatchmaking(const FUniqueNetId& SearchingPlayerId, FName SessionName)
+{
+	return false;
+}
+
+bool FMultiplayerSessionsFakeSession::FindSessions(int32 SearchingPlayerNum, const TSharedRef<FOnlineSessionSearch>& SearchSettings)
+{
+	return BeginFindSessions(SearchSettings);
+}
+
+bool FMultiplayerSessionsFakeSession::FindSessions(const FUniqueNetId& SearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& SearchSettings)
+{
+	return BeginFindSessions(SearchSettings);
+}
+
+bool FMultiplayerSessionsFakeSession::BeginFindSessions(const TSharedRef<FOnlineSessionSearch>& SearchSettings)
+{
+	if (ActiveSearch.IsValid() == true)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Find)].Rejected++;
+		return false;
+	}
+
+	ActiveSearch = SearchSettings;
+	SearchSettings->SearchResults.Reset();
+	SearchSettings->SearchState = EOnlineAsyncTaskState::InProgress;
+
+	const TWeakPtr<FOnlineSessionSearch> WeakSearch = SearchSettings;
+	return BeginCall(EMultiplayerSessionsFakeCall::Find, NAME_None, [this, WeakSearch](bool bSucceeded)
+	{
+		const TSharedPtr<FOnlineSessionSearch> Search = WeakSearch.Pin();
+		if (Search.IsValid() == false || Search != ActiveSearch)
+		{
+			return;
+		}
+
+		ActiveSearch.Reset();
+		if (bSucceeded == true)
+		{
+			const int32 ResultCount = Search->MaxSearchResults > 0 ? FMath::Min(Search->MaxSearchResults, ScriptedSearchResults.Num()) : ScriptedSearchResults.Num();
+			Search->SearchResults.Append(ScriptedSearchResults.GetData(), ResultCount);
+			Search->SearchState = EOnlineAsyncTaskState::Done;
+		}
+		else
+		{
+			Search->SearchState = EOnlineAsyncTaskState::Failed;
+		}
+
+		TriggerOnFindSessionsCompleteDelegates(bSucceeded);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::FindSessionById(const FUniqueNetId& SearchingUserId, const FUniqueNetId& SessionId, const FUniqueNetId& FriendId, const FOnSingleSessionResultCompleteDelegate& CompletionDelegate)
+{
+	return false;
+}
+
+bool FMultiplayerSessionsFakeSession::CancelFindSessions()
+{
+	if (ActiveSearch.IsValid() == false)
+	{
+		return false;
+	}
+
+	ActiveSearch->SearchState = EOnlineAsyncTaskState::Failed;
+	ActiveSearch.Reset();
+	CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Find)].Cancelled += PendingCompletions.RemoveAll([](const FPendingCompletion& PendingCompletion)
+	{
+		return PendingCompletion.Call == EMultiplayerSessionsFakeCall::Find;
+	});
+	CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Find)].Cancelled += RemoveDroppedCall(EMultiplayerSessionsFakeCall::Find, NAME_None) == true ? 1 : 0;
+
+	TriggerOnCancelFindSessionsCompleteDelegates(true);
+	return true;
+}
+
+bool FMultiplayerSessionsFakeSession::PingSearchResults(const FOnlineSessionSearchResult& SearchResult)
+{
+	return false;
+}
+
+bool FMultiplayerSessionsFakeSession::JoinSession(int32 LocalUserNum, FName SessionName, const FOnlineSessionSearchResult& DesiredSession)
+{
+	return BeginJoinSession(SessionName, DesiredSession);
+}
+
+bool FMultiplayerSessionsFakeSession::JoinSession(const FUniqueNetId& LocalUserId, FName SessionName, const FOnlineSessionSearchResult& DesiredSession)
+{
+	return BeginJoinSession(SessionName, DesiredSession);
+}
+
+bool FMultiplayerSessionsFakeSession::BeginJoinSession(FName SessionName, const FOnlineSessionSearchResult& DesiredSession)
+{
+	if (GetNamedSession(SessionName) != nullptr)
+	{
+		CallCounters[ToIndex(EMultiplayerSessionsFakeCall::Join)].Rejected++;
+		return false;
+	}
+
+	FNamedOnlineSession* Session = AddNamedSession(SessionName, DesiredSession.Session);
+	Session->SessionState = EOnlineSessionState::Creating;
+	Session->bHosting = false;
+
+	return BeginCall(EMultiplayerSessionsFakeCall::Join, SessionName, [this, SessionName](bool bSucceeded)
+	{
+		FNamedOnlineSession* JoinedSession = GetNamedSession(SessionName);
+		EOnJoinSessionCompleteResult::Type Result = EOnJoinSessionCompleteResult::Success;
+		if (JoinedSession == nullptr)
+		{
+			Result = EOnJoinSessionCompleteResult::SessionDoesNotExist;
+		}
+		else if (bSucceeded == true)
+		{
+			JoinedSession->SessionState = EOnlineSessionState::Pending;
+		}
+		else
+		{
+			RemoveNamedSession(SessionName);
+			Result = PickJoinFailure();
+		}
+
+		TriggerOnJoinSessionCompleteDelegates(SessionName, Result);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::FindFriendSession(int32 LocalUserNum, const FUniqueNetId& Friend)
+{
+	return BeginFindFriendSession(LocalUserNum);
+}
+
+bool FMultiplayerSessionsFakeSession::FindFriendSession(const FUniqueNetId& LocalUserId, const FUniqueNetId& Friend)
+{
+	return BeginFindFriendSession(0);
+}
+
+bool FMultiplayerSessionsFakeSession::FindFriendSession(const FUniqueNetId& LocalUserId, const TArray<FUniqueNetIdRef>& FriendList)
+{
+	return BeginFindFriendSession(0);
+}
+
+bool FMultiplayerSessionsFakeSession::BeginFindFriendSession(int32 LocalUserNum)
+{
+	return BeginCall(EMultiplayerSessionsFakeCall::FindFriend, NAME_None, [this, LocalUserNum](bool bSucceeded)
+	{
+		TArray<FOnlineSessionSearchResult> FriendSearchResults;
+		if (bSucceeded == true && ScriptedSearchResults.Num() > 0)
+		{
+			FriendSearchResults.Add(ScriptedSearchResults[0]);
+		}
+
+		TriggerOnFindFriendSessionCompleteDelegates(LocalUserNum, bSucceeded == true && FriendSearchResults.Num() > 0, FriendSearchResults);
+	});
+}
+
+bool FMultiplayerSessionsFakeSession::SendSessionInviteToFriend(int32 LocalUserNum, FName SessionName, const FUniqueNetId& Friend)
+{
+	return GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMultiplayerSessionsFakeSession::SendSessionInviteToFriend(const FUniqueNetId& LocalUserId, FName SessionName, const FUniqueNetId& Friend)
+{
+	return GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMultiplayerSessionsFakeSession::SendSessionInviteToFriends(int32 LocalUserNum, FName SessionName, const TArray<FUniqueNetIdRef>& Friends)
+{
+	return GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMultiplayerSessionsFakeSession::SendSessionInviteToFriends(const FUniqueNetId& LocalUserId, FName SessionName, const TArray<FUniqueNetIdRef>& Friends)
+{
+	return GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMultiplayerSessionsFakeSession::GetResolvedConnectString(FName SessionName, FString& ConnectInfo, FName PortType)
+{
+	if (GetNamedSession(SessionName) == nullptr || ConnectString.IsEmpty() == true)
+	{
+		return false;
+	}
+
+	ConnectInfo = ConnectString;
+	return true;
+}
+
+bool FMultiplayerSessionsFakeSession::GetResolvedConnectString(const FOnlineSessionSearchResult& SearchResult, FName PortType, FString& ConnectInfo)
+{
+	if (SearchResult.IsValid() == false || ConnectString.IsEmpty() == true)
+	{
+		return false;
+	}
+
+	ConnectInfo = ConnectString;
+	return true;
+}
+
+FOnlineSessionSettings* FMultiplayerSessionsFakeSession::GetSessionSettings(FName SessionName)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	return Session != nullptr ? &Session->SessionSettings : nullptr;
+}
+
+bool FMultiplayerSessionsFakeSession::RegisterPlayer(FName SessionName, const FUniqueNetId& PlayerId, bool bWasInvited)
+{
+	TArray<FUniqueNetIdRef> Players;
+	Players.Add(PlayerId.AsShared());
+	return RegisterPlayers(SessionName, Players, bWasInvited);
+}
+
+bool FMultiplayerSessionsFakeSession::RegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players, bool bWasInvited)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session == nullptr)
+	{
+		return false;
+	}
+
+	for (const FUniqueNetIdRef& Player : Players)
+	{
+		if (IsPlayerInSession(SessionName, *Player) == false)
+		{
+			Session->RegisteredPlayers.Add(Player);
+		}
+	}
+
+	TriggerOnRegisterPlayersCompleteDelegates(SessionName, Players, true);
+	return true;
+}
+
+bool FMultiplayerSessionsFakeSession::UnregisterPlayer(FName SessionName, const FUniqueNetId& PlayerId)
+{
+	TArray<FUniqueNetIdRef> Players;
+	Players.Add(PlayerId.AsShared());
+	return UnregisterPlayers(SessionName, Players);
+}
+
+bool FMultiplayerSessionsFakeSession::UnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players)
+{
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session == nullptr)
+	{
+		return false;
+	}
+
+	for (const FUniqueNetIdRef& Player : Players)
+	{
+		Session->RegisteredPlayers.RemoveAll([&Player](const FUniqueNetIdRef& RegisteredPlayer)
+		{
+			return *RegisteredPlayer == *Player;
+		});
+	}
+
+	TriggerOnUnregisterPlayersCompleteDelegates(SessionName, Players, true);
+	return true;
+}
+
+void FMultiplayerSessionsFakeSession::RegisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnRegisterLocalPlayerCompleteDelegate& Delegate)
+{
+	Delegate.ExecuteIfBound(PlayerId, EOnJoinSessionCompleteResult::Success);
+}
+
+void FMultiplayerSessionsFakeSession::UnregisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnUnregisterLocalPlayerCompleteDelegate& Delegate)
+{
+	Delegate.ExecuteIfBound(PlayerId, true);
+}
+
+void FMultiplayerSessionsFakeSession::RemovePlayerFromSession(int32 LocalUserNum, FName SessionName, const FUniqueNetId& TargetPlayerId)
+{
+	UnregisterPlayer(SessionName, TargetPlayerId);
+}
+
+int32 FMultiplayerSessionsFakeSession::GetNumSessions()
+{
+	return Sessions.Num();
+}
+
+void FMultiplayerSessionsFakeSession::DumpSessionState()
+{
+	for (const TUniquePtr<FNamedOnlineSession>& Session : Sessions)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Fake session %s: State=%s Hosting=%d Players=%d"), *Session->SessionName.ToString(), EOnlineSessionState::ToString(Session->SessionState), Session->bHosting == true ? 1 : 0, Session->RegisteredPlayers.Num());
+	}
+}
+
+FNamedOnlineSession* FMultiplayerSessionsFakeSession::AddNamedSession(FName SessionName, const FOnlineSessionSettings& SessionSettings)
+{
+	return Sessions.Add_GetRef(MakeUnique<FNamedOnlineSession>(SessionName, SessionSettings)).Get();
+}
+
+FNamedOnlineSession* FMultiplayerSessionsFakeSession::AddNamedSession(FName SessionName, const FOnlineSession& Session)
+{
+	return Sessions.Add_GetRef(MakeUnique<FNamedOnlineSession>(SessionName, Session)).Get();
+}
+
+namespace
+{
+	TWeakPtr<FMultiplayerSessionsFakeSession, ESPMode::ThreadSafe> ConsoleFakeSession;
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice FakeEnableCommand(
+		TEXT("ms.Fake.Enable"),
+		TEXT("Replaces the session interface with an in-process fake. Usage: ms.Fake.Enable [MinLatencyMs] [MaxLatencyMs] [FailureRate] [DropRate] [ResultCount] [Seed]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World);
+			if (Subsystem == nullptr)
+			{
+				Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+				return;
+			}
+
+			FMultiplayerSessionsFakeCallSettings CallSettings;
+			if (Args.Num() > 0)
+			{
+				CallSettings.MinLatencySeconds = FCString::Atof(*Args[0]) / 1000.0f;
+			}
+			if (Args.Num() > 1)
+			{
+				CallSettings.MaxLatencySeconds = FCString::Atof(*Args[1]) / 1000.0f;
+			}
+			if (Args.Num() > 2)
+			{
+				CallSettings.FailureRate = FCString::Atof(*Args[2]);
+			}
+			if (Args.Num() > 3)
+			{
+				CallSettings.DropRate = FCString::Atof(*Args[3]);
+			}
+
+			const int32 ResultCount = Args.Num() > 4 ? FCString::Atoi(*Args[4]) : 100;
+			const int32 Seed = Args.Num() > 5 ? FCString::Atoi(*Args[5]) : 0;
+
+			FMultiplayerSessionSearchRequest SearchRequest;
+			const TSharedRef<FMultiplayerSessionsFakeSession, ESPMode::ThreadSafe> FakeSession = MakeShared<FMultiplayerSessionsFakeSession, ESPMode::ThreadSafe>(Seed);
+			FakeSession->SetAllCallSettings(CallSettings);
+			FakeSession->SetSyntheticSearchResults(ResultCount, SearchRequest.DesiredMatchType, Subsystem->GetLocalCompatibilityBuildId(), FMath::Max(1, SearchRequest.DesiredSessionSchemaVersion));
+
+			if (Subsystem->SetSessionInterfaceOverride(FakeSession) == false)
+			{
+				Ar.Log(TEXT("Fake session interface not enabled: another session operation is running."));
+				return;
+			}
+
+			ConsoleFakeSession = FakeSession;
+			FakeSession->DumpFakeState(Ar);
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice FakeDisableCommand(
+		TEXT("ms.Fake.Disable"),
+		TEXT("Restores the online subsystem session interface."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World);
+			if (Subsystem == nullptr)
+			{
+				Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+				return;
+			}
+
+			if (Subsystem->SetSessionInterfaceOverride(nullptr) == false)
+			{
+				Ar.Log(TEXT("Fake session interface not disabled: another session operation is running."));
+				return;
+			}
+
+			ConsoleFakeSession.Reset();
+			Ar.Log(TEXT("Fake session interface disabled."));
+		}));
+
+	FAutoConsoleCommandWithOutputDevice FakeDumpCommand(
+		TEXT("ms.Fake.Dump"),
+		TEXT("Prints the fake session interface settings and call counters."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			const TSharedPtr<FMultiplayerSessionsFakeSession, ESPMode::ThreadSafe> FakeSession = ConsoleFakeSession.Pin();
+			if (FakeSession.IsValid() == false)
+			{
+				Ar.Log(TEXT("Fake session interface is not enabled."));
+				return;
+			}
+
+			FakeSession->DumpFakeState(Ar);
+		}));
+}
+
+#endif
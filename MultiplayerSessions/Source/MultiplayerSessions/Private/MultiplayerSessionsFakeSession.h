@@ -0,0 +1,155 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/OnlineSessionInterface.h"
+#include "OnlineSessionSettings.h"
+
+#if !UE_BUILD_SHIPPING
+
+enum class EMultiplayerSessionsFakeCall : uint8
+{
+	Create,
+	Find,
+	FindFriend,
+	Join,
+	Destroy,
+	Update,
+	Start,
+	End,
+	Count
+};
+
+struct FMultiplayerSessionsFakeCallSettings
+{
+	float MinLatencySeconds = 0.02f;
+	float MaxLatencySeconds = 0.2f;
+	float FailureRate = 0.0f;
+	float DropRate = 0.0f;
+	float LateRate = 0.0f;
+	float LateDelaySeconds = 30.0f;
+};
+
+struct FMultiplayerSessionsFakeCallCounters
+{
+	int32 Issued = 0;
+	int32 Rejected = 0;
+	int32 Completed = 0;
+	int32 Failed = 0;
+	int32 Dropped = 0;
+	int32 Late = 0;
+	int32 Cancelled = 0;
+};
+
+class FMultiplayerSessionsFakeSession : public IOnlineSession
+{
+public:
+	explicit FMultiplayerSessionsFakeSession(int32 InSeed = 0);
+	virtual ~FMultiplayerSessionsFakeSession();
+
+	void SetCallSettings(EMultiplayerSessionsFakeCall Call, const FMultiplayerSessionsFakeCallSettings& Settings);
+	void SetAllCallSettings(const FMultiplayerSessionsFakeCallSettings& Settings);
+	const FMultiplayerSessionsFakeCallSettings& GetCallSettings(EMultiplayerSessionsFakeCall Call) const;
+	void SetPreserveCompletionOrder(bool bInPreserveCompletionOrder);
+	void SetScriptedSearchResults(TArray<FOnlineSessionSearchResult>&& SearchResults);
+	void SetSyntheticSearchResults(int32 ResultCount, const FString& MatchType, int32 BuildId, int32 SessionSchemaVersion);
+	void SetConnectString(const FString& InConnectString);
+
+	const FMultiplayerSessionsFakeCallCounters& GetCallCounters(EMultiplayerSessionsFakeCall Call) const;
+	void ResetCallCounters();
+	int32 GetNumPendingCompletions() const;
+	int32 GetNumBoundDelegateLists() const;
+	SIZE_T GetDelegateAllocatedSize() const;
+	void DumpFakeState(FOutputDevice& Ar) const;
+	static const TCHAR* CallToString(EMultiplayerSessionsFakeCall Call);
+
+	virtual FUniqueNetIdPtr CreateSessionIdFromString(const FString& SessionIdStr) override;
+	virtual FNamedOnlineSession* GetNamedSession(FName SessionName) override;
+	virtual void RemoveNamedSession(FName SessionName) override;
+	virtual bool HasPresenceSession() override;
+	virtual EOnlineSessionState::Type GetSessionState(FName SessionName) const override;
+	virtual bool CreateSession(int32 HostingPlayerNum, FName SessionName, const FOnlineSessionSettings& NewSessionSettings) override;
+	virtual bool CreateSession(const FUniqueNetId& HostingPlayerId, FName SessionName, const FOnlineSessionSettings& NewSessionSettings) override;
+	virtual bool StartSession(FName SessionName) override;
+	virtual bool UpdateSession(FName SessionName, FOnlineSessionSettings& UpdatedSessionSettings, bool bShouldRefreshOnlineData = true) override;
+	virtual bool EndSession(FName SessionName) override;
+	virtual bool DestroySession(FName SessionName, const FOnDestroySessionCompleteDelegate& CompletionDelegate = FOnDestroySessionCompleteDelegate()) override;
+	virtual bool IsPlayerInSession(FName SessionName, const FUniqueNetId& UniqueId) override;
+	virtual bool StartMatchmaking(const TArray<FUniqueNetIdRef>& LocalPlayers, FName SessionName, const FOnlineSessionSettings& NewSessionSettings, TSharedRef<FOnlineSessionSearch>& SearchSettings) override;
+	virtual bool CancelMatchmaking(int32 SearchingPlayerNum, FName SessionName) override;
+	virtual bool CancelMatchmaking(const FUniqueNetId& SearchingPlayerId, FName SessionName) override;
+	virtual bool FindSessions(int32 SearchingPlayerNum, const TSharedRef<FOnlineSessionSearch>& SearchSettings) override;
+	virtual bool FindSessions(const FUniqueNetId& SearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& SearchSettings) override;
+	virtual bool FindSessionById(const FUniqueNetId& SearchingUserId, const FUniqueNetId& SessionId, const FUniqueNetId& FriendId, const FOnSingleSessionResultCompleteDelegate& CompletionDelegate) override;
+	virtual bool CancelFindSessions() override;
+	virtual bool PingSearchResults(const FOnlineSessionSearchResult& SearchResult) override;
+	virtual bool JoinSession(int32 LocalUserNum, FName SessionName, const FOnlineSessionSearchResult& DesiredSession) override;
+	virtual bool JoinSession(const FUniqueNetId& LocalUserId, FName SessionName, const FOnlineSessionSearchResult& DesiredSession) override;
+	virtual bool FindFriendSession(int32 LocalUserNum, const FUniqueNetId& Friend) override;
+	virtual bool FindFriendSession(const FUniqueNetId& LocalUserId, const FUniqueNetId& Friend) override;
+	virtual bool FindFriendSession(const FUniqueNetId& LocalUserId, const TArray<FUniqueNetIdRef>& FriendList) override;
+	virtual bool SendSessionInviteToFriend(int32 LocalUserNum, FName SessionName, const FUniqueNetId& Friend) override;
+	virtual bool SendSessionInviteToFriend(const FUniqueNetId& LocalUserId, FName SessionName, const FUniqueNetId& Friend) override;
+	virtual bool SendSessionInviteToFriends(int32 LocalUserNum, FName SessionName, const TArray<FUniqueNetIdRef>& Friends) override;
+	virtual bool SendSessionInviteToFriends(const FUniqueNetId& LocalUserId, FName SessionName, const TArray<FUniqueNetIdRef>& Friends) override;
+	virtual bool GetResolvedConnectString(FName SessionName, FString& ConnectInfo, FName PortType = NAME_GamePort) override;
+	virtual bool GetResolvedConnectString(const FOnlineSessionSearchResult& SearchResult, FName PortType, FString& ConnectInfo) override;
+	virtual FOnlineSessionSettings* GetSessionSettings(FName SessionName) override;
+	virtual bool RegisterPlayer(FName SessionName, const FUniqueNetId& PlayerId, bool bWasInvited) override;
+	virtual bool RegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players, bool bWasInvited = false) override;
+	virtual bool UnregisterPlayer(FName SessionName, const FUniqueNetId& PlayerId) override;
+	virtual bool UnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players) override;
+	virtual void RegisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnRegisterLocalPlayerCompleteDelegate& Delegate) override;
+	virtual void UnregisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnUnregisterLocalPlayerCompleteDelegate& Delegate) override;
+	virtual void RemovePlayerFromSession(int32 LocalUserNum, FName SessionName, const FUniqueNetId& TargetPlayerId) override;
+	virtual int32 GetNumSessions() override;
+	virtual void DumpSessionState() override;
+
+protected:
+	virtual FNamedOnlineSession* AddNamedSession(FName SessionName, const FOnlineSessionSettings& SessionSettings) override;
+	virtual FNamedOnlineSession* AddNamedSession(FName SessionName, const FOnlineSession& Session) override;
+
+private:
+	struct FPendingCompletion
+	{
+		uint64 Sequence = 0;
+		double DueSeconds = 0.0;
+		EMultiplayerSessionsFakeCall Call = EMultiplayerSessionsFakeCall::Count;
+		bool bSucceeded = true;
+		TFunction<void(bool)> Complete;
+	};
+
+	struct FDroppedCall
+	{
+		EMultiplayerSessionsFakeCall Call = EMultiplayerSessionsFakeCall::Count;
+		FName SessionName;
+	};
+
+	bool BeginCall(EMultiplayerSessionsFakeCall Call, FName SessionName, TFunction<void(bool)>&& Complete);
+	bool RemoveDroppedCall(EMultiplayerSessionsFakeCall Call, FName SessionName);
+	void CancelDroppedSessionCalls(FName SessionName);
+	bool Tick(float DeltaTime);
+	bool BeginCreateSession(FName SessionName, const FOnlineSessionSettings& NewSessionSettings);
+	bool BeginFindSessions(const TSharedRef<FOnlineSessionSearch>& SearchSettings);
+	bool BeginJoinSession(FName SessionName, const FOnlineSessionSearchResult& DesiredSession);
+	bool BeginFindFriendSession(int32 LocalUserNum);
+	EOnJoinSessionCompleteResult::Type PickJoinFailure();
+
+	FMultiplayerSessionsFakeCallSettings CallSettings[static_cast<int32>(EMultiplayerSessionsFakeCall::Count)];
+	FMultiplayerSessionsFakeCallCounters CallCounters[static_cast<int32>(EMultiplayerSessionsFakeCall::Count)];
+	TArray<FPendingCompletion> PendingCompletions;
+	TArray<FDroppedCall> DroppedCalls;
+	TArray<TUniquePtr<FNamedOnlineSession>> Sessions;
+	TArray<FOnlineSessionSearchResult> ScriptedSearchResults;
+	TSharedPtr<FOnlineSessionSearch> ActiveSearch;
+	FUniqueNetIdPtr FakeHostId;
+	FString ConnectString;
+	FRandomStream RandomStream;
+	FTSTicker::FDelegateHandle TickerHandle;
+	uint64 NextSequence = 0;
+	bool bPreserveCompletionOrder = false;
+};
+
+#endif
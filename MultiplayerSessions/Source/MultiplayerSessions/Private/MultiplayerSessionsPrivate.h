@@ -10,8 +10,23 @@ namespace MultiplayerSessionsKeys
 	inline const FName DisplayName(TEXT("SessionDisplayName"));
 	inline const FName HostDisplayName(TEXT("HostDisplayName"));
 	inline const FName MapName(TEXT("MapName"));
+	inline const FName RegionTag(TEXT("RegionTag"));
+	inline const FName PingProbePort(TEXT("PingProbePort"));
+	inline const FName SlotReservations(TEXT("SlotReservations"));
+	inline const FName ReservedSlots(TEXT("ReservedSlots"));
+	inline const FName JoinBusy(TEXT("JoinBusy"));
 	inline const FName Status(TEXT("SessionStatus"));
 	inline const FName BuildId(TEXT("BuildId"));
 	inline const FName SchemaVersion(TEXT("SessionSchemaVersion"));
 	inline const FName ConfiguredAllowJoinInProgress(TEXT("ConfiguredAllowJoinInProgress"));
+	inline const FName SessionName(TEXT("LocalSessionName"));
+	inline const FName GamePort(TEXT("GamePort"));
+}
+
+class UMultiplayerSessionsSubsystem;
+class UWorld;
+
+namespace MultiplayerSessionsConsole
+{
+	UMultiplayerSessionsSubsystem* FindSubsystem(UWorld* World);
 }
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "MultiplayerSessionsTypes.h"
+
+DECLARE_STATS_GROUP(TEXT("MultiplayerSessions"), STATGROUP_MultiplayerSessions, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Filter Results"), STAT_MultiplayerSessions_FilterResults, STATGROUP_MultiplayerSessions, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Entries"), STAT_MultiplayerSessions_BuildEntries, STATGROUP_MultiplayerSessions, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sort Entries"), STAT_MultiplayerSessions_SortEntries, STATGROUP_MultiplayerSessions, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("List Rebuild"), STAT_MultiplayerSessions_ListRebuild, STATGROUP_MultiplayerSessions, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Searches Issued"), STAT_MultiplayerSessions_SearchesIssued, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Raw Results"), STAT_MultiplayerSessions_RawResults, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Results Dropped (Relevance)"), STAT_MultiplayerSessions_ResultsDropped, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Entries Built"), STAT_MultiplayerSessions_EntriesBuilt, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Blocked: Incompatible Build"), STAT_MultiplayerSessions_BlockedIncompatibleBuild, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Blocked: Incompatible Schema"), STAT_MultiplayerSessions_BlockedIncompatibleSchema, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Blocked: Status Unavailable"), STAT_MultiplayerSessions_BlockedStatusUnavailable, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Blocked: Match Starting"), STAT_MultiplayerSessions_BlockedMatchStarting, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Blocked: Session Full"), STAT_MultiplayerSessions_BlockedSessionFull, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Blocked: Join In Progress Disabled"), STAT_MultiplayerSessions_BlockedJoinInProgressDisabled, STATGROUP_MultiplayerSessions, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Delegate Broadcasts/s"), STAT_MultiplayerSessions_BroadcastsPerSecond, STATGROUP_MultiplayerSessions, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Cached Search Bytes"), STAT_MultiplayerSessions_CachedBytes, STATGROUP_MultiplayerSessions, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Boot To Advertised (s)"), STAT_MultiplayerSessions_BootToAdvertisedSeconds, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Joins Delayed"), STAT_MultiplayerSessions_JoinsDelayed, STATGROUP_MultiplayerSessions, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Last Join Admission Delay (s)"), STAT_MultiplayerSessions_JoinAdmissionDelaySeconds, STATGROUP_MultiplayerSessions, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Host Join Arrivals/s"), STAT_MultiplayerSessions_HostJoinAttemptsPerSecond, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Host Busy Hints Raised"), STAT_MultiplayerSessions_HostBusyRaised, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LAN Beacons Received"), STAT_MultiplayerSessions_LanBeaconsReceived, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LAN Duplicate Beacons"), STAT_MultiplayerSessions_LanDuplicateBeacons, STATGROUP_MultiplayerSessions, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("LAN First Result (ms)"), STAT_MultiplayerSessions_LanFirstResultMs, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LAN Replies Sent"), STAT_MultiplayerSessions_LanRepliesSent, STATGROUP_MultiplayerSessions, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LAN Queries Dropped"), STAT_MultiplayerSessions_LanQueriesDropped, STATGROUP_MultiplayerSessions, );
+
+namespace MultiplayerSessionsStats
+{
+	inline void IncrementJoinBlockStat(EMultiplayerJoinBlockReason JoinBlockReason)
+	{
+		switch (JoinBlockReason)
+		{
+		case EMultiplayerJoinBlockReason::IncompatibleBuild:
+			INC_DWORD_STAT(STAT_MultiplayerSessions_BlockedIncompatibleBuild);
+			break;
+		case EMultiplayerJoinBlockReason::IncompatibleSchema:
+			INC_DWORD_STAT(STAT_MultiplayerSessions_BlockedIncompatibleSchema);
+			break;
+		case EMultiplayerJoinBlockReason::StatusUnavailable:
+			INC_DWORD_STAT(STAT_MultiplayerSessions_BlockedStatusUnavailable);
+			break;
+		case EMultiplayerJoinBlockReason::MatchStarting:
+			INC_DWORD_STAT(STAT_MultiplayerSessions_BlockedMatchStarting);
+			break;
+		case EMultiplayerJoinBlockReason::SessionFull:
+			INC_DWORD_STAT(STAT_MultiplayerSessions_BlockedSessionFull);
+			break;
+		case EMultiplayerJoinBlockReason::JoinInProgressDisabled:
+			INC_DWORD_STAT(STAT_MultiplayerSessions_BlockedJoinInProgressDisabled);
+			break;
+		default:
+			break;
+		}
+	}
+}
@@ -2,11 +2,14 @@
 
 #include "MultiplayerSessionsSubsystem.h"
 
+#include "MultiplayerSessionsDiagnostics.h"
+#include "MultiplayerSessionsTrace.h"
 #include "Containers/Ticker.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/LocalPlayer.h"
 #include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
 #include "GameFramework/OnlineReplStructs.h"
 #include "GameFramework/PlayerController.h"
 #include "Interfaces/OnlineExternalUIInterface.h"
@@ -30,6 +33,9 @@ void UMultiplayerSessionsSubsystem::Initialize(FSubsystemCollectionBase& Collect
 
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
 	EnsureSessionInterface(TEXT("Initialize"), FailureReason);
+	SetSessionScorer(nullptr);
+	OperationStats = MakeShared<FMultiplayerSessionOperationStats>(NumOperationTypes + 1, NumOperationSteps);
+	FlightRecorder = MakeShared<FMultiplayerSessionFlightRecorder>();
 
 	if (GEngine != nullptr)
 	{
@@ -37,7 +43,9 @@ void UMultiplayerSessionsSubsystem::Initialize(FSubsystemCollectionBase& Collect
 		TravelFailureDelegateHandle = GEngine->OnTravelFailure().AddUObject(this, &ThisClass::HandleTravelFailure);
 	}
 
+	bHeadlessHostPending = ShouldAutoStartHeadlessHost();
 	PostLoadMapDelegateHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &ThisClass::HandlePostLoadMap);
+	GameModePreLoginDelegateHandle = FGameModeEvents::GameModePreLoginEvent.AddUObject(this, &ThisClass::HandleGameModePreLogin);
 	OperationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickOperationTimeouts), 0.25f);
 }
 
@@ -49,16 +57,45 @@ void UMultiplayerSessionsSubsystem::Deinitialize()
 		GEngine->OnTravelFailure().Remove(TravelFailureDelegateHandle);
 	}
 
+	FTSTicker::GetCoreTicker().RemoveTicker(SoakTickerHandle);
+	SoakRun.Reset();
 	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapDelegateHandle);
+	FGameModeEvents::GameModePreLoginEvent.Remove(GameModePreLoginDelegateHandle);
 	FTSTicker::GetCoreTicker().RemoveTicker(OperationTickerHandle);
-
+	FTSTicker::GetCoreTicker().RemoveTicker(AutoRefreshTickerHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(HostRegistryTickerHandle);
+	HostRegistryTickerHandle.Reset();
+	FTSTicker::GetCoreTicker().RemoveTicker(SlotReservationTickerHandle);
+	SlotReservationTickerHandle.Reset();
+	FTSTicker::GetCoreTicker().RemoveTicker(LanDiscoveryTickerHandle);
+	LanDiscoveryTickerHandle.Reset();
+	bAutoRefreshActive = false;
+	bHeadlessHostPending = false;
+	bHeadlessHostCreating = false;
+	bHeadlessHostReady = false;
+	HeadlessHostBootToAdvertisedSeconds = -1.0f;
+	StopAllPingProbes();
+	StopPingResponder();
+	StopLanDiscoveryHost();
+
+	ReleaseRegisteredSessions();
 	ClearAllDelegateHandles();
 	CachedSearchResults.Reset();
 	CachedBrowserEntries.Reset();
-	ResetCommittedSessionState();
+	UpdateCachedSearchBytesStat();
+	ResetAllCommittedSessionState();
 	SessionInterface.Reset();
+	SessionInterfaceOverride.Reset();
 	CachedOnlineSubsystem = nullptr;
 	ActiveOperation = FOperationContext();
+	for (FLocalUserState& LocalUserState : LocalUserStates)
+	{
+		LocalUserState = FLocalUserState();
+	}
+	SearchOwnerLocalUserNum = INDEX_NONE;
+	OperationStats.Reset();
+	FlightRecorder.Reset();
+	SessionScorer = nullptr;
 
 	Super::Deinitialize();
 }
@@ -84,7 +121,7 @@ void UMultiplayerSessionsSubsystem::FindSessions(int32 MaxSearchResults, const F
 void UMultiplayerSessionsSubsystem::JoinSession(const FOnlineSessionSearchResult& SessionResult)
 {
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, nullptr, JoinTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, nullptr, GetTimeoutSeconds(EOperationTimeout::Join), FailureReason) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Join, FailureReason);
 		return;
@@ -136,7 +173,7 @@ bool UMultiplayerSessionsSubsystem::JoinByAddress(const FString& Address)
 	}
 
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::DirectTravel, EMultiplayerSessionFlowState::Traveling, nullptr, TravelTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::DirectTravel, EMultiplayerSessionFlowState::Traveling, nullptr, GetTimeoutSeconds(EOperationTimeout::Travel), FailureReason) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::DirectTravel, FailureReason);
 		return false;
@@ -158,8 +195,21 @@ void UMultiplayerSessionsSubsystem::CreateSessionFromRequest(const FMultiplayerS
 
 void UMultiplayerSessionsSubsystem::CreateSessionForLocalPlayer(ULocalPlayer* LocalPlayer, const FMultiplayerSessionCreateRequest& CreateRequest)
 {
+	CreateNamedSessionForLocalPlayer(LocalPlayer, NAME_GameSession, CreateRequest);
+}
+
+void UMultiplayerSessionsSubsystem::CreateNamedSessionForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName, const FMultiplayerSessionCreateRequest& CreateRequest)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		BroadcastImmediateFailureForOperation(EOperationType::Create, EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		return;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Create, EMultiplayerSessionFlowState::Creating, LocalPlayer, CreateTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Create, EMultiplayerSessionFlowState::Creating, LocalPlayer, GetTimeoutSeconds(EOperationTimeout::Create), FailureReason, SessionName) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Create, FailureReason);
 		return;
@@ -168,29 +218,13 @@ void UMultiplayerSessionsSubsystem::CreateSessionForLocalPlayer(ULocalPlayer* Lo
 	ActiveOperation.CreateRequest = CreateRequest;
 	SanitizeCreateRequest(ActiveOperation.CreateRequest);
 
-	const UWorld* World = GetWorld();
-	const bool bDedicatedServer = World != nullptr && World->GetNetMode() == NM_DedicatedServer;
-	if (bDedicatedServer == false && ActiveOperation.LocalUser.UniqueNetId.IsValid() == false && IsOnlineLoginRequired() == true && ActiveOperation.CreateRequest.bUseLan == false)
+	if (IsHeadlessProcess() == false && ActiveOperation.LocalUser.UniqueNetId.IsValid() == false && IsOnlineLoginRequired() == true && ActiveOperation.CreateRequest.bUseLan == false)
 	{
 		CompleteCreateOperation(false, EMultiplayerSessionFailureReason::NotLoggedIn);
 		return;
 	}
 
-	FNamedOnlineSession* ExistingSession = SessionInterface->GetNamedSession(NAME_GameSession);
-	if (ExistingSession != nullptr)
-	{
-		if (ActiveOperation.CreateRequest.bReplaceExistingSession == false)
-		{
-			CompleteCreateOperation(false, EMultiplayerSessionFailureReason::SessionAlreadyExists);
-			return;
-		}
-
-		ActiveOperation.Step = EOperationStep::DestroyExistingForCreate;
-		BeginDestroyOperation();
-		return;
-	}
-
-	BeginCreateOperation();
+	BeginCreateAfterExistingSessionCleanup();
 }
 
 void UMultiplayerSessionsSubsystem::FindSessionsFromRequest(const FMultiplayerSessionSearchRequest& SearchRequest)
@@ -200,13 +234,33 @@ void UMultiplayerSessionsSubsystem::FindSessionsFromRequest(const FMultiplayerSe
 
 void UMultiplayerSessionsSubsystem::FindSessionsForLocalPlayer(ULocalPlayer* LocalPlayer, const FMultiplayerSessionSearchRequest& SearchRequest)
 {
+	StartFindOperation(LocalPlayer, SearchRequest, false);
+}
+
+bool UMultiplayerSessionsSubsystem::StartFindOperation(ULocalPlayer* LocalPlayer, const FMultiplayerSessionSearchRequest& SearchRequest, bool bBackgroundRefresh)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		if (bBackgroundRefresh == false)
+		{
+			BroadcastImmediateFailureForOperation(EOperationType::Find, EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		}
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Find, EMultiplayerSessionFlowState::Finding, LocalPlayer, FindTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Find, EMultiplayerSessionFlowState::Finding, LocalPlayer, GetTimeoutSeconds(EOperationTimeout::Find), FailureReason) == false)
 	{
-		BroadcastImmediateFailureForOperation(EOperationType::Find, FailureReason);
-		return;
+		if (bBackgroundRefresh == false)
+		{
+			BroadcastImmediateFailureForOperation(EOperationType::Find, FailureReason);
+		}
+		return false;
 	}
 
+	ActiveOperation.bBackgroundRefresh = bBackgroundRefresh;
 	ActiveOperation.SearchRequest = SearchRequest;
 	SanitizeSearchRequest(ActiveOperation.SearchRequest);
 
@@ -215,10 +269,49 @@ void UMultiplayerSessionsSubsystem::FindSessionsForLocalPlayer(ULocalPlayer* Loc
 		TArray<FOnlineSessionSearchResult> EmptySearchResults;
 		TArray<FMultiplayerSessionBrowserEntry> EmptyBrowserEntries;
 		CompleteFindOperation(false, EMultiplayerSessionFailureReason::NotLoggedIn, MoveTemp(EmptySearchResults), MoveTemp(EmptyBrowserEntries));
-		return;
+		return false;
 	}
 
 	BeginFindOperation();
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::CancelFindSessions()
+{
+	if (ActiveOperation.Type != EOperationType::Find || ActiveOperation.Step != EOperationStep::Executing)
+	{
+		return false;
+	}
+
+	const bool bOwnsSearch = SearchOwnerLocalUserNum == BoundLocalUserNum;
+	ClearOperationDelegate(EOperationType::Find);
+	if (bOwnsSearch == true && SessionInterface.IsValid() == true)
+	{
+		SessionInterface->CancelFindSessions();
+	}
+
+	if (ActiveOperation.QuickMatch.bActive == true)
+	{
+		CompleteQuickMatchOperation(EMultiplayerSessionFailureReason::Cancelled);
+		return true;
+	}
+
+	TArray<FOnlineSessionSearchResult> EmptySearchResults;
+	TArray<FMultiplayerSessionBrowserEntry> EmptyBrowserEntries;
+	CompleteFindOperation(false, EMultiplayerSessionFailureReason::Cancelled, MoveTemp(EmptySearchResults), MoveTemp(EmptyBrowserEntries));
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::CancelFindSessionsForLocalPlayer(ULocalPlayer* LocalPlayer)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+	return CancelFindSessions();
 }
 
 bool UMultiplayerSessionsSubsystem::JoinSessionBySearchResultIndex(int32 SearchResultIndex)
@@ -249,13 +342,13 @@ bool UMultiplayerSessionsSubsystem::JoinSessionBySearchResultIndex(int32 SearchR
 	}
 
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, nullptr, JoinTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, nullptr, GetTimeoutSeconds(EOperationTimeout::Join), FailureReason) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Join, FailureReason);
 		return false;
 	}
 
-	ActiveOperation.JoinResult = CachedSearchResults[SearchResultIndex];
+	ActiveOperation.JoinCachedResultIndex = SearchResultIndex;
 	BeginJoinAfterExistingSessionCleanup();
 	return ActiveOperation.Type == EOperationType::Join;
 }
@@ -267,13 +360,34 @@ bool UMultiplayerSessionsSubsystem::JoinSessionByEntryId(const FString& EntryId)
 
 bool UMultiplayerSessionsSubsystem::JoinSessionByEntryIdForLocalPlayer(ULocalPlayer* LocalPlayer, const FString& EntryId)
 {
+	return JoinNamedSessionByEntryIdForLocalPlayer(LocalPlayer, NAME_GameSession, EntryId);
+}
+
+bool UMultiplayerSessionsSubsystem::JoinNamedSessionByEntryIdForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName, const FString& EntryId)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		BroadcastImmediateFailureForOperation(EOperationType::Join, EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
 	const int32 SearchResultIndex = FindCachedSearchResultIndexByEntryId(EntryId);
-	if (SearchResultIndex == INDEX_NONE)
+	if (SearchResultIndex == INDEX_NONE || CachedSearchResults.IsValidIndex(SearchResultIndex) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Join, EMultiplayerSessionFailureReason::InvalidSearchResultIndex);
 		return false;
 	}
 
+	const FName AdvertisedSessionName = ResolveSessionNameForResult(CachedSearchResults[SearchResultIndex]);
+	if (AdvertisedSessionName != SessionName)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Join into %s rejected. The entry advertises %s."), *SessionName.ToString(), *AdvertisedSessionName.ToString());
+		BroadcastImmediateFailureForOperation(EOperationType::Join, EMultiplayerSessionFailureReason::SessionNameMismatch);
+		return false;
+	}
+
 	if (CachedBrowserEntries.IsValidIndex(SearchResultIndex) == true)
 	{
 		const FMultiplayerSessionBrowserEntry& BrowserEntry = CachedBrowserEntries[SearchResultIndex];
@@ -289,14 +403,14 @@ bool UMultiplayerSessionsSubsystem::JoinSessionByEntryIdForLocalPlayer(ULocalPla
 	}
 
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, LocalPlayer, JoinTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, LocalPlayer, GetTimeoutSeconds(EOperationTimeout::Join), FailureReason, SessionName) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Join, FailureReason);
 		return false;
 	}
 
-	ActiveOperation.JoinResult = CachedSearchResults[SearchResultIndex];
-	if (ActiveOperation.LocalUser.UniqueNetId.IsValid() == false && IsOnlineLoginRequired() == true && ActiveOperation.JoinResult.Session.SessionSettings.bIsLANMatch == false)
+	ActiveOperation.JoinCachedResultIndex = SearchResultIndex;
+	if (ActiveOperation.LocalUser.UniqueNetId.IsValid() == false && IsOnlineLoginRequired() == true && GetJoinSearchResult().Session.SessionSettings.bIsLANMatch == false)
 	{
 		CompleteJoinOperation(EOnJoinSessionCompleteResult::UnknownError, EMultiplayerJoinSessionResult::UnknownError, EMultiplayerSessionFailureReason::NotLoggedIn);
 		return false;
@@ -313,6 +427,20 @@ bool UMultiplayerSessionsSubsystem::SendSessionInviteToFriend(const FUniqueNetId
 
 bool UMultiplayerSessionsSubsystem::SendSessionInviteToFriendForLocalPlayer(ULocalPlayer* LocalPlayer, const FUniqueNetIdRepl& FriendId)
 {
+	return SendNamedSessionInviteToFriendForLocalPlayer(LocalPlayer, NAME_GameSession, FriendId);
+}
+
+bool UMultiplayerSessionsSubsystem::SendNamedSessionInviteToFriendForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName, const FUniqueNetIdRepl& FriendId)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		SetLastFailureReason(EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		OnSessionInviteSent.Broadcast(false, EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
 	if (EnsureSessionInterface(TEXT("SendSessionInviteToFriend"), FailureReason) == false)
 	{
@@ -338,7 +466,7 @@ bool UMultiplayerSessionsSubsystem::SendSessionInviteToFriendForLocalPlayer(ULoc
 		return false;
 	}
 
-	const FNamedOnlineSession* HostedSession = SessionInterface->GetNamedSession(NAME_GameSession);
+	const FNamedOnlineSession* HostedSession = SessionInterface->GetNamedSession(SessionName);
 	if (HostedSession == nullptr || HostedSession->SessionSettings.bIsLANMatch == true || HostedSession->SessionSettings.bAllowInvites == false)
 	{
 		FailureReason = EMultiplayerSessionFailureReason::InviteFailed;
@@ -355,7 +483,7 @@ bool UMultiplayerSessionsSubsystem::SendSessionInviteToFriendForLocalPlayer(ULoc
 		return false;
 	}
 
-	const bool bInviteSent = SessionInterface->SendSessionInviteToFriend(LocalUser.LocalUserNum, NAME_GameSession, *FriendUniqueNetId);
+	const bool bInviteSent = SessionInterface->SendSessionInviteToFriend(LocalUser.LocalUserNum, SessionName, *FriendUniqueNetId);
 
 	if (bInviteSent == false)
 	{
@@ -374,6 +502,20 @@ bool UMultiplayerSessionsSubsystem::ShowPlatformInviteUI()
 
 bool UMultiplayerSessionsSubsystem::ShowPlatformInviteUIForLocalPlayer(ULocalPlayer* LocalPlayer)
 {
+	return ShowNamedSessionInviteUIForLocalPlayer(LocalPlayer, NAME_GameSession);
+}
+
+bool UMultiplayerSessionsSubsystem::ShowNamedSessionInviteUIForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		SetLastFailureReason(EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		OnPlatformInviteUIOpened.Broadcast(false, EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
 	if (EnsureSessionInterface(TEXT("ShowPlatformInviteUI"), FailureReason) == false)
 	{
@@ -390,7 +532,7 @@ bool UMultiplayerSessionsSubsystem::ShowPlatformInviteUIForLocalPlayer(ULocalPla
 		return false;
 	}
 
-	const FNamedOnlineSession* HostedSession = SessionInterface->GetNamedSession(NAME_GameSession);
+	const FNamedOnlineSession* HostedSession = SessionInterface->GetNamedSession(SessionName);
 	if (HostedSession == nullptr || HostedSession->SessionSettings.bIsLANMatch == true || HostedSession->SessionSettings.bAllowInvites == false)
 	{
 		FailureReason = EMultiplayerSessionFailureReason::InviteFailed;
@@ -416,7 +558,7 @@ bool UMultiplayerSessionsSubsystem::ShowPlatformInviteUIForLocalPlayer(ULocalPla
 		return false;
 	}
 
-	const bool bWasOpened = ExternalUIInterface->ShowInviteUI(LocalUser.LocalUserNum, NAME_GameSession);
+	const bool bWasOpened = ExternalUIInterface->ShowInviteUI(LocalUser.LocalUserNum, SessionName);
 	if (bWasOpened == false)
 	{
 		FailureReason = EMultiplayerSessionFailureReason::PlatformUiUnavailable;
@@ -434,8 +576,16 @@ bool UMultiplayerSessionsSubsystem::JoinFriendSession(const FUniqueNetIdRepl& Fr
 
 bool UMultiplayerSessionsSubsystem::JoinFriendSessionForLocalPlayer(ULocalPlayer* LocalPlayer, const FUniqueNetIdRepl& FriendId)
 {
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		BroadcastImmediateFailureForOperation(EOperationType::FindFriend, EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::FindFriend, EMultiplayerSessionFlowState::Finding, LocalPlayer, FindTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::FindFriend, EMultiplayerSessionFlowState::Finding, LocalPlayer, GetTimeoutSeconds(EOperationTimeout::Find), FailureReason) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::FindFriend, FailureReason);
 		return false;
@@ -465,8 +615,21 @@ bool UMultiplayerSessionsSubsystem::LeaveCurrentSession()
 
 bool UMultiplayerSessionsSubsystem::LeaveCurrentSessionForLocalPlayer(ULocalPlayer* LocalPlayer)
 {
+	return LeaveNamedSessionForLocalPlayer(LocalPlayer, NAME_GameSession);
+}
+
+bool UMultiplayerSessionsSubsystem::LeaveNamedSessionForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		BroadcastImmediateFailureForOperation(EOperationType::Destroy, EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Destroy, EMultiplayerSessionFlowState::Destroying, LocalPlayer, DestroyTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Destroy, EMultiplayerSessionFlowState::Destroying, LocalPlayer, GetTimeoutSeconds(EOperationTimeout::Destroy), FailureReason, SessionName) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Destroy, FailureReason);
 		return false;
@@ -477,9 +640,14 @@ bool UMultiplayerSessionsSubsystem::LeaveCurrentSessionForLocalPlayer(ULocalPlay
 }
 
 void UMultiplayerSessionsSubsystem::UpdateHostedSessionStatus(EMultiplayerAdvertisedSessionStatus NewStatus)
+{
+	UpdateNamedSessionStatus(NAME_GameSession, NewStatus);
+}
+
+void UMultiplayerSessionsSubsystem::UpdateNamedSessionStatus(FName SessionName, EMultiplayerAdvertisedSessionStatus NewStatus)
 {
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Update, EMultiplayerSessionFlowState::Updating, nullptr, UpdateTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Update, EMultiplayerSessionFlowState::Updating, nullptr, GetTimeoutSeconds(EOperationTimeout::Update), FailureReason, SessionName) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Update, FailureReason);
 		return;
@@ -490,9 +658,14 @@ void UMultiplayerSessionsSubsystem::UpdateHostedSessionStatus(EMultiplayerAdvert
 }
 
 void UMultiplayerSessionsSubsystem::StartHostedSession()
+{
+	StartNamedSession(NAME_GameSession);
+}
+
+void UMultiplayerSessionsSubsystem::StartNamedSession(FName SessionName)
 {
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Start, EMultiplayerSessionFlowState::Starting, nullptr, StartEndTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Start, EMultiplayerSessionFlowState::Starting, nullptr, GetTimeoutSeconds(EOperationTimeout::StartEnd), FailureReason, SessionName) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::Start, FailureReason);
 		return;
@@ -502,9 +675,14 @@ void UMultiplayerSessionsSubsystem::StartHostedSession()
 }
 
 void UMultiplayerSessionsSubsystem::EndHostedSession()
+{
+	EndNamedSession(NAME_GameSession);
+}
+
+void UMultiplayerSessionsSubsystem::EndNamedSession(FName SessionName)
 {
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::End, EMultiplayerSessionFlowState::Ending, nullptr, StartEndTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::End, EMultiplayerSessionFlowState::Ending, nullptr, GetTimeoutSeconds(EOperationTimeout::StartEnd), FailureReason, SessionName) == false)
 	{
 		BroadcastImmediateFailureForOperation(EOperationType::End, FailureReason);
 		return;
@@ -514,13 +692,24 @@ void UMultiplayerSessionsSubsystem::EndHostedSession()
 }
 
 bool UMultiplayerSessionsSubsystem::HasNamedSession() const
+{
+	return HasSessionNamed(NAME_GameSession);
+}
+
+bool UMultiplayerSessionsSubsystem::HasSessionNamed(FName SessionName) const
 {
 	if (SessionInterface.IsValid() == false)
 	{
 		return false;
 	}
 
-	return SessionInterface->GetNamedSession(NAME_GameSession) != nullptr;
+	return SessionInterface->GetNamedSession(SessionName) != nullptr;
+}
+
+bool UMultiplayerSessionsSubsystem::OwnsSessionNamed(FName SessionName) const
+{
+	const FNamedSessionState* NamedSessionState = NamedSessionStates.Find(SessionName);
+	return NamedSessionState != nullptr && NamedSessionState->bOwnsNamedSession == true;
 }
 
 int32 UMultiplayerSessionsSubsystem::GetLocalCompatibilityBuildId() const
@@ -530,7 +719,8 @@ int32 UMultiplayerSessionsSubsystem::GetLocalCompatibilityBuildId() const
 
 void UMultiplayerSessionsSubsystem::OnCreateSessionCompleteInternal(FName SessionName, bool bWasSuccessful, uint64 CallbackGeneration)
 {
-	if (IsCurrentOperation(CallbackGeneration, EOperationType::Create, EOperationStep::Executing) == false)
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
+	if (IsCurrentOperation(CallbackGeneration, EOperationType::Create, EOperationStep::Executing) == false || SessionName != ActiveOperation.SessionName)
 	{
 		return;
 	}
@@ -539,10 +729,11 @@ void UMultiplayerSessionsSubsystem::OnCreateSessionCompleteInternal(FName Sessio
 
 	if (bWasSuccessful == true)
 	{
-		CommittedSessionSettings = ActiveOperation.PendingSessionSettings;
-		bOwnsNamedSession = true;
-		bHasCommittedJoinInProgressPolicy = true;
-		bCommittedAllowJoinInProgress = ActiveOperation.CreateRequest.bAllowJoinInProgress;
+		FNamedSessionState& NamedSessionState = GetNamedSessionState(ActiveOperation.SessionName);
+		NamedSessionState.CommittedSessionSettings = ActiveOperation.PendingSessionSettings;
+		NamedSessionState.bOwnsNamedSession = true;
+		NamedSessionState.bHasCommittedJoinInProgressPolicy = true;
+		NamedSessionState.bCommittedAllowJoinInProgress = ActiveOperation.CreateRequest.bAllowJoinInProgress;
 		CompleteCreateOperation(true, EMultiplayerSessionFailureReason::None);
 		return;
 	}
@@ -554,6 +745,8 @@ void UMultiplayerSessionsSubsystem::OnCreateSessionCompleteInternal(FName Sessio
 
 void UMultiplayerSessionsSubsystem::OnFindSessionsCompleteInternal(bool bWasSuccessful, uint64 CallbackGeneration)
 {
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_OnFindSessionsComplete);
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
 	if (IsCurrentOperation(CallbackGeneration, EOperationType::Find, EOperationStep::Executing) == false)
 	{
 		return;
@@ -570,27 +763,13 @@ void UMultiplayerSessionsSubsystem::OnFindSessionsCompleteInternal(bool bWasSucc
 		return;
 	}
 
-	for (const FOnlineSessionSearchResult& SearchResult : ActiveOperation.PendingSearch->SearchResults)
-	{
-		if (IsSearchResultRelevantToRequest(SearchResult, ActiveOperation.SearchRequest) == false)
-		{
-			continue;
-		}
-
-		NewSearchResults.Add(SearchResult);
-	}
-
-	for (int32 SearchResultIndex = 0; SearchResultIndex < NewSearchResults.Num(); SearchResultIndex++)
-	{
-		NewBrowserEntries.Add(BuildBrowserEntry(NewSearchResults[SearchResultIndex], SearchResultIndex, ActiveOperation.SearchRequest));
-	}
-
-	SortSearchResultsAndBrowserEntries(NewSearchResults, NewBrowserEntries);
+	BuildBrowserResultsFromPendingSearch(NewSearchResults, NewBrowserEntries);
 	CompleteFindOperation(true, EMultiplayerSessionFailureReason::None, MoveTemp(NewSearchResults), MoveTemp(NewBrowserEntries));
 }
 
 void UMultiplayerSessionsSubsystem::OnFindFriendSessionCompleteInternal(int32 LocalUserNum, bool bWasSuccessful, const TArray<FOnlineSessionSearchResult>& SearchResults, uint64 CallbackGeneration)
 {
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
 	if (IsCurrentOperation(CallbackGeneration, EOperationType::FindFriend, EOperationStep::Executing) == false)
 	{
 		return;
@@ -634,17 +813,19 @@ void UMultiplayerSessionsSubsystem::OnFindFriendSessionCompleteInternal(int32 Lo
 
 	ActiveOperation.Type = EOperationType::Join;
 	ActiveOperation.JoinResult = *FriendSessionResult;
+	ActiveOperation.SessionName = ResolveSessionNameForResult(*FriendSessionResult);
 	ActiveOperation.FriendId.Reset();
 	SetLastFailureReason(EMultiplayerSessionFailureReason::None);
 	OnFriendSessionSearchCompleted.Broadcast(true, EMultiplayerSessionFailureReason::None);
 	SetFlowState(EMultiplayerSessionFlowState::Joining);
-	SetOperationStep(EOperationStep::Executing, JoinTimeoutSeconds);
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Join));
 	BeginJoinAfterExistingSessionCleanup();
 }
 
 void UMultiplayerSessionsSubsystem::OnSessionUserInviteAcceptedInternal(bool bWasSuccessful, int32 LocalUserNum, FUniqueNetIdPtr UserId, const FOnlineSessionSearchResult& InviteResult)
 {
 	(void)UserId;
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum >= 0 && LocalUserNum < MaxLocalUsers ? LocalUserNum : 0);
 
 	if (bWasSuccessful == false || InviteResult.IsValid() == false)
 	{
@@ -673,7 +854,7 @@ void UMultiplayerSessionsSubsystem::OnSessionUserInviteAcceptedInternal(bool bWa
 	}
 
 	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
-	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, LocalPlayer, JoinTimeoutSeconds, FailureReason) == false)
+	if (TryBeginOperation(EOperationType::Join, EMultiplayerSessionFlowState::Joining, LocalPlayer, GetTimeoutSeconds(EOperationTimeout::Join), FailureReason, ResolveSessionNameForResult(InviteResult)) == false)
 	{
 		SetLastFailureReason(FailureReason);
 		OnSessionInviteAccepted.Broadcast(false, FailureReason);
@@ -698,6 +879,7 @@ void UMultiplayerSessionsSubsystem::OnSessionUserInviteAcceptedInternal(bool bWa
 
 void UMultiplayerSessionsSubsystem::OnJoinSessionCompleteInternal(FName SessionName, EOnJoinSessionCompleteResult::Type Result, uint64 CallbackGeneration)
 {
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
 	if (IsCurrentOperation(CallbackGeneration, EOperationType::Join, EOperationStep::Executing) == false)
 	{
 		return;
@@ -711,8 +893,14 @@ void UMultiplayerSessionsSubsystem::OnJoinSessionCompleteInternal(FName SessionN
 		return;
 	}
 
+	if (ActiveOperation.SessionName != NAME_GameSession)
+	{
+		CompleteJoinOperation(EOnJoinSessionCompleteResult::Success, EMultiplayerJoinSessionResult::Success, EMultiplayerSessionFailureReason::None);
+		return;
+	}
+
 	FString ConnectString;
-	if (SessionInterface.IsValid() == false || SessionInterface->GetResolvedConnectString(NAME_GameSession, ConnectString) == false || ConnectString.IsEmpty() == true)
+	if (SessionInterface.IsValid() == false || SessionInterface->GetResolvedConnectString(ActiveOperation.SessionName, ConnectString) == false || ConnectString.IsEmpty() == true)
 	{
 		if (ActiveOperation.bResultBroadcast == false)
 		{
@@ -726,6 +914,7 @@ void UMultiplayerSessionsSubsystem::OnJoinSessionCompleteInternal(FName SessionN
 		return;
 	}
 
+	ApplyAdvertisedGamePort(ActiveOperation.SessionName, ConnectString);
 	if (BeginTravel(ConnectString) == false)
 	{
 		HandleTravelFailureInternal(EMultiplayerSessionFailureReason::TravelFailed);
@@ -737,7 +926,8 @@ void UMultiplayerSessionsSubsystem::OnJoinSessionCompleteInternal(FName SessionN
 
 void UMultiplayerSessionsSubsystem::OnDestroySessionCompleteInternal(FName SessionName, bool bWasSuccessful, uint64 CallbackGeneration)
 {
-	if (CallbackGeneration != ActiveOperation.Generation)
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
+	if (CallbackGeneration != ActiveOperation.Generation || SessionName != ActiveOperation.SessionName)
 	{
 		return;
 	}
@@ -748,7 +938,7 @@ void UMultiplayerSessionsSubsystem::OnDestroySessionCompleteInternal(FName Sessi
 	{
 		ClearOperationDelegate(EOperationType::Destroy);
 
-		const bool bSessionNoLongerExists = SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(NAME_GameSession) == nullptr;
+		const bool bSessionNoLongerExists = SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(ActiveOperation.SessionName) == nullptr;
 		if (bWasSuccessful == false && bSessionNoLongerExists == false)
 		{
 			if (bCreateContinuation == true)
@@ -762,7 +952,7 @@ void UMultiplayerSessionsSubsystem::OnDestroySessionCompleteInternal(FName Sessi
 			return;
 		}
 
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 		if (bCreateContinuation == true)
 		{
 			BeginCreateOperation();
@@ -783,15 +973,15 @@ void UMultiplayerSessionsSubsystem::OnDestroySessionCompleteInternal(FName Sessi
 
 	if (bWasSuccessful == true)
 	{
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 		CompleteDestroyOperation(true, EMultiplayerSessionFailureReason::None);
 		return;
 	}
 
-	const bool bSessionNoLongerExists = SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(NAME_GameSession) == nullptr;
+	const bool bSessionNoLongerExists = SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(ActiveOperation.SessionName) == nullptr;
 	if (bSessionNoLongerExists == true)
 	{
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 		CompleteDestroyOperation(true, EMultiplayerSessionFailureReason::None);
 		return;
 	}
@@ -802,7 +992,8 @@ void UMultiplayerSessionsSubsystem::OnDestroySessionCompleteInternal(FName Sessi
 
 void UMultiplayerSessionsSubsystem::OnUpdateSessionCompleteInternal(FName SessionName, bool bWasSuccessful, uint64 CallbackGeneration)
 {
-	if (IsCurrentOperation(CallbackGeneration, EOperationType::Update, EOperationStep::Executing) == false)
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
+	if (IsCurrentOperation(CallbackGeneration, EOperationType::Update, EOperationStep::Executing) == false || SessionName != ActiveOperation.SessionName)
 	{
 		return;
 	}
@@ -811,7 +1002,7 @@ void UMultiplayerSessionsSubsystem::OnUpdateSessionCompleteInternal(FName Sessio
 
 	if (bWasSuccessful == true)
 	{
-		CommittedSessionSettings = ActiveOperation.PendingSessionSettings;
+		GetNamedSessionState(ActiveOperation.SessionName).CommittedSessionSettings = ActiveOperation.PendingSessionSettings;
 		CompleteUpdateOperation(true, EMultiplayerSessionFailureReason::None);
 		return;
 	}
@@ -822,6 +1013,7 @@ void UMultiplayerSessionsSubsystem::OnUpdateSessionCompleteInternal(FName Sessio
 
 void UMultiplayerSessionsSubsystem::OnStartSessionCompleteInternal(FName SessionName, bool bWasSuccessful, uint64 CallbackGeneration)
 {
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
 	if (IsCurrentOperation(CallbackGeneration, EOperationType::Start, EOperationStep::Executing) == false)
 	{
 		return;
@@ -841,6 +1033,7 @@ void UMultiplayerSessionsSubsystem::OnStartSessionCompleteInternal(FName Session
 
 void UMultiplayerSessionsSubsystem::OnEndSessionCompleteInternal(FName SessionName, bool bWasSuccessful, uint64 CallbackGeneration)
 {
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
 	if (IsCurrentOperation(CallbackGeneration, EOperationType::End, EOperationStep::Executing) == false)
 	{
 		return;
@@ -860,6 +1053,7 @@ void UMultiplayerSessionsSubsystem::OnEndSessionCompleteInternal(FName SessionNa
 
 void UMultiplayerSessionsSubsystem::OnRecoveryDestroyCompleteInternal(FName SessionName, bool bWasSuccessful, uint64 CallbackGeneration)
 {
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumForGeneration(CallbackGeneration));
 	if (CallbackGeneration != ActiveOperation.Generation || ActiveOperation.Step != EOperationStep::RecoveryDestroy)
 	{
 		return;
@@ -868,10 +1062,10 @@ void UMultiplayerSessionsSubsystem::OnRecoveryDestroyCompleteInternal(FName Sess
 	ClearOperationDelegate(EOperationType::Destroy);
 	RecoveryDestroyCompleteDelegateHandle = FDelegateHandle();
 
-	const bool bSessionNoLongerExists = SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(NAME_GameSession) == nullptr;
+	const bool bSessionNoLongerExists = SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(ActiveOperation.SessionName) == nullptr;
 	if (bWasSuccessful == true || bSessionNoLongerExists == true)
 	{
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 		CompleteRecovery(true);
 		return;
 	}
@@ -888,7 +1082,9 @@ void UMultiplayerSessionsSubsystem::HandleNetworkFailure(UWorld* World, UNetDriv
 		return;
 	}
 
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumInStep(EOperationStep::WaitingForTravel));
 	UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Network failure. Type=%d Error=%s"), static_cast<int32>(FailureType), *ErrorString);
+	RecordFlightEvent(EMultiplayerSessionFlightEvent::NetworkFailure, EMultiplayerSessionFailureReason::None);
 
 	if (ActiveOperation.Step == EOperationStep::WaitingForTravel)
 	{
@@ -912,7 +1108,9 @@ void UMultiplayerSessionsSubsystem::HandleTravelFailure(UWorld* World, ETravelFa
 		return;
 	}
 
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumInStep(EOperationStep::WaitingForTravel));
 	UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Travel failure. Type=%d Error=%s"), static_cast<int32>(FailureType), *ErrorString);
+	RecordFlightEvent(EMultiplayerSessionFlightEvent::TravelFailure, EMultiplayerSessionFailureReason::None);
 
 	if (ActiveOperation.Step == EOperationStep::WaitingForTravel)
 	{
@@ -936,6 +1134,14 @@ void UMultiplayerSessionsSubsystem::HandlePostLoadMap(UWorld* LoadedWorld)
 		return;
 	}
 
+	if (bHeadlessHostPending == true && LoadedWorld->GetNetMode() == NM_DedicatedServer)
+	{
+		bHeadlessHostPending = false;
+		StartHeadlessHost();
+		return;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, FindLocalUserNumInStep(EOperationStep::WaitingForTravel));
 	if (ActiveOperation.Step != EOperationStep::WaitingForTravel)
 	{
 		return;
@@ -962,6 +1168,20 @@ bool UMultiplayerSessionsSubsystem::EnsureSessionInterface(const TCHAR* Context,
 {
 	OutFailureReason = EMultiplayerSessionFailureReason::None;
 
+	if (SessionInterfaceOverride.IsValid() == true)
+	{
+		if (SessionInterface != SessionInterfaceOverride)
+		{
+			ReleaseRegisteredSessions();
+			ClearAllDelegateHandles();
+			ResetAllCommittedSessionState();
+			SessionInterface = SessionInterfaceOverride;
+		}
+
+		RegisterPersistentSessionDelegates();
+		return true;
+	}
+
 	IOnlineSubsystem* OnlineSubsystem = nullptr;
 	UWorld* World = GetWorld();
 	if (World != nullptr)
@@ -983,8 +1203,9 @@ bool UMultiplayerSessionsSubsystem::EnsureSessionInterface(const TCHAR* Context,
 
 	if (CachedOnlineSubsystem != OnlineSubsystem)
 	{
+		ReleaseRegisteredSessions();
 		ClearAllDelegateHandles();
-		ResetCommittedSessionState();
+		ResetAllCommittedSessionState();
 		SessionInterface.Reset();
 		CachedOnlineSubsystem = OnlineSubsystem;
 	}
@@ -1005,6 +1226,63 @@ bool UMultiplayerSessionsSubsystem::EnsureSessionInterface(const TCHAR* Context,
 	return true;
 }
 
+#if !UE_BUILD_SHIPPING
+bool UMultiplayerSessionsSubsystem::SetSessionInterfaceOverride(IOnlineSessionPtr NewSessionInterface)
+{
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		if (GetLocalUserOperation(LocalUserNum).Type != EOperationType::None)
+		{
+			return false;
+		}
+	}
+
+	if (GetRegisteredSessionCallsInFlight() > 0)
+	{
+		return false;
+	}
+
+	StopAllPingProbes();
+	ReleaseRegisteredSessions();
+	ClearAllDelegateHandles();
+	ResetAllCommittedSessionState();
+	SessionInterface.Reset();
+	CachedOnlineSubsystem = nullptr;
+	SessionInterfaceOverride = NewSessionInterface;
+
+	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
+	EnsureSessionInterface(TEXT("SetSessionInterfaceOverride"), FailureReason);
+	UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Session interface override %s."), SessionInterfaceOverride.IsValid() == true ? TEXT("enabled") : TEXT("cleared"));
+
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+		FMultiplayerSessionBrowserChangeSet ChangeSet;
+		if (OnBrowserEntriesChanged.IsBound() == true)
+		{
+			BuildBrowserChangeSet(CachedBrowserEntries, TArray<FMultiplayerSessionBrowserEntry>(), ChangeSet);
+		}
+
+		CachedSearchResults.Reset();
+		CachedBrowserEntries.Reset();
+		UpdateCachedSearchBytesStat();
+
+		const uint64 PublishCount = ++BrowserEntriesPublishCount;
+		OnBrowserEntriesUpdated.Broadcast(CachedBrowserEntries);
+		if (BrowserEntriesPublishCount == PublishCount && ChangeSet.IsEmpty() == false)
+		{
+			OnBrowserEntriesChanged.Broadcast(CachedBrowserEntries, ChangeSet);
+		}
+	}
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::HasSessionInterfaceOverride() const
+{
+	return SessionInterfaceOverride.IsValid() == true;
+}
+#endif
+
 void UMultiplayerSessionsSubsystem::RegisterPersistentSessionDelegates()
 {
 	if (SessionInterface.IsValid() == false || SessionInviteAcceptedDelegateHandle.IsValid() == true)
@@ -1014,6 +1292,10 @@ void UMultiplayerSessionsSubsystem::RegisterPersistentSessionDelegates()
 
 	const FOnSessionUserInviteAcceptedDelegate InviteAcceptedDelegate = FOnSessionUserInviteAcceptedDelegate::CreateUObject(this, &ThisClass::OnSessionUserInviteAcceptedInternal);
 	SessionInviteAcceptedDelegateHandle = SessionInterface->AddOnSessionUserInviteAcceptedDelegate_Handle(InviteAcceptedDelegate);
+	RegisteredCreateCompleteDelegateHandle = SessionInterface->AddOnCreateSessionCompleteDelegate_Handle(FOnCreateSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnRegisteredSessionCreateComplete));
+	RegisteredUpdateCompleteDelegateHandle = SessionInterface->AddOnUpdateSessionCompleteDelegate_Handle(FOnUpdateSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnRegisteredSessionUpdateComplete));
+	RegisteredDestroyCompleteDelegateHandle = SessionInterface->AddOnDestroySessionCompleteDelegate_Handle(FOnDestroySessionCompleteDelegate::CreateUObject(this, &ThisClass::OnRegisteredSessionDestroyComplete));
+	AdvertisedUpdateCompleteDelegateHandle = SessionInterface->AddOnUpdateSessionCompleteDelegate_Handle(FOnUpdateSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnGameSessionAdvertisedValuesUpdated));
 }
 
 void UMultiplayerSessionsSubsystem::ClearPersistentSessionDelegates()
@@ -1021,9 +1303,19 @@ void UMultiplayerSessionsSubsystem::ClearPersistentSessionDelegates()
 	if (SessionInterface.IsValid() == true && SessionInviteAcceptedDelegateHandle.IsValid() == true)
 	{
 		SessionInterface->ClearOnSessionUserInviteAcceptedDelegate_Handle(SessionInviteAcceptedDelegateHandle);
+		SessionInterface->ClearOnCreateSessionCompleteDelegate_Handle(RegisteredCreateCompleteDelegateHandle);
+		SessionInterface->ClearOnUpdateSessionCompleteDelegate_Handle(RegisteredUpdateCompleteDelegateHandle);
+		SessionInterface->ClearOnDestroySessionCompleteDelegate_Handle(RegisteredDestroyCompleteDelegateHandle);
+		SessionInterface->ClearOnUpdateSessionCompleteDelegate_Handle(AdvertisedUpdateCompleteDelegateHandle);
 	}
 
 	SessionInviteAcceptedDelegateHandle = FDelegateHandle();
+	RegisteredCreateCompleteDelegateHandle = FDelegateHandle();
+	RegisteredUpdateCompleteDelegateHandle = FDelegateHandle();
+	RegisteredDestroyCompleteDelegateHandle = FDelegateHandle();
+	AdvertisedUpdateCompleteDelegateHandle = FDelegateHandle();
+	InFlightAdvertisedValues.Reset();
+	InFlightAdvertisedSettings.Reset();
 }
 
 bool UMultiplayerSessionsSubsystem::ResolveLocalUser(ULocalPlayer* RequestedLocalPlayer, FLocalUserContext& OutLocalUser, EMultiplayerSessionFailureReason& OutFailureReason)
@@ -1060,7 +1352,7 @@ bool UMultiplayerSessionsSubsystem::ResolveLocalUser(ULocalPlayer* RequestedLoca
 		}
 	}
 
-	if (LocalUserNum == INDEX_NONE)
+	if (LocalUserNum == INDEX_NONE || LocalUserNum >= MaxLocalUsers)
 	{
 		OutFailureReason = EMultiplayerSessionFailureReason::InvalidLocalPlayer;
 		return false;
@@ -1095,6 +1387,11 @@ ULocalPlayer* UMultiplayerSessionsSubsystem::ResolveDefaultLocalPlayer() const
 		return nullptr;
 	}
 
+	if (BoundLocalUserNum > 0 && BoundLocalUserNum < GameInstance->GetNumLocalPlayers())
+	{
+		return GameInstance->GetLocalPlayerByIndex(BoundLocalUserNum);
+	}
+
 	return GameInstance->GetFirstGamePlayer();
 }
 
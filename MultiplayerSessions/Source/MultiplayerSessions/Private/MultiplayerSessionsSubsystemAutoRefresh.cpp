@@ -0,0 +1,216 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "Engine/LocalPlayer.h"
+#include "Misc/App.h"
+
+namespace
+{
+	constexpr float AutoRefreshTickSeconds = 1.0f;
+	constexpr double SearchBudgetWindowSeconds = 60.0;
+	constexpr float AutoRefreshChurnSmoothing = 0.5f;
+}
+
+void UMultiplayerSessionsSubsystem::StartAutoRefresh(ULocalPlayer* LocalPlayer, const FMultiplayerSessionSearchRequest& SearchRequest)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+	AutoRefreshLocalPlayer = LocalPlayer;
+	AutoRefreshRequest = SearchRequest;
+	SanitizeSearchRequest(AutoRefreshRequest);
+
+	if (bAutoRefreshActive == false)
+	{
+		bAutoRefreshActive = true;
+		AutoRefreshChurn = 0.0f;
+		AutoRefreshIntervalSeconds = FMath::Max(AutoRefreshMinIntervalSeconds, AutoRefreshMaxIntervalSeconds);
+		NextAutoRefreshSeconds = FPlatformTime::Seconds() + AutoRefreshIntervalSeconds;
+	}
+
+	if (AutoRefreshTickerHandle.IsValid() == false)
+	{
+		AutoRefreshTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickAutoRefresh), AutoRefreshTickSeconds);
+	}
+}
+
+void UMultiplayerSessionsSubsystem::StopAutoRefresh()
+{
+	bAutoRefreshActive = false;
+	bAutoRefreshPaused = false;
+	AutoRefreshLocalPlayer.Reset();
+	CancelBackgroundRefresh();
+}
+
+void UMultiplayerSessionsSubsystem::CancelBackgroundRefresh()
+{
+	if (ActiveOperation.bBackgroundRefresh == false)
+	{
+		return;
+	}
+
+	const bool bOwnsSearch = SearchOwnerLocalUserNum == BoundLocalUserNum;
+	ClearOperationDelegate(EOperationType::Find);
+	if (bOwnsSearch == true && SessionInterface.IsValid() == true)
+	{
+		SessionInterface->CancelFindSessions();
+	}
+
+	TArray<FOnlineSessionSearchResult> EmptySearchResults;
+	TArray<FMultiplayerSessionBrowserEntry> EmptyBrowserEntries;
+	CompleteFindOperation(false, EMultiplayerSessionFailureReason::Cancelled, MoveTemp(EmptySearchResults), MoveTemp(EmptyBrowserEntries));
+
+	if (ActiveOperation.bBackgroundRefresh == true)
+	{
+		const uint64 CancelledOperationGeneration = ActiveOperation.Generation;
+		const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
+		BroadcastIdleStateIfUnchanged(PreviousFlowState, CancelledOperationGeneration);
+	}
+}
+
+void UMultiplayerSessionsSubsystem::StopAutoRefreshForLocalPlayer(ULocalPlayer* LocalPlayer)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+	StopAutoRefresh();
+}
+
+void UMultiplayerSessionsSubsystem::SetAutoRefreshPaused(bool bPaused)
+{
+	bAutoRefreshPaused = bPaused;
+}
+
+void UMultiplayerSessionsSubsystem::SetAutoRefreshPausedForLocalPlayer(ULocalPlayer* LocalPlayer, bool bPaused)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+	SetAutoRefreshPaused(bPaused);
+}
+
+bool UMultiplayerSessionsSubsystem::IsAutoRefreshActive() const
+{
+	return bAutoRefreshActive;
+}
+
+float UMultiplayerSessionsSubsystem::GetAutoRefreshIntervalSeconds() const
+{
+	return bAutoRefreshActive == true ? AutoRefreshIntervalSeconds : 0.0f;
+}
+
+bool UMultiplayerSessionsSubsystem::TickAutoRefresh(float DeltaTime)
+{
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	bool bAnyActive = false;
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+		if (bAutoRefreshActive == true)
+		{
+			bAnyActive = true;
+			TickLocalUserAutoRefresh(CurrentSeconds);
+		}
+	}
+
+	if (bAnyActive == false)
+	{
+		AutoRefreshTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void UMultiplayerSessionsSubsystem::TickLocalUserAutoRefresh(double CurrentSeconds)
+{
+	if (bAutoRefreshPaused == true || (bPauseAutoRefreshWhenUnfocused == true && FApp::HasFocus() == false))
+	{
+		return;
+	}
+
+	if (CurrentSeconds < NextAutoRefreshSeconds || CurrentFlowState != EMultiplayerSessionFlowState::Idle)
+	{
+		return;
+	}
+
+	PruneRecentSearches(CurrentSeconds);
+	if (RecentSearchSeconds.Num() >= MaxSearchesPerMinute)
+	{
+		NextAutoRefreshSeconds = RecentSearchSeconds[RecentSearchSeconds.Num() - MaxSearchesPerMinute] + SearchBudgetWindowSeconds;
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Auto refresh for local user %d deferred by the search budget for %.1fs."), BoundLocalUserNum, NextAutoRefreshSeconds - CurrentSeconds);
+		return;
+	}
+
+	NextAutoRefreshSeconds = CurrentSeconds + AutoRefreshIntervalSeconds;
+	StartFindOperation(AutoRefreshLocalPlayer.Get(), AutoRefreshRequest, true);
+}
+
+void UMultiplayerSessionsSubsystem::ScheduleNextAutoRefresh(const FMultiplayerSessionBrowserChangeSet* ChangeSet, int32 PreviousEntryCount)
+{
+	if (bAutoRefreshActive == false)
+	{
+		return;
+	}
+
+	const float MinIntervalSeconds = FMath::Min(AutoRefreshMinIntervalSeconds, AutoRefreshMaxIntervalSeconds);
+	const float MaxIntervalSeconds = FMath::Max(AutoRefreshMinIntervalSeconds, AutoRefreshMaxIntervalSeconds);
+	if (ChangeSet == nullptr)
+	{
+		AutoRefreshIntervalSeconds = MaxIntervalSeconds;
+	}
+	else
+	{
+		int32 ChangedCount = ChangeSet->AddedEntryIndices.Num() + ChangeSet->RemovedEntryIds.Num();
+		for (const FMultiplayerSessionEntryUpdate& EntryUpdate : ChangeSet->UpdatedEntries)
+		{
+			if ((EntryUpdate.ChangedFields & ~static_cast<int32>(EMultiplayerSessionEntryField::Ping)) != 0)
+			{
+				ChangedCount++;
+			}
+		}
+
+		const int32 EntryCount = FMath::Max3(1, PreviousEntryCount, CachedBrowserEntries.Num());
+		const float ChurnRatio = static_cast<float>(ChangedCount) / static_cast<float>(EntryCount);
+		AutoRefreshChurn = FMath::Lerp(AutoRefreshChurn, ChurnRatio, AutoRefreshChurnSmoothing);
+
+		const float ChurnAlpha = FMath::Clamp(AutoRefreshChurn / FMath::Max(0.01f, AutoRefreshHighChurnRatio), 0.0f, 1.0f);
+		AutoRefreshIntervalSeconds = FMath::Lerp(MaxIntervalSeconds, MinIntervalSeconds, ChurnAlpha);
+	}
+
+	NextAutoRefreshSeconds = FPlatformTime::Seconds() + AutoRefreshIntervalSeconds;
+	UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Next auto refresh in %.1fs. Churn=%.3f"), AutoRefreshIntervalSeconds, AutoRefreshChurn);
+}
+
+void UMultiplayerSessionsSubsystem::NoteSearchIssued(double CurrentSeconds)
+{
+	PruneRecentSearches(CurrentSeconds);
+	RecentSearchSeconds.Add(CurrentSeconds);
+}
+
+void UMultiplayerSessionsSubsystem::PruneRecentSearches(double CurrentSeconds)
+{
+	int32 ExpiredCount = 0;
+	while (ExpiredCount < RecentSearchSeconds.Num() && RecentSearchSeconds[ExpiredCount] <= CurrentSeconds - SearchBudgetWindowSeconds)
+	{
+		ExpiredCount++;
+	}
+
+	if (ExpiredCount > 0)
+	{
+		RecentSearchSeconds.RemoveAt(0, ExpiredCount);
+	}
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionsBenchmark.h"
+#include "MultiplayerSessionsDiagnostics.h"
+#include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsSyntheticResults.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	MultiplayerSessionsBenchmark::FBenchmarkCountingMalloc* GBenchmarkCountingMalloc = nullptr;
+}
+
+void MultiplayerSessionsBenchmark::InstallBenchmarkCountingMalloc()
+{
+	if (GBenchmarkCountingMalloc != nullptr || GMalloc == nullptr)
+	{
+		return;
+	}
+
+	GBenchmarkCountingMalloc = new FBenchmarkCountingMalloc(GMalloc);
+	GMalloc = GBenchmarkCountingMalloc;
+}
+
+MultiplayerSessionsBenchmark::FBenchmarkCountingMalloc* MultiplayerSessionsBenchmark::GetBenchmarkCountingMalloc()
+{
+	return GBenchmarkCountingMalloc;
+}
+
+namespace
+{
+	using namespace MultiplayerSessionsBenchmark;
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchSearchCommand(
+		TEXT("ms.Bench.Search"),
+		TEXT("Runs synthetic search results through the browser pipeline. Usage: ms.Bench.Search [ResultCount]. Without a count it runs 100, 1000, 10000 and 100000. The results are published to the browser like a real search."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World);
+			if (Subsystem == nullptr)
+			{
+				Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+				return;
+			}
+
+			TArray<int32> ResultCounts;
+			if (Args.Num() > 0)
+			{
+				ResultCounts.Add(FMath::Max(1, FCString::Atoi(*Args[0])));
+			}
+			else
+			{
+				ResultCounts = { 100, 1000, 10000, 100000 };
+			}
+
+			for (const int32 ResultCount : ResultCounts)
+			{
+				if (Subsystem->RunSearchBenchmark(ResultCount, Ar) == false)
+				{
+					return;
+				}
+			}
+		}));
+}
+
+bool UMultiplayerSessionsSubsystem::RunSearchBenchmark(int32 ResultCount, FOutputDevice& Ar)
+{
+	if (ActiveOperation.Type != EOperationType::None || CurrentFlowState != EMultiplayerSessionFlowState::Idle)
+	{
+		Ar.Log(TEXT("Search benchmark skipped: another session operation is running."));
+		return false;
+	}
+
+	FMultiplayerSessionSearchRequest SearchRequest;
+	SanitizeSearchRequest(SearchRequest);
+
+	MultiplayerSessionsSynthetic::FSyntheticResultOptions SyntheticOptions;
+	SyntheticOptions.MatchType = SearchRequest.DesiredMatchType;
+	SyntheticOptions.BuildId = SearchRequest.DesiredBuildId;
+	SyntheticOptions.SessionSchemaVersion = SearchRequest.DesiredSessionSchemaVersion;
+	SyntheticOptions.Seed = ResultCount;
+
+	TArray<FOnlineSessionSearchResult> SourceSearchResults;
+	MultiplayerSessionsSynthetic::MakeSearchResults(ResultCount, SyntheticOptions, SourceSearchResults);
+
+	Ar.Logf(TEXT("%8s %-10s %12s %12s %14s %14s"), TEXT("Results"), TEXT("Stage"), TEXT("Time ms"), TEXT("Allocs"), TEXT("Alloc bytes"), TEXT("Peak bytes"));
+
+	TArray<FOnlineSessionSearchResult> SearchResults;
+	TArray<FMultiplayerSessionBrowserEntry> BrowserEntries;
+	{
+		FBenchmarkStageTimer StageTimer(TEXT("Filter"), ResultCount, Ar);
+		FilterRelevantSearchResults(MoveTemp(SourceSearchResults), SearchRequest, SearchResults);
+	}
+	{
+		FBenchmarkStageTimer StageTimer(TEXT("Build"), ResultCount, Ar);
+		BuildBrowserEntries(SearchResults, SearchRequest, BrowserEntries);
+	}
+	{
+		FBenchmarkStageTimer StageTimer(TEXT("Score"), ResultCount, Ar);
+		ScoreBrowserEntries(BrowserEntries, SearchRequest.ScoringWeights);
+	}
+	{
+		FBenchmarkStageTimer StageTimer(TEXT("Sort"), ResultCount, Ar);
+		SortSearchResultsAndBrowserEntries(SearchResults, BrowserEntries, SearchRequest.DisplayedResultCount);
+	}
+
+	NextOperationGeneration++;
+	if (NextOperationGeneration == 0)
+	{
+		NextOperationGeneration++;
+	}
+
+	ActiveOperation = FOperationContext();
+	ActiveOperation.Generation = NextOperationGeneration;
+	ActiveOperation.Type = EOperationType::Find;
+	ActiveOperation.Step = EOperationStep::Executing;
+	ActiveOperation.StepOperationType = EOperationType::Find;
+	ActiveOperation.SearchRequest = SearchRequest;
+	ActiveOperation.BeginSeconds = FPlatformTime::Seconds();
+	ActiveOperation.StepBeginSeconds = ActiveOperation.BeginSeconds;
+	{
+		FBenchmarkStageTimer StageTimer(TEXT("Publish"), ResultCount, Ar);
+		CompleteFindOperation(true, EMultiplayerSessionFailureReason::None, MoveTemp(SearchResults), MoveTemp(BrowserEntries));
+	}
+
+	if (GetBenchmarkCountingMalloc() == nullptr)
+	{
+		Ar.Logf(TEXT("Start with -%s to count allocations."), CountAllocationsParam);
+	}
+
+	return true;
+}
+
+#endif
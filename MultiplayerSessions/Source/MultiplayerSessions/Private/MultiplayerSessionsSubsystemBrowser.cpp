@@ -2,9 +2,69 @@
 
 #include "MultiplayerSessionsSubsystem.h"
 
+#include "MultiplayerSessionScorer.h"
 #include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsStats.h"
+#include "MultiplayerSessionsTrace.h"
+#include "Interfaces/OnlineFriendsInterface.h"
+#include "Misc/MemStack.h"
 #include "Misc/NetworkVersion.h"
+#include "Misc/StringBuilder.h"
 #include "OnlineSessionSettings.h"
+#include "OnlineSubsystem.h"
+
+namespace
+{
+	float SanitizeScore(float Score)
+	{
+		if (FMath::IsNaN(Score) == true)
+		{
+			return -MAX_FLT;
+		}
+
+		return FMath::Clamp(Score, -MAX_FLT, MAX_FLT);
+	}
+
+	bool IsLeanCacheSettingKey(FName Key)
+	{
+		return Key == MultiplayerSessionsKeys::PingProbePort || Key == MultiplayerSessionsKeys::SlotReservations || Key == MultiplayerSessionsKeys::ReservedSlots || Key == MultiplayerSessionsKeys::JoinBusy || Key == MultiplayerSessionsKeys::SessionName || Key == MultiplayerSessionsKeys::GamePort;
+	}
+
+	EMultiplayerSessionEntryField CompareBrowserEntryFields(const FMultiplayerSessionBrowserEntry& Previous, const FMultiplayerSessionBrowserEntry& Current)
+	{
+		EMultiplayerSessionEntryField ChangedFields = EMultiplayerSessionEntryField::None;
+		if (Previous.CurrentPlayers != Current.CurrentPlayers || Previous.MaxPlayers != Current.MaxPlayers || Previous.OpenPublicConnections != Current.OpenPublicConnections)
+		{
+			ChangedFields |= EMultiplayerSessionEntryField::Players;
+		}
+
+		if (Previous.Status != Current.Status || Previous.AdvertisedStatus != Current.AdvertisedStatus)
+		{
+			ChangedFields |= EMultiplayerSessionEntryField::Status;
+		}
+
+		if (Previous.PingInMs != Current.PingInMs)
+		{
+			ChangedFields |= EMultiplayerSessionEntryField::Ping;
+		}
+
+		if (Previous.bCanJoin != Current.bCanJoin || Previous.JoinBlockReason != Current.JoinBlockReason)
+		{
+			ChangedFields |= EMultiplayerSessionEntryField::Joinability;
+		}
+
+		if (Previous.SessionDisplayName.Equals(Current.SessionDisplayName, ESearchCase::CaseSensitive) == false
+			|| Previous.HostDisplayName.Equals(Current.HostDisplayName, ESearchCase::CaseSensitive) == false
+			|| Previous.MapName.Equals(Current.MapName, ESearchCase::CaseSensitive) == false
+			|| Previous.RegionTag.Equals(Current.RegionTag, ESearchCase::CaseSensitive) == false
+			|| Previous.bHostIsFriend != Current.bHostIsFriend)
+		{
+			ChangedFields |= EMultiplayerSessionEntryField::Details;
+		}
+
+		return ChangedFields;
+	}
+}
 
 void UMultiplayerSessionsSubsystem::SanitizeCreateRequest(FMultiplayerSessionCreateRequest& InOutCreateRequest) const
 {
@@ -15,6 +75,7 @@ void UMultiplayerSessionsSubsystem::SanitizeCreateRequest(FMultiplayerSessionCre
 		InOutCreateRequest.MatchType = TEXT("Default");
 	}
 
+	InOutCreateRequest.RegionTag.TrimStartAndEndInline();
 	InOutCreateRequest.BuildId = ResolveBuildId(InOutCreateRequest.BuildId);
 	InOutCreateRequest.SessionSchemaVersion = FMath::Max(1, InOutCreateRequest.SessionSchemaVersion);
 }
@@ -25,6 +86,9 @@ void UMultiplayerSessionsSubsystem::SanitizeSearchRequest(FMultiplayerSessionSea
 	InOutSearchRequest.DesiredMatchType.TrimStartAndEndInline();
 	InOutSearchRequest.DesiredBuildId = ResolveBuildId(InOutSearchRequest.DesiredBuildId);
 	InOutSearchRequest.DesiredSessionSchemaVersion = FMath::Max(1, InOutSearchRequest.DesiredSessionSchemaVersion);
+	InOutSearchRequest.PreferredRegionTag.TrimStartAndEndInline();
+	InOutSearchRequest.ScoringWeights.UnknownPingMs = FMath::Max(0, InOutSearchRequest.ScoringWeights.UnknownPingMs);
+	InOutSearchRequest.DisplayedResultCount = FMath::Max(0, InOutSearchRequest.DisplayedResultCount);
 }
 
 int32 UMultiplayerSessionsSubsystem::ResolveBuildId(int32 RequestedBuildId) const
@@ -48,8 +112,7 @@ void UMultiplayerSessionsSubsystem::ApplyCreateRequestToSessionSettings(FOnlineS
 {
 	SessionSettings.bIsLANMatch = CreateRequest.bUseLan;
 
-	const UWorld* World = GetWorld();
-	SessionSettings.bIsDedicated = World != nullptr && World->GetNetMode() == NM_DedicatedServer;
+	SessionSettings.bIsDedicated = IsHeadlessProcess();
 
 	SessionSettings.NumPublicConnections = CreateRequest.NumPublicConnections;
 	SessionSettings.NumPrivateConnections = 0;
@@ -67,8 +130,8 @@ void UMultiplayerSessionsSubsystem::ApplyCreateRequestToSessionSettings(FOnlineS
 		SessionSettings.bAllowInvites = CreateRequest.bAllowInvites;
 		SessionSettings.bAllowJoinViaPresence = CreateRequest.bAllowJoinViaPresence;
 		SessionSettings.bAllowJoinViaPresenceFriendsOnly = CreateRequest.bAllowJoinViaPresenceFriendsOnly;
-		SessionSettings.bUsesPresence = true;
-		SessionSettings.bUseLobbiesIfAvailable = true;
+		SessionSettings.bUsesPresence = SessionSettings.bIsDedicated == false;
+		SessionSettings.bUseLobbiesIfAvailable = SessionSettings.bIsDedicated == false;
 	}
 
 	SessionSettings.Set(MultiplayerSessionsKeys::MatchType, CreateRequest.MatchType, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
@@ -92,6 +155,22 @@ void UMultiplayerSessionsSubsystem::ApplyCreateRequestToSessionSettings(FOnlineS
 		SessionSettings.Set(MultiplayerSessionsKeys::MapName, CreateRequest.MapName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
 	}
 
+	if (CreateRequest.RegionTag.IsEmpty() == false)
+	{
+		SessionSettings.Set(MultiplayerSessionsKeys::RegionTag, CreateRequest.RegionTag, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+
+	const int32 AdvertisedPingProbePort = GetPingResponderPort();
+	if (AdvertisedPingProbePort > 0)
+	{
+		SessionSettings.Set(MultiplayerSessionsKeys::PingProbePort, AdvertisedPingProbePort, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		if (bEnableSlotReservations == true)
+		{
+			SessionSettings.Set(MultiplayerSessionsKeys::SlotReservations, 1, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+			SessionSettings.Set(MultiplayerSessionsKeys::ReservedSlots, 0, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		}
+	}
+
 	FString InvitesText = TEXT("false");
 	if (SessionSettings.bAllowInvites == true)
 	{
@@ -123,6 +202,11 @@ bool UMultiplayerSessionsSubsystem::IsSearchResultRelevantToRequest(const FOnlin
 		return false;
 	}
 
+	if (ResolveSessionNameForResult(SearchResult) != NAME_GameSession)
+	{
+		return false;
+	}
+
 	if (SearchRequest.DesiredMatchType.IsEmpty() == false)
 	{
 		FString FoundMatchType;
@@ -140,6 +224,24 @@ bool UMultiplayerSessionsSubsystem::IsSearchResultRelevantToRequest(const FOnlin
 	return true;
 }
 
+int32 UMultiplayerSessionsSubsystem::ResolveOpenPublicConnections(const FOnlineSessionSearchResult& SearchResult)
+{
+	int32 ReservedSlots = 0;
+	SearchResult.Session.SessionSettings.Get(MultiplayerSessionsKeys::ReservedSlots, ReservedSlots);
+	return FMath::Max(0, SearchResult.Session.NumOpenPublicConnections - FMath::Max(0, ReservedSlots));
+}
+
+FName UMultiplayerSessionsSubsystem::ResolveSessionNameForResult(const FOnlineSessionSearchResult& SearchResult) const
+{
+	FString FoundSessionName;
+	if (SearchResult.Session.SessionSettings.Get(MultiplayerSessionsKeys::SessionName, FoundSessionName) == false || FoundSessionName.IsEmpty() == true)
+	{
+		return NAME_GameSession;
+	}
+
+	return FName(*FoundSessionName);
+}
+
 EMultiplayerJoinBlockReason UMultiplayerSessionsSubsystem::ResolveJoinBlockReason(const FOnlineSessionSearchResult& SearchResult, const FMultiplayerSessionSearchRequest& SearchRequest) const
 {
 	if (SearchResult.IsValid() == false)
@@ -171,7 +273,7 @@ EMultiplayerJoinBlockReason UMultiplayerSessionsSubsystem::ResolveJoinBlockReaso
 		return EMultiplayerJoinBlockReason::StatusUnavailable;
 	}
 
-	const int32 OpenPublicConnections = FMath::Max(0, SearchResult.Session.NumOpenPublicConnections);
+	const int32 OpenPublicConnections = ResolveOpenPublicConnections(SearchResult);
 	const EMultiplayerAdvertisedSessionStatus DisplayStatus = ResolveDisplayStatus(AdvertisedStatus, OpenPublicConnections);
 	if (DisplayStatus == EMultiplayerAdvertisedSessionStatus::Starting)
 	{
@@ -191,6 +293,54 @@ EMultiplayerJoinBlockReason UMultiplayerSessionsSubsystem::ResolveJoinBlockReaso
 	return EMultiplayerJoinBlockReason::None;
 }
 
+void UMultiplayerSessionsSubsystem::BuildBrowserResultsFromPendingSearch(TArray<FOnlineSessionSearchResult>& OutSearchResults, TArray<FMultiplayerSessionBrowserEntry>& OutBrowserEntries)
+{
+	OutSearchResults.Reset();
+	OutBrowserEntries.Reset();
+
+	if (ActiveOperation.PendingSearch.IsValid() == false)
+	{
+		return;
+	}
+
+	FilterRelevantSearchResults(MoveTemp(ActiveOperation.PendingSearch->SearchResults), ActiveOperation.SearchRequest, OutSearchResults);
+	BuildBrowserEntries(OutSearchResults, ActiveOperation.SearchRequest, OutBrowserEntries);
+	ScoreBrowserEntries(OutBrowserEntries, ActiveOperation.SearchRequest.ScoringWeights);
+	SortSearchResultsAndBrowserEntries(OutSearchResults, OutBrowserEntries, ActiveOperation.SearchRequest.DisplayedResultCount);
+}
+
+void UMultiplayerSessionsSubsystem::FilterRelevantSearchResults(TArray<FOnlineSessionSearchResult>&& SourceSearchResults, const FMultiplayerSessionSearchRequest& SearchRequest, TArray<FOnlineSessionSearchResult>& OutSearchResults) const
+{
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_FilterResults);
+	SCOPE_CYCLE_COUNTER(STAT_MultiplayerSessions_FilterResults);
+
+	const int32 RawResultCount = SourceSearchResults.Num();
+	OutSearchResults = MoveTemp(SourceSearchResults);
+	OutSearchResults.RemoveAll([this, &SearchRequest](const FOnlineSessionSearchResult& SearchResult)
+	{
+		return IsSearchResultRelevantToRequest(SearchResult, SearchRequest) == false;
+	});
+
+	INC_DWORD_STAT_BY(STAT_MultiplayerSessions_RawResults, RawResultCount);
+	INC_DWORD_STAT_BY(STAT_MultiplayerSessions_ResultsDropped, RawResultCount - OutSearchResults.Num());
+}
+
+void UMultiplayerSessionsSubsystem::BuildBrowserEntries(const TArray<FOnlineSessionSearchResult>& SearchResults, const FMultiplayerSessionSearchRequest& SearchRequest, TArray<FMultiplayerSessionBrowserEntry>& OutBrowserEntries) const
+{
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_BuildBrowserEntries);
+	SCOPE_CYCLE_COUNTER(STAT_MultiplayerSessions_BuildEntries);
+
+	OutBrowserEntries.Reset(SearchResults.Num());
+	for (int32 SearchResultIndex = 0; SearchResultIndex < SearchResults.Num(); SearchResultIndex++)
+	{
+		const FMultiplayerSessionBrowserEntry& BrowserEntry = OutBrowserEntries.Add_GetRef(BuildBrowserEntry(SearchResults[SearchResultIndex], SearchResultIndex, SearchRequest));
+		MultiplayerSessionsStats::IncrementJoinBlockStat(BrowserEntry.JoinBlockReason);
+	}
+
+	ResolveFriendHosts(SearchResults, OutBrowserEntries);
+	INC_DWORD_STAT_BY(STAT_MultiplayerSessions_EntriesBuilt, OutBrowserEntries.Num());
+}
+
 FMultiplayerSessionBrowserEntry UMultiplayerSessionsSubsystem::BuildBrowserEntry(const FOnlineSessionSearchResult& SearchResult, int32 SearchResultIndex, const FMultiplayerSessionSearchRequest& SearchRequest) const
 {
 	FMultiplayerSessionBrowserEntry BrowserEntry;
@@ -200,7 +350,7 @@ FMultiplayerSessionBrowserEntry UMultiplayerSessionsSubsystem::BuildBrowserEntry
 	BrowserEntry.bIsLan = SearchResult.Session.SessionSettings.bIsLANMatch;
 	BrowserEntry.PingInMs = SearchResult.PingInMs;
 	BrowserEntry.MaxPlayers = SearchResult.Session.SessionSettings.NumPublicConnections;
-	BrowserEntry.OpenPublicConnections = FMath::Max(0, SearchResult.Session.NumOpenPublicConnections);
+	BrowserEntry.OpenPublicConnections = ResolveOpenPublicConnections(SearchResult);
 	BrowserEntry.CurrentPlayers = FMath::Max(0, BrowserEntry.MaxPlayers - BrowserEntry.OpenPublicConnections);
 	BrowserEntry.BuildId = 0;
 
@@ -237,6 +387,12 @@ FMultiplayerSessionBrowserEntry UMultiplayerSessionsSubsystem::BuildBrowserEntry
 		BrowserEntry.MapName = Value;
 	}
 
+	if (SearchResult.Session.SessionSettings.Get(MultiplayerSessionsKeys::RegionTag, Value) == true)
+	{
+		BrowserEntry.RegionTag = Value;
+		BrowserEntry.bIsPreferredRegion = SearchRequest.PreferredRegionTag.IsEmpty() == false && Value.Equals(SearchRequest.PreferredRegionTag, ESearchCase::IgnoreCase);
+	}
+
 	if (SearchResult.Session.SessionSettings.Get(MultiplayerSessionsKeys::Status, Value) == true)
 	{
 		BrowserEntry.AdvertisedStatus = SessionStatusFromString(Value);
@@ -253,13 +409,14 @@ FMultiplayerSessionBrowserEntry UMultiplayerSessionsSubsystem::BuildBrowserEntry
 
 	if (BrowserEntry.EntryId.IsEmpty() == true)
 	{
-		FString OwningUserId;
+		TStringBuilder<256> EntryIdBuilder;
 		if (SearchResult.Session.OwningUserId.IsValid() == true)
 		{
-			OwningUserId = SearchResult.Session.OwningUserId->ToString();
+			EntryIdBuilder << SearchResult.Session.OwningUserId->ToString();
 		}
 
-		BrowserEntry.EntryId = FString::Printf(TEXT("%s|%s|%s"), *OwningUserId, *BrowserEntry.HostDisplayName, *BrowserEntry.MatchType);
+		EntryIdBuilder << TEXT('|') << BrowserEntry.HostDisplayName << TEXT('|') << BrowserEntry.MatchType;
+		BrowserEntry.EntryId = FString(EntryIdBuilder.ToView());
 	}
 
 	ResolveJoinability(BrowserEntry, SearchResult, SearchRequest);
@@ -273,79 +430,310 @@ void UMultiplayerSessionsSubsystem::ResolveJoinability(FMultiplayerSessionBrowse
 	BrowserEntry.JoinDisabledReasonText = ResolveJoinBlockReasonText(BrowserEntry.JoinBlockReason);
 }
 
-void UMultiplayerSessionsSubsystem::SortSearchResultsAndBrowserEntries(TArray<FOnlineSessionSearchResult>& SearchResults, TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries) const
+void UMultiplayerSessionsSubsystem::ResolveFriendHosts(const TArray<FOnlineSessionSearchResult>& SearchResults, TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries) const
 {
-	struct FSortedSessionPair
+	if (CachedOnlineSubsystem == nullptr || ActiveOperation.SearchRequest.bUseLan == true)
 	{
-		FOnlineSessionSearchResult SearchResult;
-		FMultiplayerSessionBrowserEntry BrowserEntry;
-	};
+		return;
+	}
+
+	const IOnlineFriendsPtr FriendsInterface = CachedOnlineSubsystem->GetFriendsInterface();
+	if (FriendsInterface.IsValid() == false)
+	{
+		return;
+	}
 
-	TArray<FSortedSessionPair> SessionPairs;
-	SessionPairs.Reserve(SearchResults.Num());
+	TArray<TSharedRef<FOnlineFriend>> Friends;
+	if (FriendsInterface->GetFriendsList(ActiveOperation.LocalUser.LocalUserNum, EFriendsLists::ToString(EFriendsLists::Default), Friends) == false || Friends.Num() == 0)
+	{
+		return;
+	}
 
-	for (int32 Index = 0; Index < SearchResults.Num(); Index++)
+	TSet<FString> FriendIds;
+	FriendIds.Reserve(Friends.Num());
+	for (const TSharedRef<FOnlineFriend>& Friend : Friends)
 	{
-		if (BrowserEntries.IsValidIndex(Index) == false)
+		FriendIds.Add(Friend->GetUserId()->ToString());
+	}
+
+	for (int32 Index = 0; Index < SearchResults.Num() && Index < BrowserEntries.Num(); Index++)
+	{
+		const FUniqueNetIdPtr& OwningUserId = SearchResults[Index].Session.OwningUserId;
+		BrowserEntries[Index].bHostIsFriend = OwningUserId.IsValid() == true && FriendIds.Contains(OwningUserId->ToString());
+	}
+}
+
+void UMultiplayerSessionsSubsystem::ScoreBrowserEntries(TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, const FMultiplayerSessionScoringWeights& ScoringWeights) const
+{
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_ScoreBrowserEntries);
+	UObject* Scorer = SessionScorer;
+	if (Scorer == nullptr || Scorer->GetClass()->ImplementsInterface(UMultiplayerSessionScorer::StaticClass()) == false)
+	{
+		for (FMultiplayerSessionBrowserEntry& BrowserEntry : BrowserEntries)
 		{
-			continue;
+			BrowserEntry.Score = SanitizeScore(ScoreBrowserEntry(BrowserEntry, ScoringWeights));
 		}
 
-		FSortedSessionPair Pair;
-		Pair.SearchResult = SearchResults[Index];
-		Pair.BrowserEntry = BrowserEntries[Index];
-		SessionPairs.Add(Pair);
+		return;
 	}
 
-	SessionPairs.Sort(
-		[](const FSortedSessionPair& Left, const FSortedSessionPair& Right)
+	for (FMultiplayerSessionBrowserEntry& BrowserEntry : BrowserEntries)
+	{
+		BrowserEntry.Score = SanitizeScore(IMultiplayerSessionScorer::Execute_ScoreSessionEntry(Scorer, BrowserEntry, ScoringWeights));
+	}
+}
+
+bool UMultiplayerSessionsSubsystem::SortSearchResultsAndBrowserEntries(TArray<FOnlineSessionSearchResult>& SearchResults, TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, int32 DisplayedResultCount) const
+{
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_SortBrowserEntries);
+	SCOPE_CYCLE_COUNTER(STAT_MultiplayerSessions_SortEntries);
+	const int32 NumEntries = FMath::Min(SearchResults.Num(), BrowserEntries.Num());
+
+	FMemMark ScratchMark(FMemStack::Get());
+	TArray<int32, TMemStackAllocator<>> SortedIndices;
+	SortedIndices.Reserve(NumEntries);
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		SortedIndices.Add(Index);
+	}
+
+	const auto IsBetterEntry = [&BrowserEntries](int32 LeftIndex, int32 RightIndex)
+	{
+		return IsBetterBrowserEntry(BrowserEntries[LeftIndex], BrowserEntries[RightIndex]);
+	};
+
+	if (DisplayedResultCount > 0 && DisplayedResultCount < NumEntries)
+	{
+		// Only the displayed page is ordered; the remaining entries keep heap order.
+		TArray<int32, TMemStackAllocator<>> HeapIndices = MoveTemp(SortedIndices);
+		HeapIndices.Heapify(IsBetterEntry);
+
+		SortedIndices.Reset(NumEntries);
+		for (int32 Count = 0; Count < DisplayedResultCount; Count++)
 		{
-			if (Left.BrowserEntry.bCanJoin != Right.BrowserEntry.bCanJoin)
-			{
-				return Left.BrowserEntry.bCanJoin > Right.BrowserEntry.bCanJoin;
-			}
+			int32 BestIndex = INDEX_NONE;
+			HeapIndices.HeapPop(BestIndex, IsBetterEntry);
+			SortedIndices.Add(BestIndex);
+		}
 
-			const int32 LeftStatusPriority = UMultiplayerSessionsSubsystem::ResolveStatusSortPriority(Left.BrowserEntry.Status);
-			const int32 RightStatusPriority = UMultiplayerSessionsSubsystem::ResolveStatusSortPriority(Right.BrowserEntry.Status);
-			if (LeftStatusPriority != RightStatusPriority)
-			{
-				return LeftStatusPriority < RightStatusPriority;
-			}
+		SortedIndices.Append(HeapIndices);
+	}
+	else
+	{
+		SortedIndices.Sort(IsBetterEntry);
+	}
 
-			int32 LeftPing = Left.BrowserEntry.PingInMs;
-			int32 RightPing = Right.BrowserEntry.PingInMs;
-			if (LeftPing < 0)
-			{
-				LeftPing = TNumericLimits<int32>::Max();
-			}
-			if (RightPing < 0)
-			{
-				RightPing = TNumericLimits<int32>::Max();
-			}
-			if (LeftPing != RightPing)
-			{
-				return LeftPing < RightPing;
-			}
+	SearchResults.SetNum(NumEntries);
+	BrowserEntries.SetNum(NumEntries);
 
-			if (Left.BrowserEntry.OpenPublicConnections != Right.BrowserEntry.OpenPublicConnections)
+	bool bOrderChanged = false;
+	for (int32 CycleStart = 0; CycleStart < NumEntries; CycleStart++)
+	{
+		if (SortedIndices[CycleStart] == INDEX_NONE || SortedIndices[CycleStart] == CycleStart)
+		{
+			continue;
+		}
+
+		bOrderChanged = true;
+		FOnlineSessionSearchResult HeldSearchResult = MoveTemp(SearchResults[CycleStart]);
+		FMultiplayerSessionBrowserEntry HeldBrowserEntry = MoveTemp(BrowserEntries[CycleStart]);
+		int32 TargetIndex = CycleStart;
+		while (true)
+		{
+			const int32 SourceIndex = SortedIndices[TargetIndex];
+			SortedIndices[TargetIndex] = INDEX_NONE;
+			if (SourceIndex == CycleStart)
 			{
-				return Left.BrowserEntry.OpenPublicConnections > Right.BrowserEntry.OpenPublicConnections;
+				SearchResults[TargetIndex] = MoveTemp(HeldSearchResult);
+				BrowserEntries[TargetIndex] = MoveTemp(HeldBrowserEntry);
+				break;
 			}
 
-			return Left.BrowserEntry.HostDisplayName < Right.BrowserEntry.HostDisplayName;
+			SearchResults[TargetIndex] = MoveTemp(SearchResults[SourceIndex]);
+			BrowserEntries[TargetIndex] = MoveTemp(BrowserEntries[SourceIndex]);
+			TargetIndex = SourceIndex;
 		}
-	);
+	}
 
-	SearchResults.Reset();
-	BrowserEntries.Reset();
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		BrowserEntries[Index].SearchResultIndex = Index;
+	}
+
+	return bOrderChanged;
+}
+
+bool UMultiplayerSessionsSubsystem::IsBetterBrowserEntry(const FMultiplayerSessionBrowserEntry& Left, const FMultiplayerSessionBrowserEntry& Right)
+{
+	if (Left.bCanJoin != Right.bCanJoin)
+	{
+		return Left.bCanJoin > Right.bCanJoin;
+	}
 
-	for (int32 SortedIndex = 0; SortedIndex < SessionPairs.Num(); SortedIndex++)
+	if (Left.Score != Right.Score)
 	{
-		FSortedSessionPair& Pair = SessionPairs[SortedIndex];
-		Pair.BrowserEntry.SearchResultIndex = SortedIndex;
-		SearchResults.Add(Pair.SearchResult);
-		BrowserEntries.Add(Pair.BrowserEntry);
+		return Left.Score > Right.Score;
 	}
+
+	return Left.HostDisplayName < Right.HostDisplayName;
+}
+
+void UMultiplayerSessionsSubsystem::BuildBrowserChangeSet(const TArray<FMultiplayerSessionBrowserEntry>& PreviousEntries, const TArray<FMultiplayerSessionBrowserEntry>& CurrentEntries, FMultiplayerSessionBrowserChangeSet& OutChangeSet) const
+{
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_BuildBrowserChangeSet);
+	OutChangeSet = FMultiplayerSessionBrowserChangeSet();
+
+	FMemMark ScratchMark(FMemStack::Get());
+	TArray<int32, TMemStackAllocator<>> PreviousOrder;
+	TArray<int32, TMemStackAllocator<>> CurrentOrder;
+	TArray<int32, TMemStackAllocator<>> PreviousIndexOfCurrent;
+	PreviousOrder.Reserve(PreviousEntries.Num());
+	CurrentOrder.Reserve(CurrentEntries.Num());
+	PreviousIndexOfCurrent.Init(INDEX_NONE, CurrentEntries.Num());
+	for (int32 Index = 0; Index < PreviousEntries.Num(); Index++)
+	{
+		PreviousOrder.Add(Index);
+	}
+
+	for (int32 Index = 0; Index < CurrentEntries.Num(); Index++)
+	{
+		CurrentOrder.Add(Index);
+	}
+
+	PreviousOrder.Sort([&PreviousEntries](int32 LeftIndex, int32 RightIndex)
+	{
+		return PreviousEntries[LeftIndex].EntryId.Compare(PreviousEntries[RightIndex].EntryId, ESearchCase::CaseSensitive) < 0;
+	});
+	CurrentOrder.Sort([&CurrentEntries](int32 LeftIndex, int32 RightIndex)
+	{
+		return CurrentEntries[LeftIndex].EntryId.Compare(CurrentEntries[RightIndex].EntryId, ESearchCase::CaseSensitive) < 0;
+	});
+
+	int32 PreviousCursor = 0;
+	int32 CurrentCursor = 0;
+	while (PreviousCursor < PreviousOrder.Num() || CurrentCursor < CurrentOrder.Num())
+	{
+		int32 Comparison = 0;
+		if (PreviousCursor >= PreviousOrder.Num())
+		{
+			Comparison = 1;
+		}
+		else if (CurrentCursor >= CurrentOrder.Num())
+		{
+			Comparison = -1;
+		}
+		else
+		{
+			Comparison = PreviousEntries[PreviousOrder[PreviousCursor]].EntryId.Compare(CurrentEntries[CurrentOrder[CurrentCursor]].EntryId, ESearchCase::CaseSensitive);
+		}
+
+		if (Comparison < 0)
+		{
+			OutChangeSet.RemovedEntryIds.Add(PreviousEntries[PreviousOrder[PreviousCursor]].EntryId);
+			PreviousCursor++;
+			continue;
+		}
+
+		const int32 CurrentIndex = CurrentOrder[CurrentCursor];
+		CurrentCursor++;
+		if (Comparison > 0)
+		{
+			OutChangeSet.AddedEntryIndices.Add(CurrentIndex);
+			continue;
+		}
+
+		const int32 PreviousIndex = PreviousOrder[PreviousCursor];
+		PreviousCursor++;
+		PreviousIndexOfCurrent[CurrentIndex] = PreviousIndex;
+
+		const EMultiplayerSessionEntryField ChangedFields = CompareBrowserEntryFields(PreviousEntries[PreviousIndex], CurrentEntries[CurrentIndex]);
+		if (ChangedFields != EMultiplayerSessionEntryField::None)
+		{
+			FMultiplayerSessionEntryUpdate& EntryUpdate = OutChangeSet.UpdatedEntries.AddDefaulted_GetRef();
+			EntryUpdate.EntryIndex = CurrentIndex;
+			EntryUpdate.ChangedFields = static_cast<int32>(ChangedFields);
+		}
+	}
+
+	OutChangeSet.AddedEntryIndices.Sort();
+	OutChangeSet.UpdatedEntries.Sort([](const FMultiplayerSessionEntryUpdate& Left, const FMultiplayerSessionEntryUpdate& Right)
+	{
+		return Left.EntryIndex < Right.EntryIndex;
+	});
+
+	int32 LastPreviousIndex = INDEX_NONE;
+	for (const int32 PreviousIndex : PreviousIndexOfCurrent)
+	{
+		if (PreviousIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		if (PreviousIndex < LastPreviousIndex)
+		{
+			OutChangeSet.bOrderChanged = true;
+			break;
+		}
+
+		LastPreviousIndex = PreviousIndex;
+	}
+}
+
+float UMultiplayerSessionsSubsystem::ScoreBrowserEntry(const FMultiplayerSessionBrowserEntry& BrowserEntry, const FMultiplayerSessionScoringWeights& ScoringWeights)
+{
+	int32 PingInMs = BrowserEntry.PingInMs;
+	if (PingInMs < 0)
+	{
+		PingInMs = FMath::Max(0, ScoringWeights.UnknownPingMs);
+	}
+
+	float FillRatio = 0.0f;
+	if (BrowserEntry.MaxPlayers > 0)
+	{
+		FillRatio = FMath::Clamp(static_cast<float>(BrowserEntry.CurrentPlayers) / static_cast<float>(BrowserEntry.MaxPlayers), 0.0f, 1.0f);
+	}
+
+	const int32 LowestStatusPriority = ResolveStatusSortPriority(EMultiplayerAdvertisedSessionStatus::Full);
+	const float StatusFactor = static_cast<float>(LowestStatusPriority - ResolveStatusSortPriority(BrowserEntry.Status)) / static_cast<float>(LowestStatusPriority);
+
+	float Score = 0.0f;
+	Score -= ScoringWeights.PingWeight * static_cast<float>(PingInMs);
+	Score += ScoringWeights.FillRatioWeight * FillRatio;
+	Score += ScoringWeights.StatusWeight * FMath::Clamp(StatusFactor, 0.0f, 1.0f);
+
+	if (BrowserEntry.bIsPreferredRegion == true)
+	{
+		Score += ScoringWeights.RegionWeight;
+	}
+
+	if (BrowserEntry.bHostIsFriend == true)
+	{
+		Score += ScoringWeights.FriendWeight;
+	}
+
+	return Score;
+}
+
+void UMultiplayerSessionsSubsystem::SetSessionScorer(UObject* NewSessionScorer)
+{
+	if (NewSessionScorer != nullptr && NewSessionScorer->GetClass()->ImplementsInterface(UMultiplayerSessionScorer::StaticClass()) == true)
+	{
+		SessionScorer = NewSessionScorer;
+		return;
+	}
+
+	if (NewSessionScorer != nullptr)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Session scorer %s does not implement MultiplayerSessionScorer. Using the default scorer."), *GetNameSafe(NewSessionScorer));
+	}
+
+	UClass* ScorerClass = SessionScorerClass.LoadSynchronous();
+	if (ScorerClass == nullptr || ScorerClass->ImplementsInterface(UMultiplayerSessionScorer::StaticClass()) == false)
+	{
+		ScorerClass = UMultiplayerSessionWeightedScorer::StaticClass();
+	}
+
+	SessionScorer = NewObject<UObject>(this, ScorerClass);
 }
 
 int32 UMultiplayerSessionsSubsystem::FindCachedSearchResultIndexByEntryId(const FString& EntryId) const
@@ -361,6 +749,56 @@ int32 UMultiplayerSessionsSubsystem::FindCachedSearchResultIndexByEntryId(const
 	return INDEX_NONE;
 }
 
+const FOnlineSessionSearchResult& UMultiplayerSessionsSubsystem::GetJoinSearchResult() const
+{
+	if (ActiveOperation.JoinCachedResultIndex != INDEX_NONE && CachedSearchResults.IsValidIndex(ActiveOperation.JoinCachedResultIndex) == true)
+	{
+		return CachedSearchResults[ActiveOperation.JoinCachedResultIndex];
+	}
+
+	return ActiveOperation.JoinResult;
+}
+
+void UMultiplayerSessionsSubsystem::TrimCachedSearchResults()
+{
+	if (bLeanSearchCache == false)
+	{
+		return;
+	}
+
+	const int32 MaxEntries = FMath::Max(1, LeanSearchCacheMaxEntries);
+	if (CachedSearchResults.Num() > MaxEntries)
+	{
+		CachedSearchResults.SetNum(MaxEntries);
+	}
+
+	if (CachedBrowserEntries.Num() > MaxEntries)
+	{
+		CachedBrowserEntries.SetNum(MaxEntries);
+	}
+
+	for (FOnlineSessionSearchResult& SearchResult : CachedSearchResults)
+	{
+		FOnlineSessionSettings& SessionSettings = SearchResult.Session.SessionSettings;
+		for (FSessionSettings::TIterator It = SessionSettings.Settings.CreateIterator(); It; ++It)
+		{
+			if (IsLeanCacheSettingKey(It.Key()) == false)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		SessionSettings.Settings.Compact();
+		SessionSettings.Settings.Shrink();
+		SessionSettings.MemberSettings.Empty();
+		SearchResult.Session.OwningUserName.Empty();
+	}
+
+	CachedSearchResults.Shrink();
+	CachedBrowserEntries.Shrink();
+	UpdateCachedSearchBytesStat();
+}
+
 EMultiplayerAdvertisedSessionStatus UMultiplayerSessionsSubsystem::ResolveDisplayStatus(EMultiplayerAdvertisedSessionStatus AdvertisedStatus, int32 OpenPublicConnections)
 {
 	if (OpenPublicConnections <= 0)
@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionsPrivate.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+namespace
+{
+	TAutoConsoleVariable<float> CVarCreateTimeoutSeconds(
+		TEXT("ms.Timeout.Create"),
+		-1.0f,
+		TEXT("Overrides CreateTimeoutSeconds for new operations. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarFindTimeoutSeconds(
+		TEXT("ms.Timeout.Find"),
+		-1.0f,
+		TEXT("Overrides FindTimeoutSeconds for new operations. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarJoinTimeoutSeconds(
+		TEXT("ms.Timeout.Join"),
+		-1.0f,
+		TEXT("Overrides JoinTimeoutSeconds for new operations. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarDestroyTimeoutSeconds(
+		TEXT("ms.Timeout.Destroy"),
+		-1.0f,
+		TEXT("Overrides DestroyTimeoutSeconds for new operations. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarUpdateTimeoutSeconds(
+		TEXT("ms.Timeout.Update"),
+		-1.0f,
+		TEXT("Overrides UpdateTimeoutSeconds for new operations. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarStartEndTimeoutSeconds(
+		TEXT("ms.Timeout.StartEnd"),
+		-1.0f,
+		TEXT("Overrides StartEndTimeoutSeconds for new operations. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarTravelTimeoutSeconds(
+		TEXT("ms.Timeout.Travel"),
+		-1.0f,
+		TEXT("Overrides TravelTimeoutSeconds for new operations. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarRecoveryGraceSeconds(
+		TEXT("ms.Timeout.RecoveryGrace"),
+		-1.0f,
+		TEXT("Overrides RecoveryGraceSeconds for new recoveries. Negative uses the configured value."));
+
+	TAutoConsoleVariable<float> CVarRecoveryTimeoutSeconds(
+		TEXT("ms.Timeout.Recovery"),
+		-1.0f,
+		TEXT("Overrides RecoveryTimeoutSeconds for new recoveries. Negative uses the configured value."));
+
+	TAutoConsoleVariable<int32> CVarSearchPingBucketSize(
+		TEXT("ms.Search.PingBucketSize"),
+		-1,
+		TEXT("Overrides SearchPingBucketSize for new searches. Negative uses the configured value."));
+
+	TAutoConsoleVariable<int32> CVarDefaultMaxSearchResults(
+		TEXT("ms.Search.MaxResults"),
+		-1,
+		TEXT("Overrides DefaultMaxSearchResults. Negative uses the configured value."));
+
+	FDelegateHandle ConsoleFindDelegateHandle;
+
+	float ResolveOverride(const TAutoConsoleVariable<float>& Variable, float ConfiguredValue)
+	{
+		const float OverrideValue = Variable.GetValueOnGameThread();
+		return OverrideValue >= 0.0f ? OverrideValue : ConfiguredValue;
+	}
+
+	int32 ResolveOverride(const TAutoConsoleVariable<int32>& Variable, int32 ConfiguredValue)
+	{
+		const int32 OverrideValue = Variable.GetValueOnGameThread();
+		return OverrideValue >= 0 ? OverrideValue : ConfiguredValue;
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice FindCommand(
+		TEXT("ms.Find"),
+		TEXT("Starts a session search and logs the best results when it completes. Usage: ms.Find [MaxResults] [Lan]."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World);
+			if (Subsystem == nullptr)
+			{
+				Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+				return;
+			}
+
+			if (Subsystem->IsBusy() == true)
+			{
+				Ar.Log(TEXT("Find skipped: another session operation is running."));
+				return;
+			}
+
+			FMultiplayerSessionSearchRequest SearchRequest;
+			SearchRequest.MaxSearchResults = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : Subsystem->GetDefaultMaxSearchResults();
+			SearchRequest.bUseLan = Args.Num() > 1 && (Args[1].Equals(TEXT("Lan"), ESearchCase::IgnoreCase) == true || FCString::Atoi(*Args[1]) != 0);
+
+			Subsystem->MultiplayerOnFindSessionsComplete.Remove(ConsoleFindDelegateHandle);
+			const TWeakObjectPtr<UMultiplayerSessionsSubsystem> WeakSubsystem(Subsystem);
+			const double StartSeconds = FPlatformTime::Seconds();
+			ConsoleFindDelegateHandle = Subsystem->MultiplayerOnFindSessionsComplete.AddLambda([WeakSubsystem, StartSeconds](const TArray<FOnlineSessionSearchResult>& SearchResults, bool bWasSuccessful)
+			{
+				UMultiplayerSessionsSubsystem* CompletedSubsystem = WeakSubsystem.Get();
+				if (CompletedSubsystem == nullptr)
+				{
+					return;
+				}
+
+				CompletedSubsystem->MultiplayerOnFindSessionsComplete.Remove(ConsoleFindDelegateHandle);
+				ConsoleFindDelegateHandle.Reset();
+
+				const TArray<FMultiplayerSessionBrowserEntry> BrowserEntries = CompletedSubsystem->GetCachedBrowserEntries();
+				UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("ms.Find %s in %.1f ms with %d entries."), bWasSuccessful == true ? TEXT("succeeded") : TEXT("failed"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0, BrowserEntries.Num());
+				for (int32 EntryIndex = 0; EntryIndex < FMath::Min(10, BrowserEntries.Num()); EntryIndex++)
+				{
+					const FMultiplayerSessionBrowserEntry& BrowserEntry = BrowserEntries[EntryIndex];
+					UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("  %s Host=%s Ping=%d Open=%d/%d Score=%.2f CanJoin=%d"), *BrowserEntry.EntryId, *BrowserEntry.HostDisplayName, BrowserEntry.PingInMs, BrowserEntry.OpenPublicConnections, BrowserEntry.MaxPlayers, BrowserEntry.Score, BrowserEntry.bCanJoin == true ? 1 : 0);
+				}
+			});
+
+			Subsystem->FindSessionsFromRequest(SearchRequest);
+			Ar.Logf(TEXT("Searching for up to %d %s sessions."), SearchRequest.MaxSearchResults, SearchRequest.bUseLan == true ? TEXT("LAN") : TEXT("online"));
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice JoinCommand(
+		TEXT("ms.Join"),
+		TEXT("Joins a cached browser entry. Usage: ms.Join <EntryId>."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World);
+			if (Subsystem == nullptr)
+			{
+				Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+				return;
+			}
+
+			if (Args.Num() == 0)
+			{
+				Ar.Log(TEXT("Usage: ms.Join <EntryId>. Run ms.Find first to list entry IDs."));
+				return;
+			}
+
+			if (Subsystem->JoinSessionByEntryId(Args[0]) == false)
+			{
+				Ar.Logf(TEXT("Join of %s was rejected: %s."), *Args[0], *StaticEnum<EMultiplayerSessionFailureReason>()->GetNameStringByValue(static_cast<int64>(Subsystem->GetLastFailureReason())));
+				return;
+			}
+
+			Ar.Logf(TEXT("Joining %s."), *Args[0]);
+		}));
+}
+
+float UMultiplayerSessionsSubsystem::GetTimeoutSeconds(EOperationTimeout Timeout) const
+{
+	float SoakTimeoutSeconds = 0.0f;
+	if (GetSoakTimeoutSeconds(Timeout, SoakTimeoutSeconds) == true)
+	{
+		return SoakTimeoutSeconds;
+	}
+
+	switch (Timeout)
+	{
+	case EOperationTimeout::Create:
+		return ResolveOverride(CVarCreateTimeoutSeconds, CreateTimeoutSeconds);
+	case EOperationTimeout::Find:
+		return ResolveOverride(CVarFindTimeoutSeconds, FindTimeoutSeconds);
+	case EOperationTimeout::Join:
+		return ResolveOverride(CVarJoinTimeoutSeconds, JoinTimeoutSeconds);
+	case EOperationTimeout::Destroy:
+		return ResolveOverride(CVarDestroyTimeoutSeconds, DestroyTimeoutSeconds);
+	case EOperationTimeout::Update:
+		return ResolveOverride(CVarUpdateTimeoutSeconds, UpdateTimeoutSeconds);
+	case EOperationTimeout::StartEnd:
+		return ResolveOverride(CVarStartEndTimeoutSeconds, StartEndTimeoutSeconds);
+	case EOperationTimeout::Travel:
+		return ResolveOverride(CVarTravelTimeoutSeconds, TravelTimeoutSeconds);
+	case EOperationTimeout::RecoveryGrace:
+		return ResolveOverride(CVarRecoveryGraceSeconds, RecoveryGraceSeconds);
+	case EOperationTimeout::Recovery:
+		return ResolveOverride(CVarRecoveryTimeoutSeconds, RecoveryTimeoutSeconds);
+	default:
+		return CreateTimeoutSeconds;
+	}
+}
+
+int32 UMultiplayerSessionsSubsystem::GetSearchPingBucketSize() const
+{
+	return FMath::Max(1, ResolveOverride(CVarSearchPingBucketSize, SearchPingBucketSize));
+}
+
+int32 UMultiplayerSessionsSubsystem::GetDefaultMaxSearchResults() const
+{
+	return FMath::Max(1, ResolveOverride(CVarDefaultMaxSearchResults, DefaultMaxSearchResults));
+}
@@ -0,0 +1,564 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionsDiagnostics.h"
+#include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsStats.h"
+#include "MultiplayerSessionsTrace.h"
+#include "Async/Async.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	FMultiplayerSessionLatencySummary MakeLatencySummary(const FMultiplayerSessionLatencyHistogram& Histogram, const FString& OperationName, const FString& StepName)
+	{
+		FMultiplayerSessionLatencySummary Summary;
+		Summary.OperationName = OperationName;
+		Summary.StepName = StepName;
+		Summary.SampleCount = static_cast<int32>(Histogram.GetSampleCount());
+		Summary.MinMs = static_cast<float>(Histogram.GetMinMilliseconds());
+		Summary.MeanMs = static_cast<float>(Histogram.GetMeanMilliseconds());
+		Summary.P50Ms = static_cast<float>(Histogram.GetPercentile(0.50));
+		Summary.P95Ms = static_cast<float>(Histogram.GetPercentile(0.95));
+		Summary.P99Ms = static_cast<float>(Histogram.GetPercentile(0.99));
+		Summary.MaxMs = static_cast<float>(Histogram.GetMaxMilliseconds());
+		return Summary;
+	}
+
+	SIZE_T GetBrowserEntryAllocatedSize(const FMultiplayerSessionBrowserEntry& BrowserEntry)
+	{
+		SIZE_T AllocatedSize = BrowserEntry.EntryId.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.SessionId.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.SessionDisplayName.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.HostDisplayName.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.MatchType.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.MapName.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.AdvertisedStatusText.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.StatusText.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.RegionTag.GetAllocatedSize();
+		AllocatedSize += BrowserEntry.JoinDisabledReasonText.GetAllocatedSize();
+		return AllocatedSize;
+	}
+
+	SIZE_T GetVariantPayloadSize(const FVariantData& Data)
+	{
+		if (Data.GetType() == EOnlineKeyValuePairDataType::String)
+		{
+			FString Value;
+			Data.GetValue(Value);
+			return Value.GetAllocatedSize();
+		}
+
+		if (Data.GetType() == EOnlineKeyValuePairDataType::Blob)
+		{
+			TArray<uint8> Value;
+			Data.GetValue(Value);
+			return Value.GetAllocatedSize();
+		}
+
+		return 0;
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpLatencyCommand(
+		TEXT("ms.Stats.Latency"),
+		TEXT("Prints per-operation and per-step latency percentiles for the multiplayer sessions subsystem."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (const UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World))
+			{
+				Subsystem->DumpOperationLatencyStats(Ar);
+				return;
+			}
+
+			Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+		}));
+#endif
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice ResetLatencyCommand(
+		TEXT("ms.Stats.ResetLatency"),
+		TEXT("Clears the multiplayer sessions latency histograms."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World))
+			{
+				Subsystem->ResetOperationLatencyStats();
+				return;
+			}
+
+			Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+		}));
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpCacheMemoryCommand(
+		TEXT("ms.Stats.CacheMemory"),
+		TEXT("Prints the memory held by the cached search results and browser entries, with a breakdown by setting key."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (const UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World))
+			{
+				Subsystem->DumpSearchCacheMemory(Ar);
+				return;
+			}
+
+			Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpFlightRecorderCommand(
+		TEXT("ms.Flight.Dump"),
+		TEXT("Prints the most recent multiplayer session flow events, oldest first."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (const UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World))
+			{
+				Subsystem->DumpFlightRecorder(Ar);
+				return;
+			}
+
+			Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice SaveFlightRecorderCommand(
+		TEXT("ms.Flight.Save"),
+		TEXT("Writes the multiplayer session flight recorder to Saved/Logs/MultiplayerSessions."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (const UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World))
+			{
+				FString FilePath;
+				if (Subsystem->SaveFlightRecorder(FilePath) == true)
+				{
+					Ar.Logf(TEXT("Writing flight recorder to %s."), *FilePath);
+					return;
+				}
+
+				Ar.Log(TEXT("No flight recorder events to save."));
+				return;
+			}
+
+			Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+		}));
+#endif
+}
+
+UMultiplayerSessionsSubsystem* MultiplayerSessionsConsole::FindSubsystem(UWorld* World)
+{
+	if (World == nullptr)
+	{
+		return nullptr;
+	}
+
+	UGameInstance* GameInstance = World->GetGameInstance();
+	if (GameInstance == nullptr)
+	{
+		return nullptr;
+	}
+
+	return GameInstance->GetSubsystem<UMultiplayerSessionsSubsystem>();
+}
+
+TArray<FMultiplayerSessionLatencySummary> UMultiplayerSessionsSubsystem::GetOperationLatencySummaries() const
+{
+	TArray<FMultiplayerSessionLatencySummary> Summaries;
+	if (OperationStats.IsValid() == false)
+	{
+		return Summaries;
+	}
+
+	for (int32 OperationIndex = 0; OperationIndex < OperationStats->GetNumOperations(); OperationIndex++)
+	{
+		const FMultiplayerSessionLatencyHistogram& OperationHistogram = OperationStats->GetOperationHistogram(OperationIndex);
+		const FString OperationName = OperationIndex == QuickMatchStatsIndex ? FString(TEXT("QuickMatch")) : OperationTypeToString(static_cast<EOperationType>(OperationIndex));
+		if (OperationHistogram.GetSampleCount() > 0)
+		{
+			FMultiplayerSessionLatencySummary& Summary = Summaries.Add_GetRef(MakeLatencySummary(OperationHistogram, OperationName, FString()));
+			Summary.SuccessCount = OperationStats->GetSuccessCount(OperationIndex);
+			Summary.FailureReasonCounts = OperationStats->GetFailureCounts(OperationIndex);
+			for (const TPair<EMultiplayerSessionFailureReason, int32>& FailureCount : Summary.FailureReasonCounts)
+			{
+				Summary.FailureCount += FailureCount.Value;
+			}
+		}
+
+		for (int32 StepIndex = 0; StepIndex < OperationStats->GetNumSteps(); StepIndex++)
+		{
+			const FMultiplayerSessionLatencyHistogram& StepHistogram = OperationStats->GetStepHistogram(OperationIndex, StepIndex);
+			if (StepHistogram.GetSampleCount() > 0)
+			{
+				Summaries.Add(MakeLatencySummary(StepHistogram, OperationName, OperationStepToString(static_cast<EOperationStep>(StepIndex))));
+			}
+		}
+	}
+
+	return Summaries;
+}
+
+void UMultiplayerSessionsSubsystem::ResetOperationLatencyStats()
+{
+	if (OperationStats.IsValid() == true)
+	{
+		OperationStats->Reset();
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+void UMultiplayerSessionsSubsystem::DumpOperationLatencyStats(FOutputDevice& Ar) const
+{
+	const TArray<FMultiplayerSessionLatencySummary> Summaries = GetOperationLatencySummaries();
+	if (Summaries.Num() == 0)
+	{
+		Ar.Log(TEXT("No multiplayer session operations recorded."));
+		return;
+	}
+
+	Ar.Logf(TEXT("%-24s %-26s %7s %10s %10s %10s %10s %10s"), TEXT("Operation"), TEXT("Step"), TEXT("Count"), TEXT("Mean ms"), TEXT("p50 ms"), TEXT("p95 ms"), TEXT("p99 ms"), TEXT("Max ms"));
+	for (const FMultiplayerSessionLatencySummary& Summary : Summaries)
+	{
+		const FString StepName = Summary.StepName.IsEmpty() == true ? FString(TEXT("<total>")) : Summary.StepName;
+		Ar.Logf(TEXT("%-24s %-26s %7d %10.1f %10.1f %10.1f %10.1f %10.1f"), *Summary.OperationName, *StepName, Summary.SampleCount, Summary.MeanMs, Summary.P50Ms, Summary.P95Ms, Summary.P99Ms, Summary.MaxMs);
+
+		if (Summary.StepName.IsEmpty() == false)
+		{
+			continue;
+		}
+
+		FString Outcomes = FString::Printf(TEXT("Succeeded=%d"), Summary.SuccessCount);
+		for (const TPair<EMultiplayerSessionFailureReason, int32>& FailureCount : Summary.FailureReasonCounts)
+		{
+			Outcomes += FString::Printf(TEXT(" %s=%d"), *StaticEnum<EMultiplayerSessionFailureReason>()->GetNameStringByValue(static_cast<int64>(FailureCount.Key)), FailureCount.Value);
+		}
+
+		Ar.Logf(TEXT("%-24s %s"), TEXT(""), *Outcomes);
+	}
+}
+#endif
+
+void UMultiplayerSessionsSubsystem::RecordActiveStepLatency(double CurrentSeconds)
+{
+	if (OperationStats.IsValid() == false || ActiveOperation.Type == EOperationType::None || ActiveOperation.StepBeginSeconds <= 0.0)
+	{
+		return;
+	}
+
+	const double ElapsedMilliseconds = (CurrentSeconds - ActiveOperation.StepBeginSeconds) * 1000.0;
+	OperationStats->RecordStep(static_cast<int32>(ActiveOperation.StepOperationType), static_cast<int32>(ActiveOperation.Step), ElapsedMilliseconds);
+}
+
+void UMultiplayerSessionsSubsystem::RecordCompletedOperationLatency(double CurrentSeconds)
+{
+	if (OperationStats.IsValid() == false || ActiveOperation.Type == EOperationType::None || ActiveOperation.BeginSeconds <= 0.0)
+	{
+		return;
+	}
+
+	RecordActiveStepLatency(CurrentSeconds);
+
+	const double ElapsedMilliseconds = (CurrentSeconds - ActiveOperation.BeginSeconds) * 1000.0;
+	OperationStats->RecordOperation(static_cast<int32>(ActiveOperation.Type), ElapsedMilliseconds, LastFailureReason);
+	if (ActiveOperation.QuickMatch.bActive == true)
+	{
+		OperationStats->RecordOperation(QuickMatchStatsIndex, (CurrentSeconds - ActiveOperation.QuickMatch.StartSeconds) * 1000.0, LastFailureReason);
+	}
+}
+
+void UMultiplayerSessionsSubsystem::TraceOperationEvent(EMultiplayerSessionTracePhase Phase) const
+{
+	if (MultiplayerSessionsTrace::IsChannelEnabled() == false)
+	{
+		return;
+	}
+
+	const EMultiplayerSessionFailureReason FailureReason = Phase == EMultiplayerSessionTracePhase::Completed ? LastFailureReason : EMultiplayerSessionFailureReason::None;
+	MultiplayerSessionsTrace::OutputOperationEvent(Phase, ActiveOperation.Generation, static_cast<uint8>(ActiveOperation.Type), OperationTypeToString(ActiveOperation.Type), static_cast<uint8>(ActiveOperation.Step), OperationStepToString(ActiveOperation.Step), FailureReason);
+}
+
+void UMultiplayerSessionsSubsystem::RecordFlightEvent(EMultiplayerSessionFlightEvent Event, EMultiplayerSessionFailureReason FailureReason)
+{
+	if (FlightRecorder.IsValid() == false)
+	{
+		return;
+	}
+
+	FMultiplayerSessionFlightRecord FlightRecord;
+	FlightRecord.Seconds = FPlatformTime::Seconds();
+	FlightRecord.Generation = ActiveOperation.Generation;
+	FlightRecord.Event = Event;
+	FlightRecord.OperationType = static_cast<uint8>(ActiveOperation.Type);
+	FlightRecord.OperationStep = static_cast<uint8>(ActiveOperation.Step);
+	FlightRecord.FlowState = CurrentFlowState;
+	FlightRecord.FailureReason = FailureReason;
+	FlightRecord.LocalUserNum = ActiveOperation.Type != EOperationType::None ? static_cast<int8>(ActiveOperation.LocalUser.LocalUserNum) : static_cast<int8>(INDEX_NONE);
+	FlightRecorder->Record(FlightRecord);
+
+	if (bSaveFlightRecorderOnFailure == false)
+	{
+		return;
+	}
+
+	if (FailureReason != EMultiplayerSessionFailureReason::None && FailureReason != EMultiplayerSessionFailureReason::Cancelled && PendingFlightRecorderSaveReason == EMultiplayerSessionFailureReason::None)
+	{
+		PendingFlightRecorderSaveReason = FailureReason;
+	}
+
+	if (PendingFlightRecorderSaveReason == EMultiplayerSessionFailureReason::None)
+	{
+		return;
+	}
+
+	if (Event != EMultiplayerSessionFlightEvent::OperationCompleted && ActiveOperation.Type != EOperationType::None)
+	{
+		return;
+	}
+
+	const EMultiplayerSessionFailureReason SaveReason = PendingFlightRecorderSaveReason;
+	PendingFlightRecorderSaveReason = EMultiplayerSessionFailureReason::None;
+	if (LastFlightRecorderSaveSeconds > 0.0 && FlightRecord.Seconds - LastFlightRecorderSaveSeconds < FlightRecorderSaveCooldownSeconds)
+	{
+		return;
+	}
+
+	LastFlightRecorderSaveSeconds = FlightRecord.Seconds;
+	FString FilePath;
+	if (WriteFlightRecorderFile(FilePath) == true)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Saving flight recorder after %s to %s."), *StaticEnum<EMultiplayerSessionFailureReason>()->GetNameStringByValue(static_cast<int64>(SaveReason)), *FilePath);
+	}
+}
+
+void UMultiplayerSessionsSubsystem::BuildFlightRecorderLines(TArray<FString>& OutLines) const
+{
+	OutLines.Reset();
+	if (FlightRecorder.IsValid() == false || FlightRecorder->GetNumRecords() == 0)
+	{
+		return;
+	}
+
+	const int32 NumRecords = FlightRecorder->GetNumRecords();
+	const double NewestSeconds = FlightRecorder->GetRecord(NumRecords - 1).Seconds;
+	OutLines.Reserve(NumRecords + 2);
+	OutLines.Add(FString::Printf(TEXT("Flight recorder: %d of %llu events, oldest first."), NumRecords, FlightRecorder->GetTotalRecorded()));
+	OutLines.Add(FString::Printf(TEXT("%10s %9s %-14s %6s %-12s %-24s %-12s %-24s %4s"), TEXT("Age ms"), TEXT("Delta ms"), TEXT("Event"), TEXT("Gen"), TEXT("Operation"), TEXT("Step"), TEXT("Flow"), TEXT("Failure"), TEXT("User")));
+
+	double PreviousSeconds = FlightRecorder->GetRecord(0).Seconds;
+	for (int32 RecordIndex = 0; RecordIndex < NumRecords; RecordIndex++)
+	{
+		const FMultiplayerSessionFlightRecord& FlightRecord = FlightRecorder->GetRecord(RecordIndex);
+		const FString FailureName = FlightRecord.FailureReason == EMultiplayerSessionFailureReason::None ? FString() : StaticEnum<EMultiplayerSessionFailureReason>()->GetNameStringByValue(static_cast<int64>(FlightRecord.FailureReason));
+		OutLines.Add(FString::Printf(TEXT("%10.1f %9.1f %-14s %6llu %-12s %-24s %-12s %-24s %4d"),
+			(FlightRecord.Seconds - NewestSeconds) * 1000.0,
+			(FlightRecord.Seconds - PreviousSeconds) * 1000.0,
+			FMultiplayerSessionFlightRecorder::EventToString(FlightRecord.Event),
+			FlightRecord.Generation,
+			*OperationTypeToString(static_cast<EOperationType>(FlightRecord.OperationType)),
+			*OperationStepToString(static_cast<EOperationStep>(FlightRecord.OperationStep)),
+			*StaticEnum<EMultiplayerSessionFlowState>()->GetNameStringByValue(static_cast<int64>(FlightRecord.FlowState)),
+			*FailureName,
+			static_cast<int32>(FlightRecord.LocalUserNum)));
+		PreviousSeconds = FlightRecord.Seconds;
+	}
+}
+
+bool UMultiplayerSessionsSubsystem::WriteFlightRecorderFile(FString& OutFilePath) const
+{
+	TArray<FString> Lines;
+	BuildFlightRecorderLines(Lines);
+	if (Lines.Num() == 0)
+	{
+		return false;
+	}
+
+	OutFilePath = FPaths::Combine(FPaths::ProjectLogDir(), TEXT("MultiplayerSessions"), FString::Printf(TEXT("FlightRecorder-%s.log"), *FDateTime::Now().ToString(TEXT("%Y.%m.%d-%H.%M.%S.%s"))));
+	Async(EAsyncExecution::ThreadPool, [FilePath = OutFilePath, Text = FString::Join(Lines, LINE_TERMINATOR)]()
+	{
+		if (FFileHelper::SaveStringToFile(Text, *FilePath) == false)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Could not write flight recorder to %s."), *FilePath);
+		}
+	});
+
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+void UMultiplayerSessionsSubsystem::DumpFlightRecorder(FOutputDevice& Ar) const
+{
+	TArray<FString> Lines;
+	BuildFlightRecorderLines(Lines);
+	if (Lines.Num() == 0)
+	{
+		Ar.Log(TEXT("No flight recorder events."));
+		return;
+	}
+
+	for (const FString& Line : Lines)
+	{
+		Ar.Log(Line);
+	}
+}
+
+bool UMultiplayerSessionsSubsystem::SaveFlightRecorder(FString& OutFilePath) const
+{
+	return WriteFlightRecorderFile(OutFilePath);
+}
+#endif
+
+void UMultiplayerSessionsSubsystem::NoteDelegateBroadcast()
+{
+	DelegateBroadcastsInWindow++;
+}
+
+void UMultiplayerSessionsSubsystem::UpdateBroadcastRateStat(double CurrentSeconds)
+{
+	if (DelegateBroadcastWindowStartSeconds <= 0.0)
+	{
+		DelegateBroadcastWindowStartSeconds = CurrentSeconds;
+		return;
+	}
+
+	const double WindowSeconds = CurrentSeconds - DelegateBroadcastWindowStartSeconds;
+	if (WindowSeconds < 1.0)
+	{
+		return;
+	}
+
+	SET_FLOAT_STAT(STAT_MultiplayerSessions_BroadcastsPerSecond, static_cast<float>(DelegateBroadcastsInWindow / WindowSeconds));
+	DelegateBroadcastsInWindow = 0;
+	DelegateBroadcastWindowStartSeconds = CurrentSeconds;
+}
+
+void UMultiplayerSessionsSubsystem::UpdateCachedSearchBytesStat() const
+{
+	SET_MEMORY_STAT(STAT_MultiplayerSessions_CachedBytes, GetCachedSearchAllocatedSize());
+}
+
+SIZE_T UMultiplayerSessionsSubsystem::GetCachedSearchAllocatedSize() const
+{
+	SIZE_T AllocatedSize = CachedSearchResults.GetAllocatedSize() + CachedBrowserEntries.GetAllocatedSize();
+	for (const FOnlineSessionSearchResult& SearchResult : CachedSearchResults)
+	{
+		AllocatedSize += SearchResult.Session.SessionSettings.Settings.GetAllocatedSize();
+		AllocatedSize += SearchResult.Session.OwningUserName.GetAllocatedSize();
+	}
+
+	for (const FMultiplayerSessionBrowserEntry& BrowserEntry : CachedBrowserEntries)
+	{
+		AllocatedSize += GetBrowserEntryAllocatedSize(BrowserEntry);
+	}
+
+	return AllocatedSize;
+}
+
+FMultiplayerSessionCacheMemoryReport UMultiplayerSessionsSubsystem::GetSearchCacheMemoryReport() const
+{
+	FMultiplayerSessionCacheMemoryReport Report;
+	Report.EntryCount = FMath::Max(CachedSearchResults.Num(), CachedBrowserEntries.Num());
+	Report.bLeanCache = bLeanSearchCache;
+	Report.SearchResultBytes = static_cast<int64>(CachedSearchResults.GetAllocatedSize());
+	Report.BrowserEntryBytes = static_cast<int64>(CachedBrowserEntries.GetAllocatedSize());
+
+	for (const FOnlineSessionSearchResult& SearchResult : CachedSearchResults)
+	{
+		const FOnlineSessionSettings& SessionSettings = SearchResult.Session.SessionSettings;
+		Report.SearchResultBytes += static_cast<int64>(SearchResult.Session.OwningUserName.GetAllocatedSize());
+		Report.SearchResultBytes += static_cast<int64>(SessionSettings.Settings.GetAllocatedSize());
+		Report.SearchResultBytes += static_cast<int64>(SessionSettings.MemberSettings.GetAllocatedSize());
+		if (SearchResult.Session.SessionInfo.IsValid() == true)
+		{
+			Report.SearchResultBytes += SearchResult.Session.SessionInfo->GetSize();
+		}
+
+		const int64 SlotBytes = SessionSettings.Settings.Num() > 0 ? static_cast<int64>(SessionSettings.Settings.GetAllocatedSize() / SessionSettings.Settings.Num()) : 0;
+		for (const TPair<FName, FOnlineSessionSetting>& Setting : SessionSettings.Settings)
+		{
+			const int64 PayloadBytes = static_cast<int64>(GetVariantPayloadSize(Setting.Value.Data));
+			Report.SearchResultBytes += PayloadBytes;
+			Report.SettingBytesByKey.FindOrAdd(Setting.Key) += SlotBytes + PayloadBytes;
+		}
+	}
+
+	for (const FMultiplayerSessionBrowserEntry& BrowserEntry : CachedBrowserEntries)
+	{
+		Report.BrowserEntryBytes += static_cast<int64>(GetBrowserEntryAllocatedSize(BrowserEntry));
+	}
+
+	Report.TotalBytes = Report.SearchResultBytes + Report.BrowserEntryBytes;
+	Report.BytesPerEntry = Report.EntryCount > 0 ? Report.TotalBytes / Report.EntryCount : 0;
+	Report.SettingBytesByKey.ValueSort([](int64 Left, int64 Right)
+	{
+		return Left > Right;
+	});
+
+	return Report;
+}
+
+#if !UE_BUILD_SHIPPING
+void UMultiplayerSessionsSubsystem::DumpSearchCacheMemory(FOutputDevice& Ar) const
+{
+	const FMultiplayerSessionCacheMemoryReport Report = GetSearchCacheMemoryReport();
+	Ar.Logf(TEXT("Search cache: %d entries, %lld bytes total, %lld bytes per entry%s."), Report.EntryCount, Report.TotalBytes, Report.BytesPerEntry, Report.bLeanCache == true ? TEXT(", lean") : TEXT(""));
+	Ar.Logf(TEXT("  Search results %12lld bytes"), Report.SearchResultBytes);
+	Ar.Logf(TEXT("  Browser entries %11lld bytes"), Report.BrowserEntryBytes);
+	for (const TPair<FName, int64>& KeyBytes : Report.SettingBytesByKey)
+	{
+		Ar.Logf(TEXT("    %-28s %10lld bytes"), *KeyBytes.Key.ToString(), KeyBytes.Value);
+	}
+}
+#endif
+
+FString UMultiplayerSessionsSubsystem::OperationTypeToString(EOperationType OperationType)
+{
+	switch (OperationType)
+	{
+	case EOperationType::Create:
+		return TEXT("Create");
+	case EOperationType::Find:
+		return TEXT("Find");
+	case EOperationType::Join:
+		return TEXT("Join");
+	case EOperationType::Destroy:
+		return TEXT("Destroy");
+	case EOperationType::Update:
+		return TEXT("Update");
+	case EOperationType::Start:
+		return TEXT("Start");
+	case EOperationType::End:
+		return TEXT("End");
+	case EOperationType::FindFriend:
+		return TEXT("FindFriend");
+	case EOperationType::DirectTravel:
+		return TEXT("DirectTravel");
+	default:
+		return TEXT("None");
+	}
+}
+
+FString UMultiplayerSessionsSubsystem::OperationStepToString(EOperationStep OperationStep)
+{
+	switch (OperationStep)
+	{
+	case EOperationStep::DestroyExistingForCreate:
+		return TEXT("DestroyExistingForCreate");
+	case EOperationStep::DestroyExistingForJoin:
+		return TEXT("DestroyExistingForJoin");
+	case EOperationStep::AwaitingAdmission:
+		return TEXT("AwaitingAdmission");
+	case EOperationStep::ReservingSlot:
+		return TEXT("ReservingSlot");
+	case EOperationStep::Executing:
+		return TEXT("Executing");
+	case EOperationStep::WaitingForTravel:
+		return TEXT("WaitingForTravel");
+	case EOperationStep::Recovering:
+		return TEXT("Recovering");
+	case EOperationStep::RecoveryDestroy:
+		return TEXT("RecoveryDestroy");
+	default:
+		return TEXT("None");
+	}
+}
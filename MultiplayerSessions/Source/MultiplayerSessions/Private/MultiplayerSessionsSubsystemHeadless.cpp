@@ -0,0 +1,123 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionsStats.h"
+#include "CoreGlobals.h"
+#include "Engine/World.h"
+#include "Interfaces/OnlineIdentityInterface.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "OnlineSubsystem.h"
+
+bool UMultiplayerSessionsSubsystem::StartHeadlessHost()
+{
+	if (IsHeadlessProcess() == false)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("StartHeadlessHost ignored: the process is not a dedicated server."));
+		return false;
+	}
+
+	if (bHeadlessHostCreating == true || bHeadlessHostReady == true)
+	{
+		return bHeadlessHostReady;
+	}
+
+	FMultiplayerSessionCreateRequest CreateRequest;
+	BuildHeadlessHostRequest(CreateRequest);
+	UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("Headless host creating session. MatchType=%s MaxPlayers=%d Map=%s Lan=%d"), *CreateRequest.MatchType, CreateRequest.NumPublicConnections, *CreateRequest.MapName, CreateRequest.bUseLan == true ? 1 : 0);
+
+	bHeadlessHostCreating = true;
+	CreateNamedSessionForLocalPlayer(nullptr, NAME_GameSession, CreateRequest);
+
+	if (bHeadlessHostCreating == true && ActiveOperation.Type != EOperationType::Create)
+	{
+		FinishHeadlessHost(false);
+	}
+
+	return bHeadlessHostCreating == true || bHeadlessHostReady == true;
+}
+
+bool UMultiplayerSessionsSubsystem::ShouldAutoStartHeadlessHost() const
+{
+	if (IsRunningDedicatedServer() == false)
+	{
+		return false;
+	}
+
+	return bHeadlessHostOnDedicatedServer == true || FParse::Param(FCommandLine::Get(), TEXT("MSHeadlessHost")) == true;
+}
+
+bool UMultiplayerSessionsSubsystem::IsHeadlessProcess() const
+{
+	if (IsRunningDedicatedServer() == true)
+	{
+		return true;
+	}
+
+	const UWorld* World = GetWorld();
+	return World != nullptr && World->GetNetMode() == NM_DedicatedServer;
+}
+
+void UMultiplayerSessionsSubsystem::BuildHeadlessHostRequest(FMultiplayerSessionCreateRequest& OutCreateRequest) const
+{
+	OutCreateRequest = HeadlessHostRequest;
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("MSMatchType="), OutCreateRequest.MatchType);
+	FParse::Value(CommandLine, TEXT("MSMaxPlayers="), OutCreateRequest.NumPublicConnections);
+	FParse::Value(CommandLine, TEXT("MSDisplayName="), OutCreateRequest.SessionDisplayName);
+	FParse::Value(CommandLine, TEXT("MSRegion="), OutCreateRequest.RegionTag);
+	if (FParse::Param(CommandLine, TEXT("MSLan")) == true)
+	{
+		OutCreateRequest.bUseLan = true;
+	}
+
+	const UWorld* World = GetWorld();
+	if (OutCreateRequest.MapName.IsEmpty() == true && World != nullptr)
+	{
+		OutCreateRequest.MapName = UWorld::RemovePIEPrefix(World->GetMapName());
+	}
+}
+
+void UMultiplayerSessionsSubsystem::ResolveHeadlessHostIdentity(FLocalUserContext& OutLocalUser) const
+{
+	OutLocalUser = FLocalUserContext();
+	if (CachedOnlineSubsystem == nullptr)
+	{
+		return;
+	}
+
+	const IOnlineIdentityPtr IdentityInterface = CachedOnlineSubsystem->GetIdentityInterface();
+	if (IdentityInterface.IsValid() == false)
+	{
+		return;
+	}
+
+	const FUniqueNetIdPtr ServerId = IdentityInterface->GetUniquePlayerId(0);
+	if (ServerId.IsValid() == true && ServerId->IsValid() == true)
+	{
+		OutLocalUser.UniqueNetId = ServerId;
+	}
+}
+
+void UMultiplayerSessionsSubsystem::FinishHeadlessHost(bool bWasSuccessful)
+{
+	bHeadlessHostCreating = false;
+	bHeadlessHostReady = bWasSuccessful;
+
+	const float BootToAdvertisedSeconds = static_cast<float>(FPlatformTime::Seconds() - GStartTime);
+	HeadlessHostBootToAdvertisedSeconds = bWasSuccessful == true ? BootToAdvertisedSeconds : -1.0f;
+
+	if (bWasSuccessful == true)
+	{
+		SET_FLOAT_STAT(STAT_MultiplayerSessions_BootToAdvertisedSeconds, BootToAdvertisedSeconds);
+		UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("Headless host advertised %s %.3fs after process start."), *NAME_GameSession.ToString(), BootToAdvertisedSeconds);
+	}
+	else
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Error, TEXT("Headless host failed to advertise a session. Reason=%d"), static_cast<int32>(LastFailureReason));
+	}
+
+	OnHeadlessHostReady.Broadcast(bWasSuccessful, HeadlessHostBootToAdvertisedSeconds);
+}
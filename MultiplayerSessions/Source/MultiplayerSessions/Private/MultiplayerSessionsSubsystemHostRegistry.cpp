@@ -0,0 +1,478 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionsPrivate.h"
+#include "OnlineSessionSettings.h"
+
+namespace
+{
+	constexpr float HostRegistryTickSeconds = 0.1f;
+}
+
+bool UMultiplayerSessionsSubsystem::RegisterSession(FName SessionName, const FMultiplayerSessionCreateRequest& CreateRequest, int32 GamePort)
+{
+	if (GamePort < 0 || GamePort > 65535)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("RegisterSession rejected %s. GamePort %d is not a valid port."), *SessionName.ToString(), GamePort);
+		return false;
+	}
+
+	if (SessionName.IsNone() == true || SessionName == NAME_GameSession)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("RegisterSession rejected %s. Registered sessions need their own name; the game session uses the regular flow."), *SessionName.ToString());
+		return false;
+	}
+
+	if (RegisteredSessions.Contains(SessionName) == true || OwnsSessionNamed(SessionName) == true)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("RegisterSession rejected %s. A session with that name already exists."), *SessionName.ToString());
+		return false;
+	}
+
+	if (AbandonedRegisteredCreates.Contains(SessionName) == true)
+	{
+		if (SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(SessionName) != nullptr)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("RegisterSession rejected %s. A timed out create of that session is still being cleaned up."), *SessionName.ToString());
+			return false;
+		}
+
+		AbandonedRegisteredCreates.Remove(SessionName);
+	}
+
+	FRegisteredSession& RegisteredSession = RegisteredSessions.Add(SessionName);
+	RegisteredSession.CreateRequest = CreateRequest;
+	RegisteredSession.GamePort = GamePort;
+	SanitizeCreateRequest(RegisteredSession.CreateRequest);
+	EnsureHostRegistryTicker();
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::UpdateRegisteredSession(FName SessionName, const FMultiplayerSessionCreateRequest& CreateRequest)
+{
+	FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+	if (RegisteredSession == nullptr || RegisteredSession->bDestroyRequested == true)
+	{
+		return false;
+	}
+
+	RegisteredSession->CreateRequest = CreateRequest;
+	SanitizeCreateRequest(RegisteredSession->CreateRequest);
+	RegisteredSession->bUpdatePending = RegisteredSession->State != EMultiplayerRegisteredSessionState::Queued;
+	EnsureHostRegistryTicker();
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::UpdateRegisteredSessionStatus(FName SessionName, EMultiplayerAdvertisedSessionStatus NewStatus)
+{
+	FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+	if (RegisteredSession == nullptr || RegisteredSession->bDestroyRequested == true)
+	{
+		return false;
+	}
+
+	if (RegisteredSession->CreateRequest.InitialStatus == NewStatus)
+	{
+		return true;
+	}
+
+	RegisteredSession->CreateRequest.InitialStatus = NewStatus;
+	RegisteredSession->bUpdatePending = RegisteredSession->State != EMultiplayerRegisteredSessionState::Queued;
+	EnsureHostRegistryTicker();
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::UnregisterSession(FName SessionName)
+{
+	FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+	if (RegisteredSession == nullptr)
+	{
+		return false;
+	}
+
+	RegisteredSession->bDestroyRequested = true;
+	RegisteredSession->bUpdatePending = false;
+	EnsureHostRegistryTicker();
+	return true;
+}
+
+TArray<FMultiplayerRegisteredSessionInfo> UMultiplayerSessionsSubsystem::GetRegisteredSessions() const
+{
+	TArray<FMultiplayerRegisteredSessionInfo> RegisteredSessionInfos;
+	RegisteredSessionInfos.Reserve(RegisteredSessions.Num());
+	for (const TPair<FName, FRegisteredSession>& RegisteredSessionPair : RegisteredSessions)
+	{
+		FMultiplayerRegisteredSessionInfo& RegisteredSessionInfo = RegisteredSessionInfos.AddDefaulted_GetRef();
+		RegisteredSessionInfo.SessionName = RegisteredSessionPair.Key;
+		RegisteredSessionInfo.State = RegisteredSessionPair.Value.State;
+		RegisteredSessionInfo.Status = RegisteredSessionPair.Value.CreateRequest.InitialStatus;
+		RegisteredSessionInfo.NumPublicConnections = RegisteredSessionPair.Value.CreateRequest.NumPublicConnections;
+		RegisteredSessionInfo.GamePort = RegisteredSessionPair.Value.GamePort;
+		RegisteredSessionInfo.bUpdatePending = RegisteredSessionPair.Value.bUpdatePending;
+	}
+
+	return RegisteredSessionInfos;
+}
+
+int32 UMultiplayerSessionsSubsystem::GetRegisteredSessionCallsInFlight() const
+{
+	int32 CallsInFlight = 0;
+	for (const TPair<FName, FRegisteredSession>& RegisteredSessionPair : RegisteredSessions)
+	{
+		if (RegisteredSessionPair.Value.CallInFlight != ERegisteredSessionCall::None)
+		{
+			CallsInFlight++;
+		}
+	}
+
+	return CallsInFlight;
+}
+
+void UMultiplayerSessionsSubsystem::EnsureHostRegistryTicker()
+{
+	if (HostRegistryTickerHandle.IsValid() == false)
+	{
+		HostRegistryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickHostRegistry), HostRegistryTickSeconds);
+	}
+}
+
+bool UMultiplayerSessionsSubsystem::TickHostRegistry(float DeltaTime)
+{
+	(void)DeltaTime;
+	if (RegisteredSessions.Num() == 0)
+	{
+		NextRegisteredUpdateFlushSeconds = 0.0;
+		HostRegistryTickerHandle.Reset();
+		return false;
+	}
+
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	TArray<FName> SessionNames;
+	RegisteredSessions.GenerateKeyArray(SessionNames);
+
+	for (const FName SessionName : SessionNames)
+	{
+		const FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+		if (RegisteredSession != nullptr && RegisteredSession->CallInFlight != ERegisteredSessionCall::None && CurrentSeconds >= RegisteredSession->CallDeadlineSeconds)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Registered session %s timed out waiting for the backend."), *SessionName.ToString());
+			const ERegisteredSessionCall TimedOutCall = RegisteredSession->CallInFlight;
+			FinishRegisteredSessionCall(SessionName, TimedOutCall, false);
+			if (TimedOutCall == ERegisteredSessionCall::Create)
+			{
+				AbandonRegisteredSessionCreate(SessionName);
+			}
+		}
+	}
+
+	int32 FreeCalls = HostRegistryMaxConcurrentCalls - GetRegisteredSessionCallsInFlight();
+	if (FreeCalls <= 0)
+	{
+		return true;
+	}
+
+	for (const FName SessionName : SessionNames)
+	{
+		const FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+		if (FreeCalls > 0 && RegisteredSession != nullptr && RegisteredSession->bDestroyRequested == true && RegisteredSession->CallInFlight == ERegisteredSessionCall::None)
+		{
+			if (IssueRegisteredSessionCall(SessionName, ERegisteredSessionCall::Destroy) == true)
+			{
+				FreeCalls--;
+			}
+		}
+	}
+
+	for (const FName SessionName : SessionNames)
+	{
+		const FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+		if (FreeCalls > 0 && RegisteredSession != nullptr && RegisteredSession->State == EMultiplayerRegisteredSessionState::Queued && RegisteredSession->bDestroyRequested == false)
+		{
+			if (IssueRegisteredSessionCall(SessionName, ERegisteredSessionCall::Create) == true)
+			{
+				FreeCalls--;
+			}
+		}
+	}
+
+	bool bAnyUpdatePending = false;
+	for (const TPair<FName, FRegisteredSession>& RegisteredSessionPair : RegisteredSessions)
+	{
+		bAnyUpdatePending |= RegisteredSessionPair.Value.bUpdatePending;
+	}
+
+	if (bAnyUpdatePending == false)
+	{
+		NextRegisteredUpdateFlushSeconds = 0.0;
+		return true;
+	}
+
+	if (NextRegisteredUpdateFlushSeconds <= 0.0)
+	{
+		NextRegisteredUpdateFlushSeconds = CurrentSeconds + HostRegistryUpdateBatchSeconds;
+	}
+
+	if (CurrentSeconds < NextRegisteredUpdateFlushSeconds)
+	{
+		return true;
+	}
+
+	int32 UpdatesIssued = 0;
+	for (const FName SessionName : SessionNames)
+	{
+		const FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+		if (FreeCalls > 0 && RegisteredSession != nullptr && RegisteredSession->bUpdatePending == true && RegisteredSession->CallInFlight == ERegisteredSessionCall::None)
+		{
+			UpdatesIssued++;
+			if (IssueRegisteredSessionCall(SessionName, ERegisteredSessionCall::Update) == true)
+			{
+				FreeCalls--;
+			}
+		}
+	}
+
+	if (UpdatesIssued > 0)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Host registry flushed %d session updates."), UpdatesIssued);
+	}
+
+	bAnyUpdatePending = false;
+	for (const TPair<FName, FRegisteredSession>& RegisteredSessionPair : RegisteredSessions)
+	{
+		bAnyUpdatePending |= RegisteredSessionPair.Value.bUpdatePending;
+	}
+
+	if (bAnyUpdatePending == false)
+	{
+		NextRegisteredUpdateFlushSeconds = 0.0;
+	}
+
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::IssueRegisteredSessionCall(FName SessionName, ERegisteredSessionCall Call)
+{
+	// EnsureSessionInterface releases every registered session when the interface changed, so look the entry up afterwards.
+	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
+	const bool bHasSessionInterface = EnsureSessionInterface(TEXT("HostRegistry"), FailureReason);
+
+	FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+	if (RegisteredSession == nullptr)
+	{
+		return false;
+	}
+
+	if (Call == ERegisteredSessionCall::Destroy && RegisteredSession->State == EMultiplayerRegisteredSessionState::Queued)
+	{
+		RegisteredSessions.Remove(SessionName);
+		OnRegisteredSessionChanged.Broadcast(SessionName, EMultiplayerRegisteredSessionState::Destroyed, true);
+		return false;
+	}
+
+	if (bHasSessionInterface == false)
+	{
+		FinishRegisteredSessionCall(SessionName, Call, false);
+		return false;
+	}
+
+	float TimeoutSeconds = GetTimeoutSeconds(EOperationTimeout::Create);
+	EMultiplayerRegisteredSessionState CallState = EMultiplayerRegisteredSessionState::Creating;
+	if (Call == ERegisteredSessionCall::Update)
+	{
+		TimeoutSeconds = GetTimeoutSeconds(EOperationTimeout::Update);
+		CallState = EMultiplayerRegisteredSessionState::Updating;
+	}
+	else if (Call == ERegisteredSessionCall::Destroy)
+	{
+		TimeoutSeconds = GetTimeoutSeconds(EOperationTimeout::Destroy);
+		CallState = EMultiplayerRegisteredSessionState::Destroying;
+	}
+
+	RegisteredSession->State = CallState;
+	RegisteredSession->CallInFlight = Call;
+	RegisteredSession->CallDeadlineSeconds = FPlatformTime::Seconds() + TimeoutSeconds;
+
+	bool bStarted = false;
+	if (Call == ERegisteredSessionCall::Destroy)
+	{
+		RegisteredSession->bUpdatePending = false;
+		bStarted = SessionInterface->DestroySession(SessionName);
+	}
+	else
+	{
+		RegisteredSession->bUpdatePending = false;
+		RegisteredSession->PendingSessionSettings = MakeShared<FOnlineSessionSettings>();
+		BuildRegisteredSessionSettings(*RegisteredSession, *RegisteredSession->PendingSessionSettings);
+
+		// The backend can complete synchronously and drop the entry, so keep the settings alive for the call.
+		const TSharedPtr<FOnlineSessionSettings> SessionSettings = RegisteredSession->PendingSessionSettings;
+		if (Call == ERegisteredSessionCall::Update)
+		{
+			bStarted = SessionInterface->UpdateSession(SessionName, *SessionSettings, true);
+		}
+		else
+		{
+			FLocalUserContext HostUser;
+			ResolveHeadlessHostIdentity(HostUser);
+			if (HostUser.UniqueNetId.IsValid() == true)
+			{
+				bStarted = SessionInterface->CreateSession(*HostUser.UniqueNetId, SessionName, *SessionSettings);
+			}
+			else
+			{
+				bStarted = SessionInterface->CreateSession(HostUser.LocalUserNum, SessionName, *SessionSettings);
+			}
+		}
+	}
+
+	RegisteredSession = RegisteredSessions.Find(SessionName);
+	if (bStarted == false && RegisteredSession != nullptr && RegisteredSession->CallInFlight == Call)
+	{
+		FinishRegisteredSessionCall(SessionName, Call, false);
+	}
+
+	return bStarted;
+}
+
+void UMultiplayerSessionsSubsystem::BuildRegisteredSessionSettings(const FRegisteredSession& RegisteredSession, FOnlineSessionSettings& OutSessionSettings) const
+{
+	ApplyCreateRequestToSessionSettings(OutSessionSettings, RegisteredSession.CreateRequest);
+	OutSessionSettings.Set(MultiplayerSessionsKeys::SessionName, NAME_GameSession.ToString(), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	OutSessionSettings.Remove(MultiplayerSessionsKeys::SlotReservations);
+	OutSessionSettings.Remove(MultiplayerSessionsKeys::ReservedSlots);
+	if (RegisteredSession.GamePort > 0)
+	{
+		OutSessionSettings.Set(MultiplayerSessionsKeys::GamePort, RegisteredSession.GamePort, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+
+	const EMultiplayerAdvertisedSessionStatus Status = RegisteredSession.CreateRequest.InitialStatus;
+	if (Status == EMultiplayerAdvertisedSessionStatus::Starting || Status == EMultiplayerAdvertisedSessionStatus::Full)
+	{
+		OutSessionSettings.bAllowJoinInProgress = false;
+	}
+}
+
+void UMultiplayerSessionsSubsystem::ApplyAdvertisedGamePort(FName SessionName, FString& InOutConnectString) const
+{
+	const FNamedOnlineSession* NamedSession = SessionInterface.IsValid() == true ? SessionInterface->GetNamedSession(SessionName) : nullptr;
+	int32 GamePort = 0;
+	if (NamedSession == nullptr || NamedSession->SessionSettings.Get(MultiplayerSessionsKeys::GamePort, GamePort) == false || GamePort <= 0 || GamePort > 65535)
+	{
+		return;
+	}
+
+	int32 PortSeparatorIndex = INDEX_NONE;
+	if (InOutConnectString.FindLastChar(TEXT(':'), PortSeparatorIndex) == true)
+	{
+		InOutConnectString.LeftInline(PortSeparatorIndex);
+	}
+
+	InOutConnectString += FString::Printf(TEXT(":%d"), GamePort);
+}
+
+void UMultiplayerSessionsSubsystem::FinishRegisteredSessionCall(FName SessionName, ERegisteredSessionCall Call, bool bWasSuccessful)
+{
+	FRegisteredSession* RegisteredSession = RegisteredSessions.Find(SessionName);
+	if (RegisteredSession == nullptr || RegisteredSession->CallInFlight != Call)
+	{
+		return;
+	}
+
+	RegisteredSession->CallInFlight = ERegisteredSessionCall::None;
+	RegisteredSession->PendingSessionSettings.Reset();
+
+	if (Call == ERegisteredSessionCall::Create && bWasSuccessful == false)
+	{
+		RegisteredSessions.Remove(SessionName);
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Registered session %s could not be created."), *SessionName.ToString());
+		OnRegisteredSessionChanged.Broadcast(SessionName, EMultiplayerRegisteredSessionState::Failed, false);
+		return;
+	}
+
+	if (Call == ERegisteredSessionCall::Destroy)
+	{
+		const bool bSessionNoLongerExists = SessionInterface.IsValid() == false || SessionInterface->GetNamedSession(SessionName) == nullptr;
+		if (bWasSuccessful == true || bSessionNoLongerExists == true)
+		{
+			RegisteredSessions.Remove(SessionName);
+			OnRegisteredSessionChanged.Broadcast(SessionName, EMultiplayerRegisteredSessionState::Destroyed, true);
+			return;
+		}
+
+		RegisteredSession->bDestroyRequested = false;
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Registered session %s could not be destroyed."), *SessionName.ToString());
+	}
+	else if (Call == ERegisteredSessionCall::Update && bWasSuccessful == false)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Registered session %s could not be updated."), *SessionName.ToString());
+	}
+
+	RegisteredSession->State = EMultiplayerRegisteredSessionState::Advertised;
+	OnRegisteredSessionChanged.Broadcast(SessionName, EMultiplayerRegisteredSessionState::Advertised, bWasSuccessful);
+}
+
+void UMultiplayerSessionsSubsystem::OnRegisteredSessionCreateComplete(FName SessionName, bool bWasSuccessful)
+{
+	if (AbandonedRegisteredCreates.Remove(SessionName) > 0)
+	{
+		if (bWasSuccessful == true && SessionInterface.IsValid() == true)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Registered session %s was created after its create timed out. Destroying it."), *SessionName.ToString());
+			SessionInterface->DestroySession(SessionName);
+		}
+
+		return;
+	}
+
+	FinishRegisteredSessionCall(SessionName, ERegisteredSessionCall::Create, bWasSuccessful);
+}
+
+void UMultiplayerSessionsSubsystem::OnRegisteredSessionUpdateComplete(FName SessionName, bool bWasSuccessful)
+{
+	FinishRegisteredSessionCall(SessionName, ERegisteredSessionCall::Update, bWasSuccessful);
+}
+
+void UMultiplayerSessionsSubsystem::OnRegisteredSessionDestroyComplete(FName SessionName, bool bWasSuccessful)
+{
+	FinishRegisteredSessionCall(SessionName, ERegisteredSessionCall::Destroy, bWasSuccessful);
+}
+
+void UMultiplayerSessionsSubsystem::AbandonRegisteredSessionCreate(FName SessionName)
+{
+	const FNamedOnlineSession* NamedSession = SessionInterface.IsValid() == true ? SessionInterface->GetNamedSession(SessionName) : nullptr;
+	if (NamedSession != nullptr && NamedSession->SessionState != EOnlineSessionState::Creating)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Registered session %s exists although its create timed out. Destroying it."), *SessionName.ToString());
+		SessionInterface->DestroySession(SessionName);
+		return;
+	}
+
+	AbandonedRegisteredCreates.Add(SessionName);
+}
+
+void UMultiplayerSessionsSubsystem::ReleaseRegisteredSessions()
+{
+	if (RegisteredSessions.Num() == 0)
+	{
+		AbandonedRegisteredCreates.Reset();
+		return;
+	}
+
+	TMap<FName, FRegisteredSession> ReleasedSessions = MoveTemp(RegisteredSessions);
+	RegisteredSessions.Reset();
+	AbandonedRegisteredCreates.Reset();
+	NextRegisteredUpdateFlushSeconds = 0.0;
+
+	for (const TPair<FName, FRegisteredSession>& RegisteredSessionPair : ReleasedSessions)
+	{
+		const bool bExistsOnBackend = SessionInterface.IsValid() == true && SessionInterface->GetNamedSession(RegisteredSessionPair.Key) != nullptr;
+		if (bExistsOnBackend == true)
+		{
+			SessionInterface->DestroySession(RegisteredSessionPair.Key);
+		}
+
+		UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Registered session %s released with its session interface."), *RegisteredSessionPair.Key.ToString());
+		OnRegisteredSessionChanged.Broadcast(RegisteredSessionPair.Key, EMultiplayerRegisteredSessionState::Destroyed, true);
+	}
+}
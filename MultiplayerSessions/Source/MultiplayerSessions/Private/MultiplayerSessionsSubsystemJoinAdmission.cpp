@@ -0,0 +1,118 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionPing.h"
+#include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsStats.h"
+#include "OnlineSessionSettings.h"
+
+bool UMultiplayerSessionsSubsystem::BeginJoinAdmissionDelay()
+{
+	if (bEnableJoinAdmission == false || JoinAdmissionMaxDelaySeconds <= 0.0f)
+	{
+		return false;
+	}
+
+	const float DelaySeconds = ResolveJoinAdmissionDelaySeconds(GetJoinSearchResult());
+	if (DelaySeconds <= 0.0f)
+	{
+		return false;
+	}
+
+	ActiveOperation.AdmissionNotBeforeSeconds = FPlatformTime::Seconds() + DelaySeconds;
+	SetOperationStep(EOperationStep::AwaitingAdmission, DelaySeconds + 1.0f);
+	INC_DWORD_STAT(STAT_MultiplayerSessions_JoinsDelayed);
+	SET_FLOAT_STAT(STAT_MultiplayerSessions_JoinAdmissionDelaySeconds, DelaySeconds);
+
+	UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Join for local user %d admitted in %.2fs."), BoundLocalUserNum, DelaySeconds);
+	return true;
+}
+
+float UMultiplayerSessionsSubsystem::ResolveJoinAdmissionDelaySeconds(const FOnlineSessionSearchResult& SearchResult) const
+{
+	const int32 MaxPlayers = SearchResult.Session.SessionSettings.NumPublicConnections;
+	const int32 OpenConnections = ResolveOpenPublicConnections(SearchResult);
+	if (MaxPlayers <= 0 || OpenConnections <= 0)
+	{
+		return 0.0f;
+	}
+
+	int32 JoinBusy = 0;
+	SearchResult.Session.SessionSettings.Get(MultiplayerSessionsKeys::JoinBusy, JoinBusy);
+	if (JoinBusy != 0)
+	{
+		return FMath::FRandRange(0.0f, JoinAdmissionMaxDelaySeconds);
+	}
+
+	const float FillRatio = 1.0f - static_cast<float>(FMath::Min(OpenConnections, MaxPlayers)) / static_cast<float>(MaxPlayers);
+	if (FillRatio < JoinAdmissionFillThreshold)
+	{
+		return 0.0f;
+	}
+
+	const float Pressure = JoinAdmissionFillThreshold < 1.0f ? (FillRatio - JoinAdmissionFillThreshold) / (1.0f - JoinAdmissionFillThreshold) : 1.0f;
+	return FMath::FRandRange(0.0f, JoinAdmissionMaxDelaySeconds * FMath::Clamp(Pressure, 0.0f, 1.0f));
+}
+
+void UMultiplayerSessionsSubsystem::TickHostJoinLoad(double CurrentSeconds)
+{
+	if (bEnableJoinAdmission == false || SessionInterface.IsValid() == false)
+	{
+		return;
+	}
+
+	FNamedOnlineSession* GameSession = SessionInterface->GetNamedSession(NAME_GameSession);
+	if (GameSession == nullptr || OwnsSessionNamed(NAME_GameSession) == false)
+	{
+		ResetHostJoinLoad();
+		return;
+	}
+
+	int32 Arrivals = 0;
+	const int32 OpenSlots = FMath::Max(0, GameSession->NumOpenPublicConnections);
+	if (bEnableSlotReservations == true && PingResponder.IsValid() == true && PingResponder->IsRunning() == true)
+	{
+		const uint32 ReservationRequests = PingResponder->GetReservationRequestCount();
+		Arrivals = static_cast<int32>(ReservationRequests >= JoinLoadLastReservationRequests ? ReservationRequests - JoinLoadLastReservationRequests : ReservationRequests);
+		JoinLoadLastReservationRequests = ReservationRequests;
+	}
+	else if (JoinLoadLastOpenSlots != INDEX_NONE && OpenSlots < JoinLoadLastOpenSlots)
+	{
+		Arrivals = JoinLoadLastOpenSlots - OpenSlots;
+	}
+
+	JoinLoadLastOpenSlots = OpenSlots;
+	for (int32 ArrivalIndex = 0; ArrivalIndex < Arrivals; ArrivalIndex++)
+	{
+		RecentHostJoinSeconds.Add(CurrentSeconds);
+	}
+
+	int32 ExpiredCount = 0;
+	while (ExpiredCount < RecentHostJoinSeconds.Num() && RecentHostJoinSeconds[ExpiredCount] <= CurrentSeconds - JoinBusyWindowSeconds)
+	{
+		ExpiredCount++;
+	}
+
+	if (ExpiredCount > 0)
+	{
+		RecentHostJoinSeconds.RemoveAt(0, ExpiredCount);
+	}
+
+	const int32 RecentArrivals = RecentHostJoinSeconds.Num();
+	HostJoinAttemptsPerSecond = static_cast<float>(RecentArrivals) / FMath::Max(1.0f, JoinBusyWindowSeconds);
+	SET_FLOAT_STAT(STAT_MultiplayerSessions_HostJoinAttemptsPerSecond, HostJoinAttemptsPerSecond);
+
+	const bool bBusy = bAdvertisedJoinBusy == true ? RecentArrivals * 2 >= JoinBusyArrivalsPerWindow : RecentArrivals >= JoinBusyArrivalsPerWindow;
+	QueueGameSessionAdvertisedValue(MultiplayerSessionsKeys::JoinBusy, bBusy == true ? 1 : 0, bAdvertisedJoinBusy == true ? 1 : 0);
+}
+
+void UMultiplayerSessionsSubsystem::ResetHostJoinLoad()
+{
+	RecentHostJoinSeconds.Reset();
+	JoinLoadLastOpenSlots = INDEX_NONE;
+	JoinLoadLastReservationRequests = PingResponder.IsValid() == true ? PingResponder->GetReservationRequestCount() : 0;
+	HostJoinAttemptsPerSecond = 0.0f;
+	bAdvertisedJoinBusy = false;
+	SET_FLOAT_STAT(STAT_MultiplayerSessions_HostJoinAttemptsPerSecond, 0.0f);
+}
@@ -0,0 +1,271 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionLanDiscovery.h"
+#include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsStats.h"
+#include "MultiplayerSessionsTrace.h"
+#include "Algo/BinarySearch.h"
+#include "Containers/Ticker.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "IPAddress.h"
+#include "OnlineSessionSettings.h"
+
+namespace
+{
+	constexpr double LanPublishIntervalSeconds = 0.1;
+}
+
+int32 UMultiplayerSessionsSubsystem::GetLanDiscoveryHostPort() const
+{
+	return LanDiscoveryHost.IsValid() == true && LanDiscoveryHost->IsRunning() == true ? LanDiscoveryHost->GetPort() : 0;
+}
+
+bool UMultiplayerSessionsSubsystem::BeginLanDiscoveryFind()
+{
+	if (ActiveOperation.PendingSearch.IsValid() == false)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FMultiplayerSessionLanSearch> LanSearch = MakeShared<FMultiplayerSessionLanSearch>(LanDiscoveryPort, LanDiscoveryPortCount, LanDiscoveryQueryAttempts, LanDiscoveryQueryIntervalSeconds, ActiveOperation.PendingSearch->MaxSearchResults);
+	if (LanSearch->Start() == false)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("LAN discovery socket could not be opened."));
+		return false;
+	}
+
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	ActiveOperation.LanSearch = LanSearch;
+	ActiveOperation.LanSearchEndSeconds = CurrentSeconds + LanDiscoverySearchSeconds;
+	ActiveOperation.NextLanPublishSeconds = CurrentSeconds;
+	ActiveOperation.LanPublishedResultCount = 0;
+	ActiveOperation.bLanResultsPending = false;
+	ActiveOperation.bLanCachePublished = false;
+	if (LanDiscoveryTickerHandle.IsValid() == false)
+	{
+		LanDiscoveryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickLanDiscoverySearches), 0.0f);
+	}
+
+	UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("LAN search for local user %d queries UDP ports %d-%d."), BoundLocalUserNum, LanDiscoveryPort, LanDiscoveryPort + LanDiscoveryPortCount - 1);
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::TickLanDiscoverySearches(float DeltaTime)
+{
+	(void)DeltaTime;
+	const double CurrentSeconds = FPlatformTime::Seconds();
+
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		const FOperationContext& Operation = GetLocalUserOperation(LocalUserNum);
+		if (Operation.Type != EOperationType::Find || Operation.Step != EOperationStep::Executing || Operation.LanSearch.IsValid() == false || Operation.PendingSearch.IsValid() == false)
+		{
+			continue;
+		}
+
+		FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+		const TSharedRef<FMultiplayerSessionLanSearch> LanSearch = ActiveOperation.LanSearch.ToSharedRef();
+		TArray<FMultiplayerSessionLanSearch::FHost> NewHosts;
+		LanSearch->Tick(CurrentSeconds, NewHosts);
+
+		if (NewHosts.Num() > 0)
+		{
+			TArray<FOnlineSessionSearchResult>& SearchResults = ActiveOperation.PendingSearch->SearchResults;
+			if (SearchResults.Num() == 0)
+			{
+				SET_FLOAT_STAT(STAT_MultiplayerSessions_LanFirstResultMs, (CurrentSeconds - ActiveOperation.StepBeginSeconds) * 1000.0);
+			}
+
+			INC_DWORD_STAT_BY(STAT_MultiplayerSessions_LanBeaconsReceived, NewHosts.Num());
+			for (FMultiplayerSessionLanSearch::FHost& Host : NewHosts)
+			{
+				SearchResults.Add(MoveTemp(Host.SearchResult));
+			}
+
+			ActiveOperation.bLanResultsPending = true;
+		}
+
+		if (CurrentSeconds >= ActiveOperation.LanSearchEndSeconds || LanSearch->GetHostCount() >= ActiveOperation.PendingSearch->MaxSearchResults)
+		{
+			INC_DWORD_STAT_BY(STAT_MultiplayerSessions_LanDuplicateBeacons, LanSearch->GetDuplicateCount());
+			UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("LAN search found %d hosts in %.0f ms. Duplicate beacons=%d"), LanSearch->GetHostCount(), (CurrentSeconds - ActiveOperation.StepBeginSeconds) * 1000.0, LanSearch->GetDuplicateCount());
+
+			ClearOperationDelegate(EOperationType::Find);
+			TArray<FOnlineSessionSearchResult> NewSearchResults;
+			TArray<FMultiplayerSessionBrowserEntry> NewBrowserEntries;
+			BuildBrowserResultsFromPendingSearch(NewSearchResults, NewBrowserEntries);
+			CompleteFindOperation(true, EMultiplayerSessionFailureReason::None, MoveTemp(NewSearchResults), MoveTemp(NewBrowserEntries));
+			continue;
+		}
+
+		if (ActiveOperation.bLanResultsPending == true && CurrentSeconds >= ActiveOperation.NextLanPublishSeconds)
+		{
+			ActiveOperation.NextLanPublishSeconds = CurrentSeconds + LanPublishIntervalSeconds;
+			PublishLanDiscoveryResults();
+		}
+	}
+
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		if (GetLocalUserOperation(LocalUserNum).LanSearch.IsValid() == true)
+		{
+			return true;
+		}
+	}
+
+	LanDiscoveryTickerHandle.Reset();
+	return false;
+}
+
+void UMultiplayerSessionsSubsystem::PublishLanDiscoveryResults()
+{
+	ActiveOperation.bLanResultsPending = false;
+	if (ActiveOperation.PendingSearch.IsValid() == false || ActiveOperation.QuickMatch.bActive == true || ActiveOperation.bBackgroundRefresh == true)
+	{
+		return;
+	}
+
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_PublishLanResults);
+	const TArray<FOnlineSessionSearchResult>& PendingSearchResults = ActiveOperation.PendingSearch->SearchResults;
+	TArray<FOnlineSessionSearchResult> NewSearchResults;
+	for (int32 Index = ActiveOperation.LanPublishedResultCount; Index < PendingSearchResults.Num(); Index++)
+	{
+		if (IsSearchResultRelevantToRequest(PendingSearchResults[Index], ActiveOperation.SearchRequest) == true)
+		{
+			NewSearchResults.Add(PendingSearchResults[Index]);
+		}
+	}
+	ActiveOperation.LanPublishedResultCount = PendingSearchResults.Num();
+
+	const bool bBroadcastChangeSet = OnBrowserEntriesChanged.IsBound();
+	FMultiplayerSessionBrowserChangeSet ChangeSet;
+	if (ActiveOperation.bLanCachePublished == false)
+	{
+		ActiveOperation.bLanCachePublished = true;
+		if (bBroadcastChangeSet == true)
+		{
+			ChangeSet.RemovedEntryIds.Reserve(CachedBrowserEntries.Num());
+			for (const FMultiplayerSessionBrowserEntry& BrowserEntry : CachedBrowserEntries)
+			{
+				ChangeSet.RemovedEntryIds.Add(BrowserEntry.EntryId);
+			}
+		}
+
+		CachedSearchRequest = ActiveOperation.SearchRequest;
+		CachedSearchResults.Reset();
+		CachedBrowserEntries.Reset();
+	}
+	else if (NewSearchResults.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FMultiplayerSessionBrowserEntry> NewBrowserEntries;
+	BuildBrowserEntries(NewSearchResults, ActiveOperation.SearchRequest, NewBrowserEntries);
+	ScoreBrowserEntries(NewBrowserEntries, ActiveOperation.SearchRequest.ScoringWeights);
+
+	// Entries already published keep their relative order, so each new host is inserted at its sorted position.
+	for (int32 Index = 0; Index < NewBrowserEntries.Num(); Index++)
+	{
+		const int32 InsertIndex = Algo::UpperBound(CachedBrowserEntries, NewBrowserEntries[Index], [](const FMultiplayerSessionBrowserEntry& Left, const FMultiplayerSessionBrowserEntry& Right)
+		{
+			return IsBetterBrowserEntry(Left, Right);
+		});
+
+		NewBrowserEntries[Index].SearchResultIndex = INDEX_NONE;
+		CachedBrowserEntries.Insert(MoveTemp(NewBrowserEntries[Index]), InsertIndex);
+		CachedSearchResults.Insert(MoveTemp(NewSearchResults[Index]), InsertIndex);
+	}
+
+	for (int32 Index = 0; Index < CachedBrowserEntries.Num(); Index++)
+	{
+		if (CachedBrowserEntries[Index].SearchResultIndex == INDEX_NONE && bBroadcastChangeSet == true)
+		{
+			ChangeSet.AddedEntryIndices.Add(Index);
+		}
+
+		CachedBrowserEntries[Index].SearchResultIndex = Index;
+	}
+
+	NoteDelegateBroadcast();
+	const uint64 PublishCount = ++BrowserEntriesPublishCount;
+	OnBrowserEntriesUpdated.Broadcast(CachedBrowserEntries);
+	if (BrowserEntriesPublishCount == PublishCount && bBroadcastChangeSet == true)
+	{
+		OnBrowserEntriesChanged.Broadcast(CachedBrowserEntries, ChangeSet);
+	}
+}
+
+void UMultiplayerSessionsSubsystem::TickLanDiscoveryHost()
+{
+	FNamedOnlineSession* GameSession = bUseNativeLanDiscovery == true && SessionInterface.IsValid() == true ? SessionInterface->GetNamedSession(NAME_GameSession) : nullptr;
+	if (GameSession == nullptr || GameSession->SessionSettings.bIsLANMatch == false || GameSession->SessionSettings.bShouldAdvertise == false || OwnsSessionNamed(NAME_GameSession) == false)
+	{
+		StopLanDiscoveryHost();
+		return;
+	}
+
+	if (LanDiscoveryHost.IsValid() == false)
+	{
+		LanDiscoveryHost = MakeShared<FMultiplayerSessionLanHost>();
+		if (LanDiscoveryHost->Start(LanDiscoveryPort, LanDiscoveryPortCount, LanDiscoveryMaxRepliesPerSecond) == false)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("LAN discovery could not bind a UDP port in %d-%d. LAN clients will not see this host."), LanDiscoveryPort, LanDiscoveryPort + LanDiscoveryPortCount - 1);
+			return;
+		}
+
+		UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("LAN discovery answers on UDP port %d."), LanDiscoveryHost->GetPort());
+	}
+
+	if (LanDiscoveryHost->IsRunning() == false)
+	{
+		return;
+	}
+
+	TArray<uint8> BeaconBody;
+	MultiplayerSessionLan::WriteBeacon(*GameSession, LanDiscoveryHost->GetInstanceId(), ResolveLanGamePort(), BeaconBody);
+	if (BeaconBody != LanBeaconBody)
+	{
+		LanBeaconBody = MoveTemp(BeaconBody);
+		LanDiscoveryHost->SetBeacon(LanBeaconBody);
+	}
+
+	uint32 RepliesSent = 0;
+	uint32 QueriesDropped = 0;
+	LanDiscoveryHost->GetCounters(RepliesSent, QueriesDropped);
+	SET_DWORD_STAT(STAT_MultiplayerSessions_LanRepliesSent, RepliesSent);
+	SET_DWORD_STAT(STAT_MultiplayerSessions_LanQueriesDropped, QueriesDropped);
+}
+
+void UMultiplayerSessionsSubsystem::StopLanDiscoveryHost()
+{
+	if (LanDiscoveryHost.IsValid() == false)
+	{
+		return;
+	}
+
+	LanDiscoveryHost->Stop();
+	LanDiscoveryHost.Reset();
+	LanBeaconBody.Reset();
+}
+
+int32 UMultiplayerSessionsSubsystem::ResolveLanGamePort() const
+{
+	const UWorld* World = GetWorld();
+	if (World == nullptr)
+	{
+		return FURL::UrlConfig.DefaultPort;
+	}
+
+	const UNetDriver* NetDriver = World->GetNetDriver();
+	const TSharedPtr<const FInternetAddr> LocalAddr = NetDriver != nullptr ? NetDriver->GetLocalAddr() : nullptr;
+	if (LocalAddr.IsValid() == true && LocalAddr->GetPort() > 0)
+	{
+		return LocalAddr->GetPort();
+	}
+
+	return World->URL.Port > 0 ? World->URL.Port : FURL::UrlConfig.DefaultPort;
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+
+EMultiplayerSessionFlowState UMultiplayerSessionsSubsystem::GetFlowStateForLocalPlayer(ULocalPlayer* LocalPlayer) const
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return EMultiplayerSessionFlowState::Idle;
+	}
+
+	if (LocalUserNum == BoundLocalUserNum)
+	{
+		return CurrentFlowState;
+	}
+
+	return LocalUserStates[LocalUserNum].FlowState;
+}
+
+bool UMultiplayerSessionsSubsystem::IsBusyForLocalPlayer(ULocalPlayer* LocalPlayer) const
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (LocalUserNum == BoundLocalUserNum)
+	{
+		return IsBusy();
+	}
+
+	const FLocalUserState& LocalUserState = LocalUserStates[LocalUserNum];
+	return LocalUserState.FlowState != EMultiplayerSessionFlowState::Idle && LocalUserState.Operation.bBackgroundRefresh == false;
+}
+
+EMultiplayerSessionFailureReason UMultiplayerSessionsSubsystem::GetLastFailureReasonForLocalPlayer(ULocalPlayer* LocalPlayer) const
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return EMultiplayerSessionFailureReason::InvalidLocalPlayer;
+	}
+
+	if (LocalUserNum == BoundLocalUserNum)
+	{
+		return LastFailureReason;
+	}
+
+	return LocalUserStates[LocalUserNum].LastFailureReason;
+}
+
+TArray<FMultiplayerSessionBrowserEntry> UMultiplayerSessionsSubsystem::GetCachedBrowserEntriesForLocalPlayer(ULocalPlayer* LocalPlayer) const
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		return TArray<FMultiplayerSessionBrowserEntry>();
+	}
+
+	if (LocalUserNum == BoundLocalUserNum)
+	{
+		return CachedBrowserEntries;
+	}
+
+	return LocalUserStates[LocalUserNum].CachedBrowserEntries;
+}
+
+bool UMultiplayerSessionsSubsystem::IsPublishingForLocalPlayer(ULocalPlayer* LocalPlayer) const
+{
+	return ResolveLocalUserNum(LocalPlayer) == BoundLocalUserNum;
+}
+
+int32 UMultiplayerSessionsSubsystem::ResolveLocalUserNum(ULocalPlayer* LocalPlayer) const
+{
+	if (LocalPlayer == nullptr)
+	{
+		return BoundLocalUserNum;
+	}
+
+	const UGameInstance* GameInstance = GetGameInstance();
+	if (GameInstance == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 LocalPlayerIndex = 0; LocalPlayerIndex < GameInstance->GetNumLocalPlayers(); LocalPlayerIndex++)
+	{
+		if (GameInstance->GetLocalPlayerByIndex(LocalPlayerIndex) == LocalPlayer)
+		{
+			return LocalPlayerIndex < MaxLocalUsers ? LocalPlayerIndex : INDEX_NONE;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void UMultiplayerSessionsSubsystem::BindLocalUser(int32 LocalUserNum)
+{
+	if (LocalUserNum < 0 || LocalUserNum >= MaxLocalUsers || LocalUserNum == BoundLocalUserNum)
+	{
+		return;
+	}
+
+	SwapLocalUserState(LocalUserStates[BoundLocalUserNum]);
+	SwapLocalUserState(LocalUserStates[LocalUserNum]);
+	BoundLocalUserNum = LocalUserNum;
+}
+
+void UMultiplayerSessionsSubsystem::SwapLocalUserState(FLocalUserState& LocalUserState)
+{
+	Swap(ActiveOperation, LocalUserState.Operation);
+	Swap(CurrentFlowState, LocalUserState.FlowState);
+	Swap(LastFailureReason, LocalUserState.LastFailureReason);
+	Swap(CachedSearchRequest, LocalUserState.CachedSearchRequest);
+	Swap(CachedSearchResults, LocalUserState.CachedSearchResults);
+	Swap(CachedBrowserEntries, LocalUserState.CachedBrowserEntries);
+	Swap(BrowserEntriesPublishCount, LocalUserState.BrowserEntriesPublishCount);
+	Swap(AutoRefreshLocalPlayer, LocalUserState.AutoRefreshLocalPlayer);
+	Swap(AutoRefreshRequest, LocalUserState.AutoRefreshRequest);
+	Swap(NextAutoRefreshSeconds, LocalUserState.NextAutoRefreshSeconds);
+	Swap(AutoRefreshIntervalSeconds, LocalUserState.AutoRefreshIntervalSeconds);
+	Swap(AutoRefreshChurn, LocalUserState.AutoRefreshChurn);
+	Swap(bAutoRefreshActive, LocalUserState.bAutoRefreshActive);
+	Swap(bAutoRefreshPaused, LocalUserState.bAutoRefreshPaused);
+	Swap(PingProber, LocalUserState.PingProber);
+}
+
+const UMultiplayerSessionsSubsystem::FOperationContext& UMultiplayerSessionsSubsystem::GetLocalUserOperation(int32 LocalUserNum) const
+{
+	return LocalUserNum == BoundLocalUserNum ? ActiveOperation : LocalUserStates[LocalUserNum].Operation;
+}
+
+int32 UMultiplayerSessionsSubsystem::FindLocalUserNumForGeneration(uint64 Generation) const
+{
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		if (GetLocalUserOperation(LocalUserNum).Generation == Generation)
+		{
+			return LocalUserNum;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32 UMultiplayerSessionsSubsystem::FindLocalUserNumInStep(EOperationStep Step) const
+{
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		if (GetLocalUserOperation(LocalUserNum).Step == Step)
+		{
+			return LocalUserNum;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+bool UMultiplayerSessionsSubsystem::IsSessionOperationRunningForOtherLocalUser(FName SessionName) const
+{
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		if (LocalUserNum == BoundLocalUserNum)
+		{
+			continue;
+		}
+
+		const FOperationContext& Operation = LocalUserStates[LocalUserNum].Operation;
+		if (Operation.Type != EOperationType::None && Operation.SessionName == SessionName && (Operation.Type != EOperationType::Find || Operation.QuickMatch.bActive == true))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
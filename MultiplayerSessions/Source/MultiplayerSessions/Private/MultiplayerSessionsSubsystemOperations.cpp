@@ -2,36 +2,68 @@
 
 #include "MultiplayerSessionsSubsystem.h"
 
+#include "MultiplayerSessionLanDiscovery.h"
+#include "MultiplayerSessionsDiagnostics.h"
 #include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsStats.h"
+#include "MultiplayerSessionsTrace.h"
 #include "Engine/GameInstance.h"
 #include "Engine/LocalPlayer.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
+#include "Interfaces/OnlineFriendsInterface.h"
 #include "Online/OnlineSessionNames.h"
 #include "OnlineSessionSettings.h"
+#include "OnlineSubsystem.h"
 
 bool UMultiplayerSessionsSubsystem::TickOperationTimeouts(float DeltaTime)
 {
 	(void)DeltaTime;
-	if (ActiveOperation.Type == EOperationType::None)
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	UpdateBroadcastRateStat(CurrentSeconds);
+	TickHostSlotReservations(CurrentSeconds);
+	TickHostJoinLoad(CurrentSeconds);
+	FlushGameSessionAdvertisedValues(CurrentSeconds);
+	TickLanDiscoveryHost();
+
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
 	{
-		return true;
+		if (GetLocalUserOperation(LocalUserNum).Type != EOperationType::None)
+		{
+			FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+			TickActiveOperation(CurrentSeconds);
+		}
 	}
 
-	const double CurrentSeconds = FPlatformTime::Seconds();
+	OperationTickSeconds += FPlatformTime::Seconds() - CurrentSeconds;
+	OperationTickCount++;
+	return true;
+}
+
+void UMultiplayerSessionsSubsystem::TickActiveOperation(double CurrentSeconds)
+{
+	if (ActiveOperation.bWaitingForSearchSlot == true && SearchOwnerLocalUserNum == INDEX_NONE)
+	{
+		BeginFindOperation();
+		return;
+	}
 
 	if (ActiveOperation.Step == EOperationStep::Recovering)
 	{
 		ContinueRecovery();
-		return true;
+		return;
+	}
+
+	if (ActiveOperation.Step == EOperationStep::AwaitingAdmission && CurrentSeconds >= ActiveOperation.AdmissionNotBeforeSeconds)
+	{
+		BeginJoinOperation();
+		return;
 	}
 
 	if (ActiveOperation.DeadlineSeconds > 0.0 && CurrentSeconds >= ActiveOperation.DeadlineSeconds)
 	{
 		HandleOperationTimeout();
 	}
-
-	return true;
 }
 
 bool UMultiplayerSessionsSubsystem::OperationRequiresSessionInterface(EOperationType OperationType) const
@@ -49,16 +81,24 @@ bool UMultiplayerSessionsSubsystem::OperationRequiresLocalPlayer(EOperationType
 	return false;
 }
 
-bool UMultiplayerSessionsSubsystem::TryBeginOperation(EOperationType OperationType, EMultiplayerSessionFlowState FlowState, ULocalPlayer* LocalPlayer, double TimeoutSeconds, EMultiplayerSessionFailureReason& OutFailureReason)
+bool UMultiplayerSessionsSubsystem::TryBeginOperation(EOperationType OperationType, EMultiplayerSessionFlowState FlowState, ULocalPlayer* LocalPlayer, double TimeoutSeconds, EMultiplayerSessionFailureReason& OutFailureReason, FName SessionName)
 {
 	OutFailureReason = EMultiplayerSessionFailureReason::None;
 
+	CancelBackgroundRefresh();
+
 	if (ActiveOperation.Type != EOperationType::None || CurrentFlowState != EMultiplayerSessionFlowState::Idle)
 	{
 		OutFailureReason = EMultiplayerSessionFailureReason::Busy;
 		return false;
 	}
 
+	if ((OperationType != EOperationType::Find && IsSessionOperationRunningForOtherLocalUser(SessionName) == true) || RegisteredSessions.Contains(SessionName) == true)
+	{
+		OutFailureReason = EMultiplayerSessionFailureReason::Busy;
+		return false;
+	}
+
 	if (OperationRequiresSessionInterface(OperationType) == true)
 	{
 		if (EnsureSessionInterface(TEXT("TryBeginOperation"), OutFailureReason) == false)
@@ -70,30 +110,38 @@ bool UMultiplayerSessionsSubsystem::TryBeginOperation(EOperationType OperationTy
 	FLocalUserContext LocalUser;
 	if (OperationRequiresLocalPlayer(OperationType) == true)
 	{
-		const UWorld* World = GetWorld();
-		const bool bDedicatedServerCreate = OperationType == EOperationType::Create && World != nullptr && World->GetNetMode() == NM_DedicatedServer;
-		if (bDedicatedServerCreate == false)
+		if (OperationType == EOperationType::Create && IsHeadlessProcess() == true)
 		{
-			if (ResolveLocalUser(LocalPlayer, LocalUser, OutFailureReason) == false)
-			{
-				return false;
-			}
+			ResolveHeadlessHostIdentity(LocalUser);
+		}
+		else if (ResolveLocalUser(LocalPlayer, LocalUser, OutFailureReason) == false)
+		{
+			return false;
 		}
 	}
 
+	StopPingProbes();
+
 	NextOperationGeneration++;
 	if (NextOperationGeneration == 0)
 	{
 		NextOperationGeneration++;
 	}
 
+	const double CurrentSeconds = FPlatformTime::Seconds();
 	ActiveOperation = FOperationContext();
 	ActiveOperation.Generation = NextOperationGeneration;
 	ActiveOperation.Type = OperationType;
 	ActiveOperation.Step = EOperationStep::Executing;
+	ActiveOperation.StepOperationType = OperationType;
 	ActiveOperation.LocalUser = LocalUser;
-	ActiveOperation.DeadlineSeconds = FPlatformTime::Seconds() + FMath::Max(1.0, TimeoutSeconds);
+	ActiveOperation.SessionName = SessionName;
+	ActiveOperation.BeginSeconds = CurrentSeconds;
+	ActiveOperation.StepBeginSeconds = CurrentSeconds;
+	ActiveOperation.DeadlineSeconds = CurrentSeconds + FMath::Max(1.0, TimeoutSeconds);
 	SetLastFailureReason(EMultiplayerSessionFailureReason::None);
+	TraceOperationEvent(EMultiplayerSessionTracePhase::Begin);
+	RecordFlightEvent(EMultiplayerSessionFlightEvent::OperationBegin, EMultiplayerSessionFailureReason::None);
 
 	SetFlowState(FlowState);
 	return true;
@@ -116,13 +164,51 @@ bool UMultiplayerSessionsSubsystem::IsCurrentOperation(uint64 CallbackGeneration
 
 void UMultiplayerSessionsSubsystem::SetOperationStep(EOperationStep NewStep, double TimeoutSeconds)
 {
-	ActiveOperation.Step = NewStep;
+	EnterOperationStep(NewStep);
 	ActiveOperation.DeadlineSeconds = FPlatformTime::Seconds() + FMath::Max(1.0, TimeoutSeconds);
 }
 
+void UMultiplayerSessionsSubsystem::EnterOperationStep(EOperationStep NewStep)
+{
+	if (ActiveOperation.Step == NewStep && ActiveOperation.StepOperationType == ActiveOperation.Type)
+	{
+		return;
+	}
+
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	RecordActiveStepLatency(CurrentSeconds);
+	ActiveOperation.Step = NewStep;
+	ActiveOperation.StepOperationType = ActiveOperation.Type;
+	ActiveOperation.StepBeginSeconds = CurrentSeconds;
+	TraceOperationEvent(EMultiplayerSessionTracePhase::StepChanged);
+	RecordFlightEvent(EMultiplayerSessionFlightEvent::StepChanged, EMultiplayerSessionFailureReason::None);
+}
+
 EMultiplayerSessionFlowState UMultiplayerSessionsSubsystem::ResetActiveOperation()
 {
 	const EMultiplayerSessionFlowState PreviousFlowState = CurrentFlowState;
+	RecordCompletedOperationLatency(FPlatformTime::Seconds());
+	if (ActiveOperation.Type != EOperationType::None)
+	{
+		TraceOperationEvent(EMultiplayerSessionTracePhase::Completed);
+		RecordFlightEvent(EMultiplayerSessionFlightEvent::OperationCompleted, LastFailureReason);
+		NoteDelegateBroadcast();
+	}
+
+	if (ActiveOperation.SlotReserver.IsValid() == true)
+	{
+		ActiveOperation.SlotReserver->Release();
+	}
+
+	if (ActiveOperation.Type == EOperationType::Find && SearchOwnerLocalUserNum == BoundLocalUserNum)
+	{
+		ClearOperationDelegate(EOperationType::Find);
+		if (SessionInterface.IsValid() == true)
+		{
+			SessionInterface->CancelFindSessions();
+		}
+	}
+
 	ActiveOperation = FOperationContext();
 	return PreviousFlowState;
 }
@@ -139,7 +225,7 @@ void UMultiplayerSessionsSubsystem::BroadcastIdleStateIfUnchanged(EMultiplayerSe
 		return;
 	}
 
-	if (NextOperationGeneration != ExpectedOperationGeneration)
+	if (ActiveOperation.Generation != 0 && ActiveOperation.Generation != ExpectedOperationGeneration)
 	{
 		return;
 	}
@@ -162,12 +248,20 @@ void UMultiplayerSessionsSubsystem::ClearOperationDelegate(EOperationType Operat
 
 	if (OperationType == EOperationType::Find)
 	{
+		ActiveOperation.bWaitingForSearchSlot = false;
+		ActiveOperation.LanSearch.Reset();
+		if (SearchOwnerLocalUserNum != INDEX_NONE && SearchOwnerLocalUserNum != BoundLocalUserNum)
+		{
+			return;
+		}
+
 		if (SessionInterface.IsValid() == true)
 		{
 			SessionInterface->ClearOnFindSessionsCompleteDelegate_Handle(FindSessionsCompleteDelegateHandle);
 		}
 
 		FindSessionsCompleteDelegateHandle = FDelegateHandle();
+		SearchOwnerLocalUserNum = INDEX_NONE;
 		return;
 	}
 
@@ -261,6 +355,7 @@ void UMultiplayerSessionsSubsystem::ClearAllDelegateHandles()
 	ClearPersistentSessionDelegates();
 	CreateSessionCompleteDelegateHandle = FDelegateHandle();
 	FindSessionsCompleteDelegateHandle = FDelegateHandle();
+	SearchOwnerLocalUserNum = INDEX_NONE;
 	FindFriendSessionCompleteDelegateHandle = FDelegateHandle();
 	FindFriendDelegateLocalUserNum = INDEX_NONE;
 	JoinSessionCompleteDelegateHandle = FDelegateHandle();
@@ -271,12 +366,48 @@ void UMultiplayerSessionsSubsystem::ClearAllDelegateHandles()
 	EndSessionCompleteDelegateHandle = FDelegateHandle();
 }
 
-void UMultiplayerSessionsSubsystem::ResetCommittedSessionState()
+void UMultiplayerSessionsSubsystem::ResetAllCommittedSessionState()
 {
-	CommittedSessionSettings.Reset();
-	bOwnsNamedSession = false;
-	bHasCommittedJoinInProgressPolicy = false;
-	bCommittedAllowJoinInProgress = true;
+	NamedSessionStates.Reset();
+	StopPingResponder();
+}
+
+void UMultiplayerSessionsSubsystem::ResetCommittedSessionState(FName SessionName)
+{
+	NamedSessionStates.Remove(SessionName);
+	if (SessionName == NAME_GameSession)
+	{
+		StopPingResponder();
+	}
+}
+
+UMultiplayerSessionsSubsystem::FNamedSessionState& UMultiplayerSessionsSubsystem::GetNamedSessionState(FName SessionName)
+{
+	return NamedSessionStates.FindOrAdd(SessionName);
+}
+
+void UMultiplayerSessionsSubsystem::BeginCreateAfterExistingSessionCleanup()
+{
+	if (SessionInterface.IsValid() == false)
+	{
+		CompleteCreateOperation(false, EMultiplayerSessionFailureReason::NoSessionInterface);
+		return;
+	}
+
+	if (SessionInterface->GetNamedSession(ActiveOperation.SessionName) != nullptr)
+	{
+		if (ActiveOperation.CreateRequest.bReplaceExistingSession == false)
+		{
+			CompleteCreateOperation(false, EMultiplayerSessionFailureReason::SessionAlreadyExists);
+			return;
+		}
+
+		EnterOperationStep(EOperationStep::DestroyExistingForCreate);
+		BeginDestroyOperation();
+		return;
+	}
+
+	BeginCreateOperation();
 }
 
 void UMultiplayerSessionsSubsystem::BeginCreateOperation()
@@ -287,9 +418,14 @@ void UMultiplayerSessionsSubsystem::BeginCreateOperation()
 		return;
 	}
 
-	SetOperationStep(EOperationStep::Executing, CreateTimeoutSeconds);
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Create));
+	if (ActiveOperation.SessionName == NAME_GameSession)
+	{
+		StartPingResponder();
+	}
 	ActiveOperation.PendingSessionSettings = MakeShared<FOnlineSessionSettings>();
 	ApplyCreateRequestToSessionSettings(*ActiveOperation.PendingSessionSettings, ActiveOperation.CreateRequest);
+	ActiveOperation.PendingSessionSettings->Set(MultiplayerSessionsKeys::SessionName, ActiveOperation.SessionName.ToString(), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
 
 	const uint64 Generation = ActiveOperation.Generation;
 	const FOnCreateSessionCompleteDelegate CompletionDelegate = FOnCreateSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnCreateSessionCompleteInternal, Generation);
@@ -298,11 +434,11 @@ void UMultiplayerSessionsSubsystem::BeginCreateOperation()
 	bool bStarted = false;
 	if (ActiveOperation.LocalUser.UniqueNetId.IsValid() == true)
 	{
-		bStarted = SessionInterface->CreateSession(*ActiveOperation.LocalUser.UniqueNetId, NAME_GameSession, *ActiveOperation.PendingSessionSettings);
+		bStarted = SessionInterface->CreateSession(*ActiveOperation.LocalUser.UniqueNetId, ActiveOperation.SessionName, *ActiveOperation.PendingSessionSettings);
 	}
 	else
 	{
-		bStarted = SessionInterface->CreateSession(ActiveOperation.LocalUser.LocalUserNum, NAME_GameSession, *ActiveOperation.PendingSessionSettings);
+		bStarted = SessionInterface->CreateSession(ActiveOperation.LocalUser.LocalUserNum, ActiveOperation.SessionName, *ActiveOperation.PendingSessionSettings);
 	}
 
 	if (bStarted == false)
@@ -322,11 +458,25 @@ void UMultiplayerSessionsSubsystem::BeginFindOperation()
 		return;
 	}
 
-	SetOperationStep(EOperationStep::Executing, FindTimeoutSeconds);
+	double SearchTimeoutSeconds = GetTimeoutSeconds(EOperationTimeout::Find);
+	if (ActiveOperation.QuickMatch.bActive == true)
+	{
+		SearchTimeoutSeconds = FMath::Min(SearchTimeoutSeconds, static_cast<double>(ActiveOperation.QuickMatch.Request.SearchDeadlineSeconds));
+	}
+
+	SetOperationStep(EOperationStep::Executing, SearchTimeoutSeconds);
+	if (SearchOwnerLocalUserNum != INDEX_NONE && SearchOwnerLocalUserNum != BoundLocalUserNum)
+	{
+		ActiveOperation.bWaitingForSearchSlot = true;
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Search for local user %d waits for the search of local user %d."), BoundLocalUserNum, SearchOwnerLocalUserNum);
+		return;
+	}
+
+	ActiveOperation.bWaitingForSearchSlot = false;
 	ActiveOperation.PendingSearch = MakeShared<FOnlineSessionSearch>();
 	ActiveOperation.PendingSearch->MaxSearchResults = ActiveOperation.SearchRequest.MaxSearchResults;
 	ActiveOperation.PendingSearch->bIsLanQuery = ActiveOperation.SearchRequest.bUseLan;
-	ActiveOperation.PendingSearch->PingBucketSize = 50;
+	ActiveOperation.PendingSearch->PingBucketSize = GetSearchPingBucketSize();
 
 	if (ActiveOperation.SearchRequest.bUseLan == false)
 	{
@@ -339,9 +489,28 @@ void UMultiplayerSessionsSubsystem::BeginFindOperation()
 
 	}
 
+	if (ActiveOperation.SearchRequest.bUseLan == true && bUseNativeLanDiscovery == true)
+	{
+		INC_DWORD_STAT(STAT_MultiplayerSessions_SearchesIssued);
+		NoteSearchIssued(FPlatformTime::Seconds());
+		if (BeginLanDiscoveryFind() == false)
+		{
+			ClearOperationDelegate(EOperationType::Find);
+			TArray<FOnlineSessionSearchResult> EmptySearchResults;
+			TArray<FMultiplayerSessionBrowserEntry> EmptyBrowserEntries;
+			CompleteFindOperation(false, EMultiplayerSessionFailureReason::FindFailed, MoveTemp(EmptySearchResults), MoveTemp(EmptyBrowserEntries));
+		}
+
+		return;
+	}
+
 	const uint64 Generation = ActiveOperation.Generation;
 	const FOnFindSessionsCompleteDelegate CompletionDelegate = FOnFindSessionsCompleteDelegate::CreateUObject(this, &ThisClass::OnFindSessionsCompleteInternal, Generation);
 	FindSessionsCompleteDelegateHandle = SessionInterface->AddOnFindSessionsCompleteDelegate_Handle(CompletionDelegate);
+	SearchOwnerLocalUserNum = BoundLocalUserNum;
+
+	INC_DWORD_STAT(STAT_MultiplayerSessions_SearchesIssued);
+	NoteSearchIssued(FPlatformTime::Seconds());
 
 	bool bStarted = false;
 	if (ActiveOperation.LocalUser.UniqueNetId.IsValid() == true)
@@ -376,7 +545,7 @@ void UMultiplayerSessionsSubsystem::BeginFindFriendOperation()
 		return;
 	}
 
-	SetOperationStep(EOperationStep::Executing, FindTimeoutSeconds);
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Find));
 	const uint64 Generation = ActiveOperation.Generation;
 	FindFriendDelegateLocalUserNum = ActiveOperation.LocalUser.LocalUserNum;
 	const FOnFindFriendSessionCompleteDelegate CompletionDelegate = FOnFindFriendSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnFindFriendSessionCompleteInternal, Generation);
@@ -399,14 +568,22 @@ void UMultiplayerSessionsSubsystem::BeginJoinAfterExistingSessionCleanup()
 		return;
 	}
 
-	if (SessionInterface->GetNamedSession(NAME_GameSession) != nullptr)
+	FIPv4Endpoint LanHostEndpoint;
+	if (ActiveOperation.SessionName != NAME_GameSession && MultiplayerSessionLan::GetHostEndpoint(GetJoinSearchResult(), LanHostEndpoint) == true)
 	{
-		ActiveOperation.Step = EOperationStep::DestroyExistingForJoin;
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("LAN discovery results can only be joined as %s, not %s."), *NAME_GameSession.ToString(), *ActiveOperation.SessionName.ToString());
+		CompleteJoinOperation(EOnJoinSessionCompleteResult::UnknownError, EMultiplayerJoinSessionResult::UnknownError, EMultiplayerSessionFailureReason::SessionNameMismatch);
+		return;
+	}
+
+	if (SessionInterface->GetNamedSession(ActiveOperation.SessionName) != nullptr)
+	{
+		EnterOperationStep(EOperationStep::DestroyExistingForJoin);
 		BeginDestroyOperation();
 		return;
 	}
 
-	ResetCommittedSessionState();
+	ResetCommittedSessionState(ActiveOperation.SessionName);
 	BeginJoinOperation();
 }
 
@@ -418,7 +595,36 @@ void UMultiplayerSessionsSubsystem::BeginJoinOperation()
 		return;
 	}
 
-	SetOperationStep(EOperationStep::Executing, JoinTimeoutSeconds);
+	if (ActiveOperation.bJoinAdmissionChecked == false)
+	{
+		ActiveOperation.bJoinAdmissionChecked = true;
+		if (BeginJoinAdmissionDelay() == true)
+		{
+			return;
+		}
+	}
+
+	if (ActiveOperation.bSlotReservationChecked == false)
+	{
+		ActiveOperation.bSlotReservationChecked = true;
+		if (BeginSlotReservation() == true)
+		{
+			return;
+		}
+	}
+
+	FIPv4Endpoint LanHostEndpoint;
+	if (ActiveOperation.SessionName == NAME_GameSession && MultiplayerSessionLan::GetHostEndpoint(GetJoinSearchResult(), LanHostEndpoint) == true)
+	{
+		if (BeginTravel(LanHostEndpoint.ToString()) == false)
+		{
+			HandleTravelFailureInternal(EMultiplayerSessionFailureReason::TravelFailed);
+		}
+
+		return;
+	}
+
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Join));
 
 	const uint64 Generation = ActiveOperation.Generation;
 	const FOnJoinSessionCompleteDelegate CompletionDelegate = FOnJoinSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnJoinSessionCompleteInternal, Generation);
@@ -427,11 +633,11 @@ void UMultiplayerSessionsSubsystem::BeginJoinOperation()
 	bool bStarted = false;
 	if (ActiveOperation.LocalUser.UniqueNetId.IsValid() == true)
 	{
-		bStarted = SessionInterface->JoinSession(*ActiveOperation.LocalUser.UniqueNetId, NAME_GameSession, ActiveOperation.JoinResult);
+		bStarted = SessionInterface->JoinSession(*ActiveOperation.LocalUser.UniqueNetId, ActiveOperation.SessionName, GetJoinSearchResult());
 	}
 	else
 	{
-		bStarted = SessionInterface->JoinSession(ActiveOperation.LocalUser.LocalUserNum, NAME_GameSession, ActiveOperation.JoinResult);
+		bStarted = SessionInterface->JoinSession(ActiveOperation.LocalUser.LocalUserNum, ActiveOperation.SessionName, GetJoinSearchResult());
 	}
 
 	if (bStarted == false)
@@ -460,10 +666,10 @@ void UMultiplayerSessionsSubsystem::BeginDestroyOperation()
 		return;
 	}
 
-	FNamedOnlineSession* ExistingSession = SessionInterface->GetNamedSession(NAME_GameSession);
+	FNamedOnlineSession* ExistingSession = SessionInterface->GetNamedSession(ActiveOperation.SessionName);
 	if (ExistingSession == nullptr)
 	{
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 		if (ActiveOperation.Type == EOperationType::Create)
 		{
 			BeginCreateOperation();
@@ -481,22 +687,22 @@ void UMultiplayerSessionsSubsystem::BeginDestroyOperation()
 
 	if (ActiveOperation.Type == EOperationType::Destroy)
 	{
-		SetOperationStep(EOperationStep::Executing, DestroyTimeoutSeconds);
+		SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Destroy));
 	}
 	else if (ActiveOperation.Type == EOperationType::Create)
 	{
-		SetOperationStep(EOperationStep::DestroyExistingForCreate, DestroyTimeoutSeconds);
+		SetOperationStep(EOperationStep::DestroyExistingForCreate, GetTimeoutSeconds(EOperationTimeout::Destroy));
 	}
 	else
 	{
-		SetOperationStep(EOperationStep::DestroyExistingForJoin, DestroyTimeoutSeconds);
+		SetOperationStep(EOperationStep::DestroyExistingForJoin, GetTimeoutSeconds(EOperationTimeout::Destroy));
 	}
 
 	const uint64 Generation = ActiveOperation.Generation;
 	const FOnDestroySessionCompleteDelegate CompletionDelegate = FOnDestroySessionCompleteDelegate::CreateUObject(this, &ThisClass::OnDestroySessionCompleteInternal, Generation);
 	DestroySessionCompleteDelegateHandle = SessionInterface->AddOnDestroySessionCompleteDelegate_Handle(CompletionDelegate);
 
-	const bool bStarted = SessionInterface->DestroySession(NAME_GameSession);
+	const bool bStarted = SessionInterface->DestroySession(ActiveOperation.SessionName);
 	if (bStarted == true)
 	{
 		return;
@@ -504,10 +710,10 @@ void UMultiplayerSessionsSubsystem::BeginDestroyOperation()
 
 	ClearOperationDelegate(EOperationType::Destroy);
 
-	const bool bSessionNoLongerExists = SessionInterface->GetNamedSession(NAME_GameSession) == nullptr;
+	const bool bSessionNoLongerExists = SessionInterface->GetNamedSession(ActiveOperation.SessionName) == nullptr;
 	if (bSessionNoLongerExists == true)
 	{
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 		if (ActiveOperation.Type == EOperationType::Create)
 		{
 			BeginCreateOperation();
@@ -545,23 +751,24 @@ void UMultiplayerSessionsSubsystem::BeginUpdateOperation()
 		return;
 	}
 
-	FNamedOnlineSession* ExistingSession = SessionInterface->GetNamedSession(NAME_GameSession);
+	FNamedOnlineSession* ExistingSession = SessionInterface->GetNamedSession(ActiveOperation.SessionName);
 	if (ExistingSession == nullptr)
 	{
 		CompleteUpdateOperation(false, EMultiplayerSessionFailureReason::UpdateFailed);
 		return;
 	}
 
-	if (bOwnsNamedSession == false)
+	if (OwnsSessionNamed(ActiveOperation.SessionName) == false)
 	{
 		CompleteUpdateOperation(false, EMultiplayerSessionFailureReason::NotSessionOwner);
 		return;
 	}
 
-	SetOperationStep(EOperationStep::Executing, UpdateTimeoutSeconds);
-	if (CommittedSessionSettings.IsValid() == true)
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Update));
+	const FNamedSessionState& NamedSessionState = GetNamedSessionState(ActiveOperation.SessionName);
+	if (NamedSessionState.CommittedSessionSettings.IsValid() == true)
 	{
-		ActiveOperation.PendingSessionSettings = MakeShared<FOnlineSessionSettings>(*CommittedSessionSettings);
+		ActiveOperation.PendingSessionSettings = MakeShared<FOnlineSessionSettings>(*NamedSessionState.CommittedSessionSettings);
 	}
 	else
 	{
@@ -571,9 +778,9 @@ void UMultiplayerSessionsSubsystem::BeginUpdateOperation()
 	ActiveOperation.PendingSessionSettings->Set(MultiplayerSessionsKeys::Status, SessionStatusToString(ActiveOperation.RequestedStatus), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
 
 	bool bConfiguredAllowJoinInProgress = ActiveOperation.PendingSessionSettings->bAllowJoinInProgress;
-	if (bHasCommittedJoinInProgressPolicy == true)
+	if (NamedSessionState.bHasCommittedJoinInProgressPolicy == true)
 	{
-		bConfiguredAllowJoinInProgress = bCommittedAllowJoinInProgress;
+		bConfiguredAllowJoinInProgress = NamedSessionState.bCommittedAllowJoinInProgress;
 	}
 	else
 	{
@@ -593,7 +800,7 @@ void UMultiplayerSessionsSubsystem::BeginUpdateOperation()
 	const FOnUpdateSessionCompleteDelegate CompletionDelegate = FOnUpdateSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnUpdateSessionCompleteInternal, Generation);
 	UpdateSessionCompleteDelegateHandle = SessionInterface->AddOnUpdateSessionCompleteDelegate_Handle(CompletionDelegate);
 
-	const bool bStarted = SessionInterface->UpdateSession(NAME_GameSession, *ActiveOperation.PendingSessionSettings, true);
+	const bool bStarted = SessionInterface->UpdateSession(ActiveOperation.SessionName, *ActiveOperation.PendingSessionSettings, true);
 	if (bStarted == false)
 	{
 		ClearOperationDelegate(EOperationType::Update);
@@ -603,24 +810,24 @@ void UMultiplayerSessionsSubsystem::BeginUpdateOperation()
 
 void UMultiplayerSessionsSubsystem::BeginStartOperation()
 {
-	if (SessionInterface.IsValid() == false || SessionInterface->GetNamedSession(NAME_GameSession) == nullptr)
+	if (SessionInterface.IsValid() == false || SessionInterface->GetNamedSession(ActiveOperation.SessionName) == nullptr)
 	{
 		CompleteStartOperation(false, EMultiplayerSessionFailureReason::StartFailed);
 		return;
 	}
 
-	if (bOwnsNamedSession == false)
+	if (OwnsSessionNamed(ActiveOperation.SessionName) == false)
 	{
 		CompleteStartOperation(false, EMultiplayerSessionFailureReason::NotSessionOwner);
 		return;
 	}
 
-	SetOperationStep(EOperationStep::Executing, StartEndTimeoutSeconds);
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::StartEnd));
 	const uint64 Generation = ActiveOperation.Generation;
 	const FOnStartSessionCompleteDelegate CompletionDelegate = FOnStartSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnStartSessionCompleteInternal, Generation);
 	StartSessionCompleteDelegateHandle = SessionInterface->AddOnStartSessionCompleteDelegate_Handle(CompletionDelegate);
 
-	if (SessionInterface->StartSession(NAME_GameSession) == false)
+	if (SessionInterface->StartSession(ActiveOperation.SessionName) == false)
 	{
 		ClearOperationDelegate(EOperationType::Start);
 		CompleteStartOperation(false, EMultiplayerSessionFailureReason::StartFailed);
@@ -629,24 +836,24 @@ void UMultiplayerSessionsSubsystem::BeginStartOperation()
 
 void UMultiplayerSessionsSubsystem::BeginEndOperation()
 {
-	if (SessionInterface.IsValid() == false || SessionInterface->GetNamedSession(NAME_GameSession) == nullptr)
+	if (SessionInterface.IsValid() == false || SessionInterface->GetNamedSession(ActiveOperation.SessionName) == nullptr)
 	{
 		CompleteEndOperation(false, EMultiplayerSessionFailureReason::EndFailed);
 		return;
 	}
 
-	if (bOwnsNamedSession == false)
+	if (OwnsSessionNamed(ActiveOperation.SessionName) == false)
 	{
 		CompleteEndOperation(false, EMultiplayerSessionFailureReason::NotSessionOwner);
 		return;
 	}
 
-	SetOperationStep(EOperationStep::Executing, StartEndTimeoutSeconds);
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::StartEnd));
 	const uint64 Generation = ActiveOperation.Generation;
 	const FOnEndSessionCompleteDelegate CompletionDelegate = FOnEndSessionCompleteDelegate::CreateUObject(this, &ThisClass::OnEndSessionCompleteInternal, Generation);
 	EndSessionCompleteDelegateHandle = SessionInterface->AddOnEndSessionCompleteDelegate_Handle(CompletionDelegate);
 
-	if (SessionInterface->EndSession(NAME_GameSession) == false)
+	if (SessionInterface->EndSession(ActiveOperation.SessionName) == false)
 	{
 		ClearOperationDelegate(EOperationType::End);
 		CompleteEndOperation(false, EMultiplayerSessionFailureReason::EndFailed);
@@ -673,7 +880,7 @@ bool UMultiplayerSessionsSubsystem::BeginTravel(const FString& TravelAddress)
 		return false;
 	}
 
-	SetOperationStep(EOperationStep::WaitingForTravel, TravelTimeoutSeconds);
+	SetOperationStep(EOperationStep::WaitingForTravel, GetTimeoutSeconds(EOperationTimeout::Travel));
 	SetFlowState(EMultiplayerSessionFlowState::Traveling);
 
 	UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Starting client travel to %s."), *TravelAddress);
@@ -689,9 +896,9 @@ void UMultiplayerSessionsSubsystem::BeginRecovery(EOperationType SourceType)
 		ClearOperationDelegate(EOperationType::Destroy);
 	}
 	ActiveOperation.RecoverySourceType = SourceType;
-	ActiveOperation.Step = EOperationStep::Recovering;
-	ActiveOperation.RecoveryNotBeforeSeconds = FPlatformTime::Seconds() + FMath::Max(0.0f, RecoveryGraceSeconds);
-	ActiveOperation.DeadlineSeconds = FPlatformTime::Seconds() + FMath::Max(1.0f, RecoveryTimeoutSeconds);
+	EnterOperationStep(EOperationStep::Recovering);
+	ActiveOperation.RecoveryNotBeforeSeconds = FPlatformTime::Seconds() + FMath::Max(0.0f, GetTimeoutSeconds(EOperationTimeout::RecoveryGrace));
+	ActiveOperation.DeadlineSeconds = FPlatformTime::Seconds() + FMath::Max(1.0f, GetTimeoutSeconds(EOperationTimeout::Recovery));
 	SetFlowState(EMultiplayerSessionFlowState::Recovering);
 }
 
@@ -721,10 +928,10 @@ void UMultiplayerSessionsSubsystem::ContinueRecovery()
 		return;
 	}
 
-	const bool bHasSession = SessionInterface->GetNamedSession(NAME_GameSession) != nullptr;
+	const bool bHasSession = SessionInterface->GetNamedSession(ActiveOperation.SessionName) != nullptr;
 	if (bHasSession == false)
 	{
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 
 		if (ActiveOperation.RecoverySourceType == EOperationType::Destroy)
 		{
@@ -760,20 +967,20 @@ void UMultiplayerSessionsSubsystem::BeginRecoveryDestroy()
 	}
 
 	ActiveOperation.bRecoveryAttemptedDestroy = true;
-	SetOperationStep(EOperationStep::RecoveryDestroy, DestroyTimeoutSeconds);
+	SetOperationStep(EOperationStep::RecoveryDestroy, GetTimeoutSeconds(EOperationTimeout::Destroy));
 
 	const uint64 Generation = ActiveOperation.Generation;
 	const FOnDestroySessionCompleteDelegate CompletionDelegate = FOnDestroySessionCompleteDelegate::CreateUObject(this, &ThisClass::OnRecoveryDestroyCompleteInternal, Generation);
 	RecoveryDestroyCompleteDelegateHandle = SessionInterface->AddOnDestroySessionCompleteDelegate_Handle(CompletionDelegate);
 
-	if (SessionInterface->DestroySession(NAME_GameSession) == false)
+	if (SessionInterface->DestroySession(ActiveOperation.SessionName) == false)
 	{
 		SessionInterface->ClearOnDestroySessionCompleteDelegate_Handle(RecoveryDestroyCompleteDelegateHandle);
 		RecoveryDestroyCompleteDelegateHandle = FDelegateHandle();
 
-		if (SessionInterface->GetNamedSession(NAME_GameSession) == nullptr)
+		if (SessionInterface->GetNamedSession(ActiveOperation.SessionName) == nullptr)
 		{
-			ResetCommittedSessionState();
+			ResetCommittedSessionState(ActiveOperation.SessionName);
 			CompleteRecovery(true);
 			return;
 		}
@@ -794,11 +1001,26 @@ void UMultiplayerSessionsSubsystem::CompleteCreateOperation(bool bWasSuccessful,
 	ClearOperationDelegate(EOperationType::Destroy);
 	SetLastFailureReason(FailureReason);
 
+	if (bWasSuccessful == false && ActiveOperation.SessionName == NAME_GameSession && OwnsSessionNamed(NAME_GameSession) == false)
+	{
+		StopPingResponder();
+	}
+
+	const FQuickMatchContext CompletedQuickMatch = ActiveOperation.QuickMatch;
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+	const FName CompletedSessionName = ActiveOperation.SessionName;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
 
-	MultiplayerOnCreateSessionComplete.Broadcast(bWasSuccessful);
-	OnCreateSessionRequestComplete.Broadcast(bWasSuccessful);
+	{
+		TGuardValue<FName> PublishingSessionNameGuard(PublishingSessionName, CompletedSessionName);
+		MultiplayerOnCreateSessionComplete.Broadcast(bWasSuccessful);
+		OnCreateSessionRequestComplete.Broadcast(bWasSuccessful);
+	}
+	if (bHeadlessHostCreating == true && CompletedSessionName == NAME_GameSession)
+	{
+		FinishHeadlessHost(bWasSuccessful);
+	}
+	BroadcastQuickMatchReport(CompletedQuickMatch, bWasSuccessful == true ? EMultiplayerQuickMatchOutcome::Hosted : EMultiplayerQuickMatchOutcome::Failed, FailureReason);
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
 }
 
@@ -809,12 +1031,42 @@ void UMultiplayerSessionsSubsystem::CompleteFindOperation(bool bWasSuccessful, E
 		return;
 	}
 
+	if (ActiveOperation.QuickMatch.bActive == true)
+	{
+		ContinueQuickMatchAfterSearch(FailureReason, MoveTemp(SearchResults), MoveTemp(BrowserEntries));
+		return;
+	}
+
 	ActiveOperation.bResultBroadcast = true;
 	ClearOperationDelegate(EOperationType::Find);
 	SetLastFailureReason(FailureReason);
 
+	const bool bBackgroundRefresh = ActiveOperation.bBackgroundRefresh;
+	if (bBackgroundRefresh == true && bWasSuccessful == false)
+	{
+		const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+		const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Background refresh ended without results. Reason=%d"), static_cast<int32>(FailureReason));
+		if (FailureReason != EMultiplayerSessionFailureReason::Cancelled)
+		{
+			ScheduleNextAutoRefresh(nullptr, CachedBrowserEntries.Num());
+		}
+		BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
+		return;
+	}
+
+	const bool bBroadcastChangeSet = OnBrowserEntriesChanged.IsBound();
+	const bool bBuildChangeSet = bBroadcastChangeSet == true || bAutoRefreshActive == true;
+	const int32 PreviousEntryCount = CachedBrowserEntries.Num();
+	TArray<FMultiplayerSessionBrowserEntry> PreviousBrowserEntries;
+	if (bBuildChangeSet == true)
+	{
+		PreviousBrowserEntries = MoveTemp(CachedBrowserEntries);
+	}
+
 	if (bWasSuccessful == true)
 	{
+		CachedSearchRequest = ActiveOperation.SearchRequest;
 		CachedSearchResults = MoveTemp(SearchResults);
 		CachedBrowserEntries = MoveTemp(BrowserEntries);
 	}
@@ -824,20 +1076,42 @@ void UMultiplayerSessionsSubsystem::CompleteFindOperation(bool bWasSuccessful, E
 		CachedBrowserEntries.Reset();
 	}
 
-	TArray<FOnlineSessionSearchResult> ResultsForBroadcast;
-	TArray<FMultiplayerSessionBrowserEntry> EntriesForBroadcast;
-	if (bWasSuccessful == true)
+	UpdateCachedSearchBytesStat();
+	TrimCachedSearchResults();
+
+	FMultiplayerSessionBrowserChangeSet ChangeSet;
+	if (bBuildChangeSet == true)
 	{
-		ResultsForBroadcast = CachedSearchResults;
-		EntriesForBroadcast = CachedBrowserEntries;
+		BuildBrowserChangeSet(PreviousBrowserEntries, CachedBrowserEntries, ChangeSet);
+		PreviousBrowserEntries.Empty();
 	}
 
+	ScheduleNextAutoRefresh(bWasSuccessful == true ? &ChangeSet : nullptr, PreviousEntryCount);
+
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
 
-	MultiplayerOnFindSessionsComplete.Broadcast(ResultsForBroadcast, bWasSuccessful);
-	OnSessionSearchCompleted.Broadcast(bWasSuccessful, EntriesForBroadcast);
+	{
+		MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_PublishSearchResults);
+		TGuardValue<bool> PublishingBackgroundRefreshGuard(bPublishingBackgroundRefresh, bBackgroundRefresh);
+		const uint64 PublishCount = ++BrowserEntriesPublishCount;
+		MultiplayerOnFindSessionsComplete.Broadcast(CachedSearchResults, bWasSuccessful);
+		if (BrowserEntriesPublishCount == PublishCount)
+		{
+			OnSessionSearchCompleted.Broadcast(bWasSuccessful, CachedBrowserEntries);
+			if (BrowserEntriesPublishCount == PublishCount && bBroadcastChangeSet == true)
+			{
+				OnBrowserEntriesChanged.Broadcast(CachedBrowserEntries, ChangeSet);
+			}
+		}
+	}
+
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
+
+	if (bWasSuccessful == true)
+	{
+		StartPingProbes();
+	}
 }
 
 void UMultiplayerSessionsSubsystem::CompleteFindFriendOperation(bool bWasSuccessful, EMultiplayerSessionFailureReason FailureReason)
@@ -869,11 +1143,22 @@ void UMultiplayerSessionsSubsystem::CompleteJoinOperation(EOnJoinSessionComplete
 	ClearOperationDelegate(EOperationType::Join);
 	SetLastFailureReason(FailureReason);
 
+	if (Result == EMultiplayerJoinSessionResult::Success)
+	{
+		ActiveOperation.SlotReserver.Reset();
+	}
+
+	const FQuickMatchContext CompletedQuickMatch = ActiveOperation.QuickMatch;
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+	const FName CompletedSessionName = ActiveOperation.SessionName;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
 
-	MultiplayerOnJoinSessionComplete.Broadcast(LegacyResult);
-	OnJoinSessionRequestCompleted.Broadcast(Result);
+	{
+		TGuardValue<FName> PublishingSessionNameGuard(PublishingSessionName, CompletedSessionName);
+		MultiplayerOnJoinSessionComplete.Broadcast(LegacyResult);
+		OnJoinSessionRequestCompleted.Broadcast(Result);
+	}
+	BroadcastQuickMatchReport(CompletedQuickMatch, Result == EMultiplayerJoinSessionResult::Success ? EMultiplayerQuickMatchOutcome::Joined : EMultiplayerQuickMatchOutcome::Failed, FailureReason);
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
 }
 
@@ -889,10 +1174,14 @@ void UMultiplayerSessionsSubsystem::CompleteDestroyOperation(bool bWasSuccessful
 	SetLastFailureReason(FailureReason);
 
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+	const FName CompletedSessionName = ActiveOperation.SessionName;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
 
-	MultiplayerOnDestroySessionComplete.Broadcast(bWasSuccessful);
-	OnDestroySessionRequestComplete.Broadcast(bWasSuccessful);
+	{
+		TGuardValue<FName> PublishingSessionNameGuard(PublishingSessionName, CompletedSessionName);
+		MultiplayerOnDestroySessionComplete.Broadcast(bWasSuccessful);
+		OnDestroySessionRequestComplete.Broadcast(bWasSuccessful);
+	}
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
 }
 
@@ -908,9 +1197,13 @@ void UMultiplayerSessionsSubsystem::CompleteUpdateOperation(bool bWasSuccessful,
 	SetLastFailureReason(FailureReason);
 
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+	const FName CompletedSessionName = ActiveOperation.SessionName;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
 
-	OnUpdateHostedSessionCompleted.Broadcast(bWasSuccessful);
+	{
+		TGuardValue<FName> PublishingSessionNameGuard(PublishingSessionName, CompletedSessionName);
+		OnUpdateHostedSessionCompleted.Broadcast(bWasSuccessful);
+	}
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
 }
 
@@ -926,9 +1219,13 @@ void UMultiplayerSessionsSubsystem::CompleteStartOperation(bool bWasSuccessful,
 	SetLastFailureReason(FailureReason);
 
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+	const FName CompletedSessionName = ActiveOperation.SessionName;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
 
-	OnStartHostedSessionCompleted.Broadcast(bWasSuccessful);
+	{
+		TGuardValue<FName> PublishingSessionNameGuard(PublishingSessionName, CompletedSessionName);
+		OnStartHostedSessionCompleted.Broadcast(bWasSuccessful);
+	}
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
 }
 
@@ -944,9 +1241,13 @@ void UMultiplayerSessionsSubsystem::CompleteEndOperation(bool bWasSuccessful, EM
 	SetLastFailureReason(FailureReason);
 
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+	const FName CompletedSessionName = ActiveOperation.SessionName;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
 
-	OnEndHostedSessionCompleted.Broadcast(bWasSuccessful);
+	{
+		TGuardValue<FName> PublishingSessionNameGuard(PublishingSessionName, CompletedSessionName);
+		OnEndHostedSessionCompleted.Broadcast(bWasSuccessful);
+	}
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
 }
 
@@ -973,13 +1274,15 @@ void UMultiplayerSessionsSubsystem::CompleteRecovery(bool bWasSuccessful)
 
 	if (bWasSuccessful == false)
 	{
-		ResetCommittedSessionState();
+		ResetCommittedSessionState(ActiveOperation.SessionName);
 		SetLastFailureReason(EMultiplayerSessionFailureReason::RecoveryFailed);
 		UE_LOG(LogMultiplayerSessionsSubsystem, Error, TEXT("Session recovery failed."));
 	}
 
+	const FQuickMatchContext CompletedQuickMatch = ActiveOperation.QuickMatch;
 	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
 	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
+	BroadcastQuickMatchReport(CompletedQuickMatch, EMultiplayerQuickMatchOutcome::Failed, LastFailureReason);
 	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
 }
 
@@ -999,13 +1302,23 @@ void UMultiplayerSessionsSubsystem::HandleOperationTimeout()
 
 	if (TimedOutType == EOperationType::Find)
 	{
+		const bool bOwnsSearch = SearchOwnerLocalUserNum == BoundLocalUserNum;
 		ClearOperationDelegate(EOperationType::Find);
 
-		if (SessionInterface.IsValid() == true)
+		if (bOwnsSearch == true && SessionInterface.IsValid() == true)
 		{
 			SessionInterface->CancelFindSessions();
 		}
 
+		if (ActiveOperation.QuickMatch.bActive == true)
+		{
+			TArray<FOnlineSessionSearchResult> PartialSearchResults;
+			TArray<FMultiplayerSessionBrowserEntry> PartialBrowserEntries;
+			BuildBrowserResultsFromPendingSearch(PartialSearchResults, PartialBrowserEntries);
+			ContinueQuickMatchAfterSearch(EMultiplayerSessionFailureReason::Timeout, MoveTemp(PartialSearchResults), MoveTemp(PartialBrowserEntries));
+			return;
+		}
+
 		TArray<FOnlineSessionSearchResult> EmptySearchResults;
 		TArray<FMultiplayerSessionBrowserEntry> EmptyBrowserEntries;
 		CompleteFindOperation(false, EMultiplayerSessionFailureReason::Timeout, MoveTemp(EmptySearchResults), MoveTemp(EmptyBrowserEntries));
@@ -1090,7 +1403,10 @@ void UMultiplayerSessionsSubsystem::SetFlowState(EMultiplayerSessionFlowState Ne
 		return;
 	}
 
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_BroadcastFlowState);
+	NoteDelegateBroadcast();
 	CurrentFlowState = NewState;
+	RecordFlightEvent(EMultiplayerSessionFlightEvent::FlowStateChanged, EMultiplayerSessionFailureReason::None);
 	OnSessionFlowStateChanged.Broadcast(CurrentFlowState);
 }
 
@@ -1101,7 +1417,10 @@ void UMultiplayerSessionsSubsystem::BroadcastFailure(EMultiplayerSessionFailureR
 		return;
 	}
 
+	MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_BroadcastFailure);
+	NoteDelegateBroadcast();
 	SetLastFailureReason(FailureReason);
+	RecordFlightEvent(EMultiplayerSessionFlightEvent::Failure, FailureReason);
 	OnSessionFailure.Broadcast(FailureReason);
 }
 
@@ -1112,6 +1431,7 @@ void UMultiplayerSessionsSubsystem::SetLastFailureReason(EMultiplayerSessionFail
 
 void UMultiplayerSessionsSubsystem::BroadcastImmediateFailureForOperation(EOperationType OperationType, EMultiplayerSessionFailureReason FailureReason)
 {
+	NoteDelegateBroadcast();
 	SetLastFailureReason(FailureReason);
 
 	if (OperationType == EOperationType::Create)
@@ -0,0 +1,277 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionLanDiscovery.h"
+#include "MultiplayerSessionPing.h"
+#include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsTrace.h"
+#include "Containers/Ticker.h"
+#include "OnlineSessionSettings.h"
+
+bool MultiplayerSessionPing::ResolveProbeEndpoint(IOnlineSession& SessionInterface, const FOnlineSessionSearchResult& SearchResult, FIPv4Endpoint& OutEndpoint)
+{
+	int32 ProbePort = 0;
+	if (SearchResult.Session.SessionSettings.Get(MultiplayerSessionsKeys::PingProbePort, ProbePort) == false || ProbePort <= 0 || ProbePort > 65535)
+	{
+		return false;
+	}
+
+	FIPv4Endpoint LanHostEndpoint;
+	if (MultiplayerSessionLan::GetHostEndpoint(SearchResult, LanHostEndpoint) == true)
+	{
+		OutEndpoint = FIPv4Endpoint(LanHostEndpoint.Address, static_cast<uint16>(ProbePort));
+		return true;
+	}
+
+	FString ConnectString;
+	if (SessionInterface.GetResolvedConnectString(SearchResult, NAME_GamePort, ConnectString) == false)
+	{
+		return false;
+	}
+
+	FString HostString = ConnectString;
+	int32 PortSeparatorIndex = INDEX_NONE;
+	if (ConnectString.FindLastChar(TEXT(':'), PortSeparatorIndex) == true)
+	{
+		HostString = ConnectString.Left(PortSeparatorIndex);
+	}
+
+	FIPv4Address Address;
+	if (FIPv4Address::Parse(HostString, Address) == false)
+	{
+		return false;
+	}
+
+	OutEndpoint = FIPv4Endpoint(Address, static_cast<uint16>(ProbePort));
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::StartPingProbes()
+{
+	StopPingProbes();
+
+	if (bEnablePingProbes == false || SessionInterface.IsValid() == false || ActiveOperation.Type != EOperationType::None)
+	{
+		return false;
+	}
+
+	TArray<FMultiplayerSessionPingProber::FTarget> Targets;
+	for (int32 Index = 0; Index < CachedBrowserEntries.Num() && Targets.Num() < MaxPingProbeTargets; Index++)
+	{
+		const FMultiplayerSessionBrowserEntry& BrowserEntry = CachedBrowserEntries[Index];
+		if (BrowserEntry.bCanJoin == false || CachedSearchResults.IsValidIndex(Index) == false)
+		{
+			continue;
+		}
+
+		FIPv4Endpoint Endpoint;
+		if (MultiplayerSessionPing::ResolveProbeEndpoint(*SessionInterface, CachedSearchResults[Index], Endpoint) == false)
+		{
+			continue;
+		}
+
+		FMultiplayerSessionPingProber::FTarget& Target = Targets.AddDefaulted_GetRef();
+		Target.EntryId = BrowserEntry.EntryId;
+		Target.Endpoint = Endpoint;
+	}
+
+	if (Targets.Num() == 0)
+	{
+		return false;
+	}
+
+	const int32 TargetCount = Targets.Num();
+	PingProber = MakeShared<FMultiplayerSessionPingProber>(MaxConcurrentPingProbes, PingProbeAttempts, PingProbeTimeoutSeconds);
+	if (PingProber->Start(MoveTemp(Targets)) == false)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Ping probe socket could not be opened."));
+		PingProber.Reset();
+		return false;
+	}
+
+	if (PingProbeTickerHandle.IsValid() == false)
+	{
+		PingProbeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickPingProbes), 0.0f);
+	}
+
+	UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Probing ping for %d session(s) for local user %d."), TargetCount, BoundLocalUserNum);
+	return true;
+}
+
+void UMultiplayerSessionsSubsystem::StopPingProbes()
+{
+	PingProber.Reset();
+}
+
+void UMultiplayerSessionsSubsystem::StopAllPingProbes()
+{
+	if (PingProbeTickerHandle.IsValid() == true)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PingProbeTickerHandle);
+		PingProbeTickerHandle.Reset();
+	}
+
+	PingProber.Reset();
+	for (FLocalUserState& LocalUserState : LocalUserStates)
+	{
+		LocalUserState.PingProber.Reset();
+	}
+}
+
+bool UMultiplayerSessionsSubsystem::IsProbingPing() const
+{
+	return PingProber.IsValid() == true && PingProber->IsActive() == true;
+}
+
+bool UMultiplayerSessionsSubsystem::TickPingProbes(float DeltaTime)
+{
+	(void)DeltaTime;
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	const auto HasProber = [this](int32 LocalUserNum)
+	{
+		return LocalUserNum == BoundLocalUserNum ? PingProber.IsValid() : LocalUserStates[LocalUserNum].PingProber.IsValid();
+	};
+
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		if (HasProber(LocalUserNum) == true)
+		{
+			FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+			TickBoundPingProbes(CurrentSeconds);
+		}
+	}
+
+	bool bAnyProbing = false;
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers && bAnyProbing == false; LocalUserNum++)
+	{
+		bAnyProbing = HasProber(LocalUserNum);
+	}
+
+	if (bAnyProbing == false)
+	{
+		PingProbeTickerHandle.Reset();
+	}
+
+	return bAnyProbing;
+}
+
+bool UMultiplayerSessionsSubsystem::TickBoundPingProbes(double CurrentSeconds)
+{
+	if (PingProber.IsValid() == false)
+	{
+		return false;
+	}
+
+	const TSharedRef<FMultiplayerSessionPingProber> Prober = PingProber.ToSharedRef();
+	TArray<FMultiplayerSessionPingProber::FMeasurement> Measurements;
+	const bool bStillProbing = Prober->Tick(CurrentSeconds, Measurements);
+
+	TArray<const FString*, TInlineAllocator<8>> ChangedEntryIds;
+	for (const FMultiplayerSessionPingProber::FMeasurement& Measurement : Measurements)
+	{
+		if (ApplyPingMeasurement(Measurement.EntryId, Measurement.PingInMs) == true)
+		{
+			ChangedEntryIds.Add(&Measurement.EntryId);
+		}
+	}
+
+	if (ChangedEntryIds.Num() > 0)
+	{
+		MULTIPLAYERSESSIONS_TRACE_SCOPE(MultiplayerSessions_PublishPingUpdate);
+		NoteDelegateBroadcast();
+		ScoreBrowserEntries(CachedBrowserEntries, CachedSearchRequest.ScoringWeights);
+		const bool bOrderChanged = SortSearchResultsAndBrowserEntries(CachedSearchResults, CachedBrowserEntries, CachedSearchRequest.DisplayedResultCount);
+		const uint64 PublishCount = ++BrowserEntriesPublishCount;
+		OnBrowserEntriesUpdated.Broadcast(CachedBrowserEntries);
+
+		if (BrowserEntriesPublishCount == PublishCount && OnBrowserEntriesChanged.IsBound() == true)
+		{
+			FMultiplayerSessionBrowserChangeSet ChangeSet;
+			ChangeSet.bOrderChanged = bOrderChanged;
+			for (const FString* EntryId : ChangedEntryIds)
+			{
+				FMultiplayerSessionEntryUpdate& EntryUpdate = ChangeSet.UpdatedEntries.AddDefaulted_GetRef();
+				EntryUpdate.EntryIndex = FindCachedSearchResultIndexByEntryId(*EntryId);
+				EntryUpdate.ChangedFields = static_cast<int32>(EMultiplayerSessionEntryField::Ping);
+			}
+
+			ChangeSet.UpdatedEntries.Sort([](const FMultiplayerSessionEntryUpdate& Left, const FMultiplayerSessionEntryUpdate& Right)
+			{
+				return Left.EntryIndex < Right.EntryIndex;
+			});
+			OnBrowserEntriesChanged.Broadcast(CachedBrowserEntries, ChangeSet);
+		}
+	}
+
+	if (bStillProbing == false)
+	{
+		if (PingProber == Prober)
+		{
+			PingProber.Reset();
+		}
+
+		return false;
+	}
+
+	return PingProber.IsValid();
+}
+
+bool UMultiplayerSessionsSubsystem::ApplyPingMeasurement(const FString& EntryId, int32 PingInMs)
+{
+	const int32 CachedIndex = FindCachedSearchResultIndexByEntryId(EntryId);
+	if (CachedIndex == INDEX_NONE || CachedSearchResults.IsValidIndex(CachedIndex) == false)
+	{
+		return false;
+	}
+
+	FMultiplayerSessionBrowserEntry& BrowserEntry = CachedBrowserEntries[CachedIndex];
+	if (BrowserEntry.PingInMs == PingInMs)
+	{
+		return false;
+	}
+
+	BrowserEntry.PingInMs = PingInMs;
+	CachedSearchResults[CachedIndex].PingInMs = PingInMs;
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::StartPingResponder()
+{
+	if (PingResponderPort <= 0)
+	{
+		return false;
+	}
+
+	if (PingResponder.IsValid() == false || PingResponder->IsRunning() == false || PingResponder->GetPort() != PingResponderPort)
+	{
+		PingResponder = MakeShared<FMultiplayerSessionPingResponder>();
+		if (PingResponder->Start(PingResponderPort) == false)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Ping responder could not bind UDP port %d. Clients will rely on provider ping."), PingResponderPort);
+			PingResponder.Reset();
+			return false;
+		}
+	}
+
+	PingResponder->ConfigureReservations(bEnableSlotReservations, SlotReservationSeconds, SlotReservationsPerAddress);
+	PingResponder->ClearReservations();
+	AdvertisedReservedSlots = 0;
+	ResetHostJoinLoad();
+	return true;
+}
+
+void UMultiplayerSessionsSubsystem::StopPingResponder()
+{
+	PingResponder.Reset();
+}
+
+int32 UMultiplayerSessionsSubsystem::GetPingResponderPort() const
+{
+	if (PingResponder.IsValid() == false || PingResponder->IsRunning() == false)
+	{
+		return 0;
+	}
+
+	return PingResponder->GetPort();
+}
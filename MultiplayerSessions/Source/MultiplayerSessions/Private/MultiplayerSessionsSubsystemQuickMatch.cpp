@@ -0,0 +1,241 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "Engine/World.h"
+#include "OnlineSessionSettings.h"
+
+bool UMultiplayerSessionsSubsystem::QuickMatch(const FMultiplayerQuickMatchRequest& QuickMatchRequest)
+{
+	return QuickMatchForLocalPlayer(nullptr, QuickMatchRequest);
+}
+
+bool UMultiplayerSessionsSubsystem::QuickMatchForLocalPlayer(ULocalPlayer* LocalPlayer, const FMultiplayerQuickMatchRequest& QuickMatchRequest)
+{
+	const int32 LocalUserNum = ResolveLocalUserNum(LocalPlayer);
+	if (LocalUserNum == INDEX_NONE)
+	{
+		BroadcastImmediateQuickMatchFailure(EMultiplayerSessionFailureReason::InvalidLocalPlayer);
+		return false;
+	}
+
+	FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+	if (IsSessionOperationRunningForOtherLocalUser(NAME_GameSession) == true)
+	{
+		BroadcastImmediateQuickMatchFailure(EMultiplayerSessionFailureReason::Busy);
+		return false;
+	}
+
+	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
+	if (TryBeginOperation(EOperationType::Find, EMultiplayerSessionFlowState::Finding, LocalPlayer, GetTimeoutSeconds(EOperationTimeout::Find), FailureReason) == false)
+	{
+		BroadcastImmediateQuickMatchFailure(FailureReason);
+		return false;
+	}
+
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	FQuickMatchContext& QuickMatchContext = ActiveOperation.QuickMatch;
+	QuickMatchContext.bActive = true;
+	QuickMatchContext.Request = QuickMatchRequest;
+	QuickMatchContext.Request.SearchDeadlineSeconds = FMath::Max(1.0f, QuickMatchRequest.SearchDeadlineSeconds);
+	QuickMatchContext.Request.MaxAcceptablePingMs = FMath::Max(0, QuickMatchRequest.MaxAcceptablePingMs);
+	SanitizeSearchRequest(QuickMatchContext.Request.SearchRequest);
+	SanitizeCreateRequest(QuickMatchContext.Request.CreateRequest);
+	QuickMatchContext.StartSeconds = CurrentSeconds;
+	QuickMatchContext.PhaseStartSeconds = CurrentSeconds;
+
+	ActiveOperation.SearchRequest = QuickMatchContext.Request.SearchRequest;
+	ActiveOperation.CreateRequest = QuickMatchContext.Request.CreateRequest;
+
+	if (ActiveOperation.LocalUser.UniqueNetId.IsValid() == false && IsOnlineLoginRequired() == true && ActiveOperation.SearchRequest.bUseLan == false)
+	{
+		CompleteQuickMatchOperation(EMultiplayerSessionFailureReason::NotLoggedIn);
+		return false;
+	}
+
+	BeginFindOperation();
+	return ActiveOperation.QuickMatch.bActive == true;
+}
+
+void UMultiplayerSessionsSubsystem::ContinueQuickMatchAfterSearch(EMultiplayerSessionFailureReason SearchFailureReason, TArray<FOnlineSessionSearchResult>&& SearchResults, TArray<FMultiplayerSessionBrowserEntry>&& BrowserEntries)
+{
+	ClearOperationDelegate(EOperationType::Find);
+
+	FQuickMatchContext& QuickMatchContext = ActiveOperation.QuickMatch;
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	const auto BeginNextPhase = [this, SearchFailureReason, CurrentSeconds](EOperationType NextType)
+	{
+		if (OperationStats.IsValid() == true && ActiveOperation.BeginSeconds > 0.0)
+		{
+			OperationStats->RecordOperation(static_cast<int32>(ActiveOperation.Type), (CurrentSeconds - ActiveOperation.BeginSeconds) * 1000.0, SearchFailureReason);
+		}
+
+		ActiveOperation.Type = NextType;
+		ActiveOperation.BeginSeconds = CurrentSeconds;
+	};
+
+	QuickMatchContext.bSearchCompleted = true;
+	QuickMatchContext.Report.SearchSeconds = static_cast<float>(CurrentSeconds - QuickMatchContext.PhaseStartSeconds);
+	QuickMatchContext.Report.CandidateCount = BrowserEntries.Num();
+	QuickMatchContext.PhaseStartSeconds = CurrentSeconds;
+
+	ActiveOperation.PendingSearch.Reset();
+
+	float SelectedScore = 0.0f;
+	int32 QualifiedCount = 0;
+	const int32 SelectedIndex = SelectQuickMatchEntryIndex(QuickMatchContext.Request, BrowserEntries, SelectedScore, QualifiedCount);
+	QuickMatchContext.Report.QualifiedCount = QualifiedCount;
+
+	UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Quick match search finished in %.3fs. Candidates=%d Qualified=%d."), QuickMatchContext.Report.SearchSeconds, QuickMatchContext.Report.CandidateCount, QualifiedCount);
+
+	if (SelectedIndex != INDEX_NONE && SearchResults.IsValidIndex(SelectedIndex) == true)
+	{
+		QuickMatchContext.Report.SelectedEntryId = BrowserEntries[SelectedIndex].EntryId;
+		QuickMatchContext.Report.SelectedScore = SelectedScore;
+
+		BeginNextPhase(EOperationType::Join);
+		ActiveOperation.JoinResult = MoveTemp(SearchResults[SelectedIndex]);
+		if (ActiveOperation.LocalUser.UniqueNetId.IsValid() == false && IsOnlineLoginRequired() == true && GetJoinSearchResult().Session.SessionSettings.bIsLANMatch == false)
+		{
+			CompleteJoinOperation(EOnJoinSessionCompleteResult::UnknownError, EMultiplayerJoinSessionResult::UnknownError, EMultiplayerSessionFailureReason::NotLoggedIn);
+			return;
+		}
+
+		SetFlowState(EMultiplayerSessionFlowState::Joining);
+		SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Join));
+		BeginJoinAfterExistingSessionCleanup();
+		return;
+	}
+
+	if (QuickMatchContext.Request.bHostIfNoneFound == false)
+	{
+		CompleteQuickMatchOperation(EMultiplayerSessionFailureReason::NoMatchFound);
+		return;
+	}
+
+	BeginNextPhase(EOperationType::Create);
+
+	const UWorld* World = GetWorld();
+	const bool bDedicatedServer = World != nullptr && World->GetNetMode() == NM_DedicatedServer;
+	if (bDedicatedServer == false && ActiveOperation.LocalUser.UniqueNetId.IsValid() == false && IsOnlineLoginRequired() == true && ActiveOperation.CreateRequest.bUseLan == false)
+	{
+		CompleteCreateOperation(false, EMultiplayerSessionFailureReason::NotLoggedIn);
+		return;
+	}
+
+	SetFlowState(EMultiplayerSessionFlowState::Creating);
+	SetOperationStep(EOperationStep::Executing, GetTimeoutSeconds(EOperationTimeout::Create));
+	BeginCreateAfterExistingSessionCleanup();
+}
+
+int32 UMultiplayerSessionsSubsystem::SelectQuickMatchEntryIndex(const FMultiplayerQuickMatchRequest& QuickMatchRequest, const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, float& OutScore, int32& OutQualifiedCount)
+{
+	OutScore = 0.0f;
+	OutQualifiedCount = 0;
+
+	int32 SelectedIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < BrowserEntries.Num(); Index++)
+	{
+		const FMultiplayerSessionBrowserEntry& BrowserEntry = BrowserEntries[Index];
+		if (BrowserEntry.bCanJoin == false)
+		{
+			continue;
+		}
+
+		if (QuickMatchRequest.MaxAcceptablePingMs > 0)
+		{
+			int32 PingInMs = BrowserEntry.PingInMs;
+			if (PingInMs < 0)
+			{
+				PingInMs = QuickMatchRequest.SearchRequest.ScoringWeights.UnknownPingMs;
+			}
+
+			if (PingInMs > QuickMatchRequest.MaxAcceptablePingMs)
+			{
+				continue;
+			}
+		}
+
+		OutQualifiedCount++;
+		if (SelectedIndex == INDEX_NONE || BrowserEntry.Score > OutScore)
+		{
+			SelectedIndex = Index;
+			OutScore = BrowserEntry.Score;
+		}
+	}
+
+	return SelectedIndex;
+}
+
+void UMultiplayerSessionsSubsystem::CompleteQuickMatchOperation(EMultiplayerSessionFailureReason FailureReason)
+{
+	if (ActiveOperation.bResultBroadcast == true)
+	{
+		return;
+	}
+
+	ActiveOperation.bResultBroadcast = true;
+	ClearOperationDelegate(EOperationType::Find);
+	SetLastFailureReason(FailureReason);
+
+	const FQuickMatchContext CompletedQuickMatch = ActiveOperation.QuickMatch;
+	const uint64 CompletedOperationGeneration = ActiveOperation.Generation;
+	const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
+
+	BroadcastQuickMatchReport(CompletedQuickMatch, EMultiplayerQuickMatchOutcome::Failed, FailureReason);
+	BroadcastIdleStateIfUnchanged(PreviousFlowState, CompletedOperationGeneration);
+}
+
+void UMultiplayerSessionsSubsystem::BroadcastQuickMatchReport(const FQuickMatchContext& QuickMatch, EMultiplayerQuickMatchOutcome Outcome, EMultiplayerSessionFailureReason FailureReason)
+{
+	if (QuickMatch.bActive == false)
+	{
+		return;
+	}
+
+	NoteDelegateBroadcast();
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	const float PhaseSeconds = static_cast<float>(CurrentSeconds - QuickMatch.PhaseStartSeconds);
+
+	FMultiplayerQuickMatchReport Report = QuickMatch.Report;
+	Report.Outcome = Outcome;
+	Report.FailureReason = FailureReason;
+	Report.TotalSeconds = static_cast<float>(CurrentSeconds - QuickMatch.StartSeconds);
+
+	if (QuickMatch.bSearchCompleted == false)
+	{
+		Report.SearchSeconds = PhaseSeconds;
+	}
+	else if (Report.SelectedEntryId.IsEmpty() == false)
+	{
+		Report.JoinSeconds = PhaseSeconds;
+	}
+	else
+	{
+		Report.HostSeconds = PhaseSeconds;
+	}
+
+	UE_LOG(
+		LogMultiplayerSessionsSubsystem,
+		Log,
+		TEXT("Quick match finished. Outcome=%d FailureReason=%d Search=%.3fs Join=%.3fs Host=%.3fs Total=%.3fs."),
+		static_cast<int32>(Report.Outcome),
+		static_cast<int32>(Report.FailureReason),
+		Report.SearchSeconds,
+		Report.JoinSeconds,
+		Report.HostSeconds,
+		Report.TotalSeconds
+	);
+
+	OnQuickMatchCompleted.Broadcast(Report);
+}
+
+void UMultiplayerSessionsSubsystem::BroadcastImmediateQuickMatchFailure(EMultiplayerSessionFailureReason FailureReason)
+{
+	SetLastFailureReason(FailureReason);
+
+	FMultiplayerQuickMatchReport Report;
+	Report.Outcome = EMultiplayerQuickMatchOutcome::Failed;
+	Report.FailureReason = FailureReason;
+	OnQuickMatchCompleted.Broadcast(Report);
+}
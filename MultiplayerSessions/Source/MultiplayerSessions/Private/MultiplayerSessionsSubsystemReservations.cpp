@@ -0,0 +1,287 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionPing.h"
+#include "MultiplayerSessionsPrivate.h"
+#include "MultiplayerSessionsStats.h"
+#include "Containers/Ticker.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/GameModeBase.h"
+#include "OnlineSessionSettings.h"
+
+namespace
+{
+	constexpr double AdvertisedUpdateIntervalSeconds = 1.0;
+	constexpr double AdvertisedUpdateTimeoutSeconds = 10.0;
+}
+
+bool UMultiplayerSessionsSubsystem::BeginSlotReservation()
+{
+	if (bEnableSlotReservations == false || ActiveOperation.SessionName != NAME_GameSession || SessionInterface.IsValid() == false)
+	{
+		return false;
+	}
+
+	const FOnlineSessionSearchResult& JoinSearchResult = GetJoinSearchResult();
+	int32 HostSupportsReservations = 0;
+	if (JoinSearchResult.Session.SessionSettings.Get(MultiplayerSessionsKeys::SlotReservations, HostSupportsReservations) == false || HostSupportsReservations == 0)
+	{
+		return false;
+	}
+
+	FIPv4Endpoint HostEndpoint;
+	if (MultiplayerSessionPing::ResolveProbeEndpoint(*SessionInterface, JoinSearchResult, HostEndpoint) == false)
+	{
+		return false;
+	}
+
+	const FString PlayerId = ActiveOperation.LocalUser.UniqueNetId.IsValid() == true ? ActiveOperation.LocalUser.UniqueNetId->ToString() : FString();
+	if (PlayerId.IsEmpty() == true)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("No net id to reserve a slot with. Joining without a reservation."));
+		return false;
+	}
+
+	const TSharedPtr<FMultiplayerSessionSlotReserver> SlotReserver = MakeShared<FMultiplayerSessionSlotReserver>(SlotReservationAttempts, SlotReservationAttemptTimeoutSeconds);
+	if (SlotReserver->Start(HostEndpoint, PlayerId) == false)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Slot reservation socket could not be opened. Joining without a reservation."));
+		return false;
+	}
+
+	ActiveOperation.SlotReserver = SlotReserver;
+	SetOperationStep(EOperationStep::ReservingSlot, SlotReservationAttempts * SlotReservationAttemptTimeoutSeconds + 1.0f);
+	if (SlotReservationTickerHandle.IsValid() == false)
+	{
+		SlotReservationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickSlotReservations), 0.0f);
+	}
+
+	UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Reserving a slot at %s."), *HostEndpoint.ToString());
+	return true;
+}
+
+bool UMultiplayerSessionsSubsystem::TickSlotReservations(float DeltaTime)
+{
+	(void)DeltaTime;
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	bool bAnyReserving = false;
+
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		const FOperationContext& Operation = GetLocalUserOperation(LocalUserNum);
+		if (Operation.Step != EOperationStep::ReservingSlot || Operation.SlotReserver.IsValid() == false)
+		{
+			continue;
+		}
+
+		FScopedLocalUserBinding LocalUserBinding(*this, LocalUserNum);
+		const MultiplayerSessionPing::EReservationResult Result = ActiveOperation.SlotReserver->Tick(CurrentSeconds);
+		if (Result == MultiplayerSessionPing::EReservationResult::None)
+		{
+			bAnyReserving = true;
+			continue;
+		}
+
+		if (Result != MultiplayerSessionPing::EReservationResult::Granted)
+		{
+			ActiveOperation.SlotReserver.Reset();
+		}
+
+		if (Result == MultiplayerSessionPing::EReservationResult::Rejected)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Host rejected the slot reservation. The session is full."));
+			CompleteJoinOperation(EOnJoinSessionCompleteResult::SessionIsFull, EMultiplayerJoinSessionResult::SessionIsFull, ResolveFailureReasonForJoinBlock(EMultiplayerJoinBlockReason::SessionFull));
+			continue;
+		}
+
+		if (Result == MultiplayerSessionPing::EReservationResult::NoReply)
+		{
+			UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Host did not answer the slot reservation. Joining without a reservation."));
+		}
+
+		BeginJoinOperation();
+	}
+
+	if (bAnyReserving == false)
+	{
+		SlotReservationTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void UMultiplayerSessionsSubsystem::TickHostSlotReservations(double CurrentSeconds)
+{
+	if (bEnableSlotReservations == false || PingResponder.IsValid() == false || PingResponder->IsRunning() == false || SessionInterface.IsValid() == false)
+	{
+		return;
+	}
+
+	FNamedOnlineSession* GameSession = SessionInterface->GetNamedSession(NAME_GameSession);
+	if (GameSession == nullptr || OwnsSessionNamed(NAME_GameSession) == false)
+	{
+		PingResponder->SetOpenSlots(0);
+		return;
+	}
+
+	const int32 OpenSlots = FMath::Max(0, GameSession->NumOpenPublicConnections);
+	PingResponder->SetOpenSlots(OpenSlots);
+
+	const int32 ReservedSlots = PingResponder->GetReservedSlotCount(CurrentSeconds);
+	QueueGameSessionAdvertisedValue(MultiplayerSessionsKeys::ReservedSlots, ReservedSlots, AdvertisedReservedSlots);
+}
+
+void UMultiplayerSessionsSubsystem::HandleGameModePreLogin(AGameModeBase* GameMode, const FUniqueNetIdRepl& NewPlayer, FString& ErrorMessage)
+{
+	if (ErrorMessage.IsEmpty() == false || GameMode == nullptr || GameMode->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	if (bEnableSlotReservations == false || PingResponder.IsValid() == false || PingResponder->IsRunning() == false || SessionInterface.IsValid() == false)
+	{
+		return;
+	}
+
+	const FNamedOnlineSession* GameSession = SessionInterface->GetNamedSession(NAME_GameSession);
+	if (GameSession == nullptr || OwnsSessionNamed(NAME_GameSession) == false)
+	{
+		return;
+	}
+
+	const FString PlayerId = NewPlayer.IsValid() == true ? NewPlayer->ToString() : FString();
+	if (PingResponder->ConsumeReservation(PlayerId) == true)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Player %s arrived with a reserved slot."), *PlayerId);
+		return;
+	}
+
+	const int32 ReservedSlots = PingResponder->GetReservedSlotCount(FPlatformTime::Seconds());
+	if (ReservedSlots > 0 && GameSession->NumOpenPublicConnections <= ReservedSlots)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Rejected player %s without a reservation. The %d open slot(s) are reserved."), *PlayerId, GameSession->NumOpenPublicConnections);
+		ErrorMessage = TEXT("Server full: the remaining slots are reserved.");
+	}
+}
+
+bool UMultiplayerSessionsSubsystem::IsGameSessionOperationRunning() const
+{
+	for (int32 LocalUserNum = 0; LocalUserNum < MaxLocalUsers; LocalUserNum++)
+	{
+		const FOperationContext& Operation = GetLocalUserOperation(LocalUserNum);
+		if (Operation.Type != EOperationType::None && Operation.Type != EOperationType::Find && Operation.SessionName == NAME_GameSession)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UMultiplayerSessionsSubsystem::QueueGameSessionAdvertisedValue(FName Key, int32 Value, int32 AdvertisedValue)
+{
+	if (Value == AdvertisedValue)
+	{
+		PendingAdvertisedValues.Remove(Key);
+		return;
+	}
+
+	PendingAdvertisedValues.Add(Key, Value);
+}
+
+void UMultiplayerSessionsSubsystem::FlushGameSessionAdvertisedValues(double CurrentSeconds)
+{
+	if (InFlightAdvertisedSettings.IsValid() == true)
+	{
+		if (CurrentSeconds < AdvertisedUpdateDeadlineSeconds)
+		{
+			return;
+		}
+
+		UE_LOG(LogMultiplayerSessionsSubsystem, Warning, TEXT("Advertised session values were not confirmed in %.0fs. Retrying."), AdvertisedUpdateTimeoutSeconds);
+		RequeueInFlightAdvertisedValues();
+	}
+
+	if (PendingAdvertisedValues.Num() == 0 || CurrentSeconds < NextAdvertisedUpdateSeconds || IsGameSessionOperationRunning() == true)
+	{
+		return;
+	}
+
+	FNamedOnlineSession* GameSession = SessionInterface.IsValid() == true ? SessionInterface->GetNamedSession(NAME_GameSession) : nullptr;
+	if (GameSession == nullptr || OwnsSessionNamed(NAME_GameSession) == false)
+	{
+		PendingAdvertisedValues.Reset();
+		return;
+	}
+
+	const FNamedSessionState& GameSessionState = GetNamedSessionState(NAME_GameSession);
+	const TSharedRef<FOnlineSessionSettings> SessionSettings = MakeShared<FOnlineSessionSettings>(GameSessionState.CommittedSessionSettings.IsValid() == true ? *GameSessionState.CommittedSessionSettings : GameSession->SessionSettings);
+	for (const TPair<FName, int32>& Value : PendingAdvertisedValues)
+	{
+		SessionSettings->Set(Value.Key, Value.Value, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+
+	InFlightAdvertisedSettings = SessionSettings;
+	InFlightAdvertisedValues = MoveTemp(PendingAdvertisedValues);
+	PendingAdvertisedValues.Reset();
+	NextAdvertisedUpdateSeconds = CurrentSeconds + AdvertisedUpdateIntervalSeconds;
+	AdvertisedUpdateDeadlineSeconds = CurrentSeconds + AdvertisedUpdateTimeoutSeconds;
+
+	if (SessionInterface->UpdateSession(NAME_GameSession, *SessionSettings, true) == false && InFlightAdvertisedSettings == SessionSettings)
+	{
+		RequeueInFlightAdvertisedValues();
+	}
+}
+
+void UMultiplayerSessionsSubsystem::OnGameSessionAdvertisedValuesUpdated(FName SessionName, bool bWasSuccessful)
+{
+	if (SessionName != NAME_GameSession || InFlightAdvertisedSettings.IsValid() == false)
+	{
+		return;
+	}
+
+	if (bWasSuccessful == false)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Advertised session values were rejected. Retrying."));
+		RequeueInFlightAdvertisedValues();
+		return;
+	}
+
+	GetNamedSessionState(NAME_GameSession).CommittedSessionSettings = InFlightAdvertisedSettings;
+	InFlightAdvertisedSettings.Reset();
+	const TMap<FName, int32> UpdatedValues = MoveTemp(InFlightAdvertisedValues);
+	InFlightAdvertisedValues.Reset();
+
+	if (const int32* ReservedSlots = UpdatedValues.Find(MultiplayerSessionsKeys::ReservedSlots))
+	{
+		AdvertisedReservedSlots = *ReservedSlots;
+		UE_LOG(LogMultiplayerSessionsSubsystem, Verbose, TEXT("Advertising %d reserved slot(s)."), AdvertisedReservedSlots);
+	}
+
+	if (const int32* JoinBusy = UpdatedValues.Find(MultiplayerSessionsKeys::JoinBusy))
+	{
+		bAdvertisedJoinBusy = *JoinBusy != 0;
+		if (bAdvertisedJoinBusy == true)
+		{
+			INC_DWORD_STAT(STAT_MultiplayerSessions_HostBusyRaised);
+		}
+
+		UE_LOG(LogMultiplayerSessionsSubsystem, Log, TEXT("Host %s the join busy hint at %.1f arrivals/s."), bAdvertisedJoinBusy == true ? TEXT("raised") : TEXT("cleared"), HostJoinAttemptsPerSecond);
+	}
+}
+
+void UMultiplayerSessionsSubsystem::RequeueInFlightAdvertisedValues()
+{
+	for (const TPair<FName, int32>& Value : InFlightAdvertisedValues)
+	{
+		if (PendingAdvertisedValues.Contains(Value.Key) == false)
+		{
+			PendingAdvertisedValues.Add(Value.Key, Value.Value);
+		}
+	}
+
+	InFlightAdvertisedValues.Reset();
+	InFlightAdvertisedSettings.Reset();
+}
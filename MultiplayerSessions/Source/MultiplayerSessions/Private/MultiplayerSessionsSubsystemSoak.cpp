@@ -0,0 +1,432 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSubsystem.h"
+
+#include "MultiplayerSessionsFakeSession.h"
+#include "MultiplayerSessionsPrivate.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+
+#if !UE_BUILD_SHIPPING
+
+struct FMultiplayerSessionSoakSample
+{
+	int32 Cycle = 0;
+	int32 SessionDelegateHandles = 0;
+	int32 BoundDelegateLists = 0;
+	int64 DelegateBytes = 0;
+	int32 PendingCompletions = 0;
+	int32 LiveObjects = 0;
+	int64 UsedPhysicalBytes = 0;
+	int64 CachedSearchBytes = 0;
+	double MeanTickMicroseconds = 0.0;
+};
+
+namespace
+{
+	constexpr int32 SoakActionsPerCycle = 4;
+	constexpr int32 SoakSampleCount = 40;
+	constexpr int32 SoakWarmupSamples = 2;
+	constexpr int32 SoakMinGrowthSamples = 8;
+	constexpr int32 SoakGrowthWindowDivisor = 4;
+	constexpr double SoakStallSeconds = 30.0;
+	constexpr float SoakOperationTimeoutSeconds = 1.0f;
+
+	struct FSoakGrowthCheck
+	{
+		const TCHAR* MetricName = nullptr;
+		double Tolerance = 0.0;
+		double (*GetValue)(const FMultiplayerSessionSoakSample&) = nullptr;
+	};
+
+	const FSoakGrowthCheck SoakGrowthChecks[] =
+	{
+		{ TEXT("SessionDelegateHandles"), 0.0, [](const FMultiplayerSessionSoakSample& Sample) { return static_cast<double>(Sample.SessionDelegateHandles); } },
+		{ TEXT("BoundDelegateLists"), 0.0, [](const FMultiplayerSessionSoakSample& Sample) { return static_cast<double>(Sample.BoundDelegateLists); } },
+		{ TEXT("DelegateBytes"), 0.0, [](const FMultiplayerSessionSoakSample& Sample) { return static_cast<double>(Sample.DelegateBytes); } },
+		{ TEXT("PendingCompletions"), 4.0, [](const FMultiplayerSessionSoakSample& Sample) { return static_cast<double>(Sample.PendingCompletions); } },
+		{ TEXT("LiveObjects"), 16.0, [](const FMultiplayerSessionSoakSample& Sample) { return static_cast<double>(Sample.LiveObjects); } },
+		{ TEXT("UsedPhysicalBytes"), 4.0 * 1024.0 * 1024.0, [](const FMultiplayerSessionSoakSample& Sample) { return static_cast<double>(Sample.UsedPhysicalBytes); } },
+		{ TEXT("CachedSearchBytes"), 0.0, [](const FMultiplayerSessionSoakSample& Sample) { return static_cast<double>(Sample.CachedSearchBytes); } },
+		{ TEXT("MeanTickMicroseconds"), 1.0, [](const FMultiplayerSessionSoakSample& Sample) { return Sample.MeanTickMicroseconds; } }
+	};
+
+	double GetWindowMean(const TArray<FMultiplayerSessionSoakSample>& Samples, const FSoakGrowthCheck& GrowthCheck, int32 FirstIndex, int32 Count)
+	{
+		double Sum = 0.0;
+		for (int32 Index = FirstIndex; Index < FirstIndex + Count; Index++)
+		{
+			Sum += GrowthCheck.GetValue(Samples[Index]);
+		}
+
+		return Sum / FMath::Max(1, Count);
+	}
+
+	bool HasSustainedGrowth(const TArray<FMultiplayerSessionSoakSample>& Samples, const FSoakGrowthCheck& GrowthCheck, double& OutGrowth)
+	{
+		OutGrowth = 0.0;
+		const int32 FirstIndex = FMath::Min(SoakWarmupSamples, Samples.Num());
+		const int32 SampleCount = Samples.Num() - FirstIndex;
+		if (SampleCount < SoakMinGrowthSamples)
+		{
+			return false;
+		}
+
+		const int32 WindowCount = FMath::Max(2, SampleCount / SoakGrowthWindowDivisor);
+		const double StartMean = GetWindowMean(Samples, GrowthCheck, FirstIndex, WindowCount);
+		const double EndMean = GetWindowMean(Samples, GrowthCheck, Samples.Num() - WindowCount, WindowCount);
+		OutGrowth = EndMean - StartMean;
+		return OutGrowth > GrowthCheck.Tolerance;
+	}
+}
+
+class FMultiplayerSessionSoakRun
+{
+public:
+	TSharedPtr<FMultiplayerSessionsFakeSession, ESPMode::ThreadSafe> FakeSession;
+	IOnlineSessionPtr PreviousSessionInterfaceOverride;
+	FRandomStream RandomStream;
+	TArray<FMultiplayerSessionSoakSample> Samples;
+	int32 TargetCycles = 0;
+	int32 SampleIntervalCycles = 1;
+	int32 NextSampleCycle = 0;
+	int32 StartedActions = 0;
+	int32 CreateActions = 0;
+	int32 FindActions = 0;
+	int32 CancelledFinds = 0;
+	int32 JoinActions = 0;
+	int32 DestroyActions = 0;
+	double StartSeconds = 0.0;
+	double LastIdleSeconds = 0.0;
+	double CancelFindAtSeconds = 0.0;
+	double TickSecondsAtLastSample = 0.0;
+	int64 TickCountAtLastSample = 0;
+	bool bStopRequested = false;
+};
+
+namespace
+{
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice SoakStartCommand(
+		TEXT("ms.Soak.Start"),
+		TEXT("Runs randomized create/find/join/destroy cycles against the fake session interface and fails on sustained growth. Usage: ms.Soak.Start [Cycles] [Seed]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World);
+			if (Subsystem == nullptr)
+			{
+				Ar.Log(TEXT("Multiplayer sessions subsystem is not available."));
+				return;
+			}
+
+			const int32 CycleCount = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20000;
+			const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 0;
+			Subsystem->StartSoakTest(CycleCount, Seed, Ar);
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs SoakStopCommand(
+		TEXT("ms.Soak.Stop"),
+		TEXT("Stops the running soak test once the current operation settles."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UMultiplayerSessionsSubsystem* Subsystem = MultiplayerSessionsConsole::FindSubsystem(World);
+			if (Subsystem != nullptr)
+			{
+				Subsystem->StopSoakTest();
+			}
+		}));
+}
+
+bool UMultiplayerSessionsSubsystem::StartSoakTest(int32 CycleCount, int32 Seed, FOutputDevice& Ar)
+{
+	if (SoakRun.IsValid() == true)
+	{
+		Ar.Log(TEXT("Soak test is already running."));
+		return false;
+	}
+
+	if (ActiveOperation.Type != EOperationType::None || CurrentFlowState != EMultiplayerSessionFlowState::Idle)
+	{
+		Ar.Log(TEXT("Soak test not started: another session operation is running."));
+		return false;
+	}
+
+	if (ResolveDefaultLocalPlayer() == nullptr)
+	{
+		Ar.Log(TEXT("Soak test not started: it needs a local player."));
+		return false;
+	}
+
+	const TSharedRef<FMultiplayerSessionSoakRun> Run = MakeShared<FMultiplayerSessionSoakRun>();
+	Run->PreviousSessionInterfaceOverride = SessionInterfaceOverride;
+	Run->RandomStream.Initialize(Seed);
+	Run->TargetCycles = FMath::Max(1, CycleCount);
+	Run->SampleIntervalCycles = FMath::Max(1, Run->TargetCycles / SoakSampleCount);
+
+	FMultiplayerSessionsFakeCallSettings CallSettings;
+	CallSettings.MinLatencySeconds = 0.001f;
+	CallSettings.MaxLatencySeconds = 0.01f;
+	CallSettings.FailureRate = 0.1f;
+	CallSettings.DropRate = 0.02f;
+	CallSettings.LateRate = 0.03f;
+	CallSettings.LateDelaySeconds = SoakOperationTimeoutSeconds * 1.5f;
+
+	FMultiplayerSessionSearchRequest SearchRequest;
+	Run->FakeSession = MakeShared<FMultiplayerSessionsFakeSession, ESPMode::ThreadSafe>(Seed);
+	Run->FakeSession->SetAllCallSettings(CallSettings);
+	Run->FakeSession->SetSyntheticSearchResults(64, SearchRequest.DesiredMatchType, GetLocalCompatibilityBuildId(), FMath::Max(1, SearchRequest.DesiredSessionSchemaVersion));
+	Run->FakeSession->SetConnectString(FString());
+
+	if (SetSessionInterfaceOverride(Run->FakeSession) == false)
+	{
+		Ar.Log(TEXT("Soak test not started: the session interface could not be replaced."));
+		return false;
+	}
+
+	Run->StartSeconds = FPlatformTime::Seconds();
+	Run->LastIdleSeconds = Run->StartSeconds;
+	Run->TickSecondsAtLastSample = OperationTickSeconds;
+	Run->TickCountAtLastSample = OperationTickCount;
+
+	SoakRun = Run;
+	SoakTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickSoakTest), 0.0f);
+
+	Ar.Logf(TEXT("Soak test started: Cycles=%d Seed=%d SampleEvery=%d cycles."), Run->TargetCycles, Seed, Run->SampleIntervalCycles);
+	UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("%8s %8s %8s %10s %8s %10s %14s %12s %10s"), TEXT("Cycle"), TEXT("Handles"), TEXT("Bound"), TEXT("DelBytes"), TEXT("Pending"), TEXT("Objects"), TEXT("UsedPhys"), TEXT("CacheBytes"), TEXT("TickUs"));
+	return true;
+}
+
+void UMultiplayerSessionsSubsystem::StopSoakTest()
+{
+	if (SoakRun.IsValid() == false)
+	{
+		return;
+	}
+
+	SoakRun->bStopRequested = true;
+	UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("Soak test stop requested."));
+}
+
+bool UMultiplayerSessionsSubsystem::IsSoakTestRunning() const
+{
+	return SoakRun.IsValid() == true;
+}
+
+#endif
+
+bool UMultiplayerSessionsSubsystem::GetSoakTimeoutSeconds(EOperationTimeout Timeout, float& OutTimeoutSeconds) const
+{
+#if !UE_BUILD_SHIPPING
+	if (SoakRun.IsValid() == false)
+	{
+		return false;
+	}
+
+	OutTimeoutSeconds = Timeout == EOperationTimeout::RecoveryGrace ? 0.0f : SoakOperationTimeoutSeconds;
+	return true;
+#else
+	return false;
+#endif
+}
+
+int32 UMultiplayerSessionsSubsystem::GetNumSessionDelegateHandles() const
+{
+	const FDelegateHandle* const SessionDelegateHandles[] =
+	{
+		&CreateSessionCompleteDelegateHandle,
+		&FindSessionsCompleteDelegateHandle,
+		&FindFriendSessionCompleteDelegateHandle,
+		&SessionInviteAcceptedDelegateHandle,
+		&JoinSessionCompleteDelegateHandle,
+		&DestroySessionCompleteDelegateHandle,
+		&UpdateSessionCompleteDelegateHandle,
+		&StartSessionCompleteDelegateHandle,
+		&EndSessionCompleteDelegateHandle,
+		&RecoveryDestroyCompleteDelegateHandle
+	};
+
+	int32 NumHandles = 0;
+	for (const FDelegateHandle* SessionDelegateHandle : SessionDelegateHandles)
+	{
+		if (SessionDelegateHandle->IsValid() == true)
+		{
+			NumHandles++;
+		}
+	}
+
+	return NumHandles;
+}
+
+bool UMultiplayerSessionsSubsystem::TickSoakTest(float DeltaTime)
+{
+#if !UE_BUILD_SHIPPING
+	if (SoakRun.IsValid() == false)
+	{
+		return false;
+	}
+
+	FMultiplayerSessionSoakRun& Run = *SoakRun;
+	const double CurrentSeconds = FPlatformTime::Seconds();
+	const bool bIdle = ActiveOperation.Type == EOperationType::None && CurrentFlowState == EMultiplayerSessionFlowState::Idle;
+	if (bIdle == false)
+	{
+		if (Run.CancelFindAtSeconds > 0.0 && CurrentSeconds >= Run.CancelFindAtSeconds)
+		{
+			Run.CancelFindAtSeconds = 0.0;
+			if (CancelFindSessions() == true)
+			{
+				Run.CancelledFinds++;
+			}
+		}
+
+		if (CurrentSeconds - Run.LastIdleSeconds > SoakStallSeconds)
+		{
+			FinishSoakTest(false, FString::Printf(TEXT("stalled in %s/%s for %.1fs"), *OperationTypeToString(ActiveOperation.Type), *OperationStepToString(ActiveOperation.Step), CurrentSeconds - Run.LastIdleSeconds));
+			return false;
+		}
+
+		return true;
+	}
+
+	Run.LastIdleSeconds = CurrentSeconds;
+	Run.CancelFindAtSeconds = 0.0;
+
+	const int32 CompletedCycles = Run.StartedActions / SoakActionsPerCycle;
+	const bool bFinished = CompletedCycles >= Run.TargetCycles || Run.bStopRequested == true;
+	if (CompletedCycles >= Run.NextSampleCycle || bFinished == true)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		FMultiplayerSessionSoakSample& Sample = Run.Samples.AddDefaulted_GetRef();
+		Sample.Cycle = CompletedCycles;
+		Sample.SessionDelegateHandles = GetNumSessionDelegateHandles();
+		Sample.BoundDelegateLists = Run.FakeSession->GetNumBoundDelegateLists();
+		Sample.DelegateBytes = static_cast<int64>(Run.FakeSession->GetDelegateAllocatedSize());
+		Sample.PendingCompletions = Run.FakeSession->GetNumPendingCompletions();
+		Sample.LiveObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		Sample.UsedPhysicalBytes = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+		Sample.CachedSearchBytes = static_cast<int64>(GetCachedSearchAllocatedSize());
+
+		const int64 TickCount = OperationTickCount - Run.TickCountAtLastSample;
+		if (TickCount > 0)
+		{
+			Sample.MeanTickMicroseconds = (OperationTickSeconds - Run.TickSecondsAtLastSample) * 1000000.0 / static_cast<double>(TickCount);
+		}
+
+		Run.TickSecondsAtLastSample = OperationTickSeconds;
+		Run.TickCountAtLastSample = OperationTickCount;
+		Run.NextSampleCycle = CompletedCycles + Run.SampleIntervalCycles;
+
+		UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("%8d %8d %8d %10lld %8d %10d %14lld %12lld %10.2f"), Sample.Cycle, Sample.SessionDelegateHandles, Sample.BoundDelegateLists, Sample.DelegateBytes, Sample.PendingCompletions, Sample.LiveObjects, Sample.UsedPhysicalBytes, Sample.CachedSearchBytes, Sample.MeanTickMicroseconds);
+
+		if (Sample.SessionDelegateHandles > 1 || Sample.BoundDelegateLists > 1)
+		{
+			FinishSoakTest(false, FString::Printf(TEXT("idle subsystem still holds %d session delegate handles across %d bound delegate lists"), Sample.SessionDelegateHandles, Sample.BoundDelegateLists));
+			return false;
+		}
+	}
+
+	if (bFinished == true)
+	{
+		FString GrowthSummary;
+		for (const FSoakGrowthCheck& GrowthCheck : SoakGrowthChecks)
+		{
+			double Growth = 0.0;
+			if (HasSustainedGrowth(Run.Samples, GrowthCheck, Growth) == true)
+			{
+				GrowthSummary += FString::Printf(TEXT(" %s+%.0f"), GrowthCheck.MetricName, Growth);
+			}
+		}
+
+		if (GrowthSummary.IsEmpty() == false)
+		{
+			FinishSoakTest(false, FString::Printf(TEXT("sustained growth:%s"), *GrowthSummary));
+		}
+		else
+		{
+			FinishSoakTest(Run.bStopRequested == false, Run.bStopRequested == true ? TEXT("stopped") : TEXT("no sustained growth"));
+		}
+
+		return false;
+	}
+
+	Run.StartedActions++;
+	const float ActionRoll = Run.RandomStream.FRand();
+	if (ActionRoll < 0.25f)
+	{
+		Run.CreateActions++;
+		FMultiplayerSessionCreateRequest CreateRequest;
+		CreateRequest.bReplaceExistingSession = Run.RandomStream.FRand() < 0.5f;
+		CreateSessionFromRequest(CreateRequest);
+		return true;
+	}
+
+	const bool bJoinAction = ActionRoll >= 0.55f && ActionRoll < 0.75f;
+	if (bJoinAction == true && CachedSearchResults.Num() > 0)
+	{
+		Run.JoinActions++;
+		JoinSessionBySearchResultIndex(Run.RandomStream.RandRange(0, CachedSearchResults.Num() - 1));
+		return true;
+	}
+
+	if (ActionRoll < 0.75f)
+	{
+		Run.FindActions++;
+		FindSessionsFromRequest(FMultiplayerSessionSearchRequest());
+		if (Run.RandomStream.FRand() < 0.2f)
+		{
+			Run.CancelFindAtSeconds = CurrentSeconds + Run.RandomStream.FRandRange(0.0f, 0.02f);
+		}
+		return true;
+	}
+
+	Run.DestroyActions++;
+	DestroySession();
+	return true;
+#else
+	return false;
+#endif
+}
+
+void UMultiplayerSessionsSubsystem::FinishSoakTest(bool bPassed, const FString& Summary)
+{
+#if !UE_BUILD_SHIPPING
+	FTSTicker::GetCoreTicker().RemoveTicker(SoakTickerHandle);
+	SoakTickerHandle.Reset();
+
+	const TSharedPtr<FMultiplayerSessionSoakRun> Run = MoveTemp(SoakRun);
+	if (Run.IsValid() == false)
+	{
+		return;
+	}
+
+	if (ActiveOperation.Type != EOperationType::None)
+	{
+		ClearAllDelegateHandles();
+		const uint64 AbandonedOperationGeneration = ActiveOperation.Generation;
+		const EMultiplayerSessionFlowState PreviousFlowState = ResetActiveOperation();
+		BroadcastIdleStateIfUnchanged(PreviousFlowState, AbandonedOperationGeneration);
+	}
+
+	SetSessionInterfaceOverride(Run->PreviousSessionInterfaceOverride);
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - Run->StartSeconds;
+	const int32 CompletedCycles = Run->StartedActions / SoakActionsPerCycle;
+	if (bPassed == true)
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("Soak test passed after %d cycles in %.1fs: %s."), CompletedCycles, ElapsedSeconds, *Summary);
+	}
+	else
+	{
+		UE_LOG(LogMultiplayerSessionsSubsystem, Error, TEXT("Soak test failed after %d cycles in %.1fs: %s."), CompletedCycles, ElapsedSeconds, *Summary);
+	}
+
+	UE_LOG(LogMultiplayerSessionsSubsystem, Display, TEXT("Soak actions: Create=%d Find=%d CancelledFind=%d Join=%d Destroy=%d."), Run->CreateActions, Run->FindActions, Run->CancelledFinds, Run->JoinActions, Run->DestroyActions);
+	if (GLog != nullptr)
+	{
+		Run->FakeSession->DumpFakeState(*GLog);
+	}
+#endif
+}
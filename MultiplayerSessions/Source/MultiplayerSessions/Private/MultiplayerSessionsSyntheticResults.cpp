@@ -0,0 +1,173 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsSyntheticResults.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "MultiplayerSessionsPrivate.h"
+#include "OnlineSubsystemTypes.h"
+
+namespace
+{
+	const FName SyntheticNetIdType(TEXT("Synthetic"));
+
+	class FSyntheticSessionInfo : public FOnlineSessionInfo
+	{
+	public:
+		explicit FSyntheticSessionInfo(const FString& InSessionId)
+			: SessionId(FUniqueNetIdString::Create(InSessionId, SyntheticNetIdType))
+		{
+		}
+
+		virtual const uint8* GetBytes() const override
+		{
+			return nullptr;
+		}
+
+		virtual int32 GetSize() const override
+		{
+			return sizeof(FSyntheticSessionInfo);
+		}
+
+		virtual bool IsValid() const override
+		{
+			return true;
+		}
+
+		virtual const FUniqueNetId& GetSessionId() const override
+		{
+			return *SessionId;
+		}
+
+		virtual FString ToString() const override
+		{
+			return SessionId->ToString();
+		}
+
+		virtual FString ToDebugString() const override
+		{
+			return FString::Printf(TEXT("SyntheticSession=%s"), *SessionId->ToString());
+		}
+
+	private:
+		FUniqueNetIdStringRef SessionId;
+	};
+
+	const TCHAR* const SyntheticRegions[] = { TEXT("eu"), TEXT("na"), TEXT("sa"), TEXT("asia"), TEXT("oce") };
+	const TCHAR* const SyntheticNameWords[] = { TEXT("Casual"), TEXT("Ranked"), TEXT("Friday"), TEXT("Night"), TEXT("Tower"), TEXT("Defense"), TEXT("Veterans"), TEXT("Only"), TEXT("Chill"), TEXT("Practice") };
+
+	FString MakeSyntheticName(const TCHAR* Prefix, int32 Index, FRandomStream& RandomStream)
+	{
+		FString Name = FString::Printf(TEXT("%s %d"), Prefix, Index);
+		const int32 WordCount = RandomStream.RandRange(2, 14);
+		for (int32 WordIndex = 0; WordIndex < WordCount; WordIndex++)
+		{
+			Name += TEXT(" ");
+			Name += SyntheticNameWords[RandomStream.RandRange(0, UE_ARRAY_COUNT(SyntheticNameWords) - 1)];
+		}
+
+		return Name;
+	}
+
+	FString PickSyntheticStatus(FRandomStream& RandomStream)
+	{
+		const float Roll = RandomStream.FRand();
+		if (Roll < 0.50f)
+		{
+			return TEXT("Lobby");
+		}
+		if (Roll < 0.80f)
+		{
+			return TEXT("InMatch");
+		}
+		if (Roll < 0.90f)
+		{
+			return TEXT("Starting");
+		}
+		if (Roll < 0.95f)
+		{
+			return TEXT("Full");
+		}
+
+		return FString();
+	}
+}
+
+FOnlineSessionSearchResult MultiplayerSessionsSynthetic::MakeSearchResult(int32 Index, const FSyntheticResultOptions& Options, FRandomStream& RandomStream)
+{
+	FOnlineSessionSearchResult SearchResult;
+	SearchResult.PingInMs = RandomStream.FRand() < 0.05f ? MAX_QUERY_PING : RandomStream.RandRange(8, 320);
+
+	FOnlineSession& Session = SearchResult.Session;
+	Session.OwningUserId = FUniqueNetIdString::Create(FString::Printf(TEXT("SyntheticHost_%d"), Index), SyntheticNetIdType);
+	Session.OwningUserName = MakeSyntheticName(TEXT("Host"), Index, RandomStream);
+	Session.SessionInfo = MakeShared<FSyntheticSessionInfo>(FString::Printf(TEXT("SyntheticSession_%d_%d"), Options.Seed, Index));
+
+	FOnlineSessionSettings& SessionSettings = Session.SessionSettings;
+	SessionSettings.NumPublicConnections = RandomStream.RandRange(2, 64);
+	SessionSettings.bAllowJoinInProgress = RandomStream.FRand() < 0.7f;
+	SessionSettings.bShouldAdvertise = true;
+	Session.NumOpenPublicConnections = RandomStream.RandRange(0, SessionSettings.NumPublicConnections);
+
+	const bool bMatchingType = RandomStream.FRand() < 0.9f;
+	SessionSettings.Set(MultiplayerSessionsKeys::MatchType, bMatchingType == true ? Options.MatchType : FString(TEXT("Deathmatch")), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionSettings.Set(MultiplayerSessionsKeys::BuildId, RandomStream.FRand() < 0.85f ? Options.BuildId : Options.BuildId + 1, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionSettings.Set(MultiplayerSessionsKeys::SchemaVersion, RandomStream.FRand() < 0.95f ? Options.SessionSchemaVersion : Options.SessionSchemaVersion + 1, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionSettings.Set(MultiplayerSessionsKeys::ConfiguredAllowJoinInProgress, SessionSettings.bAllowJoinInProgress, EOnlineDataAdvertisementType::DontAdvertise);
+	SessionSettings.Set(MultiplayerSessionsKeys::DisplayName, MakeSyntheticName(TEXT("Session"), Index, RandomStream), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionSettings.Set(MultiplayerSessionsKeys::HostDisplayName, Session.OwningUserName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionSettings.Set(MultiplayerSessionsKeys::MapName, FString::Printf(TEXT("/Game/Maps/Arena_%02d"), RandomStream.RandRange(1, 24)), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionSettings.Set(MultiplayerSessionsKeys::RegionTag, FString(SyntheticRegions[RandomStream.RandRange(0, UE_ARRAY_COUNT(SyntheticRegions) - 1)]), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+
+	const FString Status = PickSyntheticStatus(RandomStream);
+	if (Status.IsEmpty() == false)
+	{
+		SessionSettings.Set(MultiplayerSessionsKeys::Status, Status, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+
+	return SearchResult;
+}
+
+void MultiplayerSessionsSynthetic::MakeSearchResults(int32 ResultCount, const FSyntheticResultOptions& Options, TArray<FOnlineSessionSearchResult>& OutSearchResults)
+{
+	FRandomStream RandomStream(Options.Seed);
+	OutSearchResults.Reset(ResultCount);
+	for (int32 Index = 0; Index < ResultCount; Index++)
+	{
+		OutSearchResults.Add(MakeSearchResult(Index, Options, RandomStream));
+	}
+}
+
+void MultiplayerSessionsSynthetic::MakeBrowserEntries(int32 EntryCount, const FSyntheticResultOptions& Options, TArray<FMultiplayerSessionBrowserEntry>& OutBrowserEntries)
+{
+	FRandomStream RandomStream(Options.Seed);
+	OutBrowserEntries.Reset(EntryCount);
+	for (int32 Index = 0; Index < EntryCount; Index++)
+	{
+		FMultiplayerSessionBrowserEntry& BrowserEntry = OutBrowserEntries.AddDefaulted_GetRef();
+		BrowserEntry.EntryId = FString::Printf(TEXT("SyntheticSession_%d_%d"), Options.Seed, Index);
+		BrowserEntry.SearchResultIndex = Index;
+		BrowserEntry.SessionId = BrowserEntry.EntryId;
+		BrowserEntry.SessionDisplayName = MakeSyntheticName(TEXT("Session"), Index, RandomStream);
+		BrowserEntry.HostDisplayName = MakeSyntheticName(TEXT("Host"), Index, RandomStream);
+		BrowserEntry.MatchType = Options.MatchType;
+		BrowserEntry.MapName = FString::Printf(TEXT("/Game/Maps/Arena_%02d"), RandomStream.RandRange(1, 24));
+		BrowserEntry.BuildId = Options.BuildId;
+		BrowserEntry.SessionSchemaVersion = Options.SessionSchemaVersion;
+		BrowserEntry.MaxPlayers = RandomStream.RandRange(2, 64);
+		BrowserEntry.OpenPublicConnections = RandomStream.RandRange(0, BrowserEntry.MaxPlayers);
+		BrowserEntry.CurrentPlayers = BrowserEntry.MaxPlayers - BrowserEntry.OpenPublicConnections;
+		BrowserEntry.PingInMs = RandomStream.FRand() < 0.05f ? MAX_QUERY_PING : RandomStream.RandRange(8, 320);
+		BrowserEntry.RegionTag = SyntheticRegions[RandomStream.RandRange(0, UE_ARRAY_COUNT(SyntheticRegions) - 1)];
+		BrowserEntry.AdvertisedStatusText = PickSyntheticStatus(RandomStream);
+		BrowserEntry.StatusText = BrowserEntry.AdvertisedStatusText.IsEmpty() == true ? FString(TEXT("Unknown")) : BrowserEntry.AdvertisedStatusText;
+		BrowserEntry.bCanJoin = BrowserEntry.OpenPublicConnections > 0;
+		if (BrowserEntry.bCanJoin == false)
+		{
+			BrowserEntry.JoinBlockReason = EMultiplayerJoinBlockReason::SessionFull;
+			BrowserEntry.JoinDisabledReasonText = TEXT("Session is full.");
+		}
+	}
+}
+
+#endif
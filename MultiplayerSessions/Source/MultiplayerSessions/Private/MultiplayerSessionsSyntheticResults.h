@@ -0,0 +1,26 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiplayerSessionsTypes.h"
+#include "OnlineSessionSettings.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace MultiplayerSessionsSynthetic
+{
+	struct FSyntheticResultOptions
+	{
+		FString MatchType = TEXT("TowerOnline");
+		int32 BuildId = 1;
+		int32 SessionSchemaVersion = 1;
+		int32 Seed = 0;
+	};
+
+	FOnlineSessionSearchResult MakeSearchResult(int32 Index, const FSyntheticResultOptions& Options, FRandomStream& RandomStream);
+	void MakeSearchResults(int32 ResultCount, const FSyntheticResultOptions& Options, TArray<FOnlineSessionSearchResult>& OutSearchResults);
+	void MakeBrowserEntries(int32 EntryCount, const FSyntheticResultOptions& Options, TArray<FMultiplayerSessionBrowserEntry>& OutBrowserEntries);
+}
+
+#endif
@@ -0,0 +1,60 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#include "MultiplayerSessionsTrace.h"
+
+#include "ProfilingDebugging/MiscTrace.h"
+
+#if MULTIPLAYERSESSIONS_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(MultiplayerSessionsChannel)
+
+UE_TRACE_EVENT_BEGIN(MultiplayerSessions, OperationEvent)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, Generation)
+	UE_TRACE_EVENT_FIELD(uint8, Phase)
+	UE_TRACE_EVENT_FIELD(uint8, OperationType)
+	UE_TRACE_EVENT_FIELD(uint8, OperationStep)
+	UE_TRACE_EVENT_FIELD(uint8, FailureReason)
+UE_TRACE_EVENT_END()
+
+#endif
+
+bool MultiplayerSessionsTrace::IsChannelEnabled()
+{
+#if MULTIPLAYERSESSIONS_TRACE_ENABLED
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(MultiplayerSessionsChannel);
+#else
+	return false;
+#endif
+}
+
+void MultiplayerSessionsTrace::OutputOperationEvent(EMultiplayerSessionTracePhase Phase, uint64 Generation, uint8 OperationType, const FString& OperationName, uint8 OperationStep, const FString& StepName, EMultiplayerSessionFailureReason FailureReason)
+{
+#if MULTIPLAYERSESSIONS_TRACE_ENABLED
+	if (IsChannelEnabled() == false)
+	{
+		return;
+	}
+
+	UE_TRACE_LOG(MultiplayerSessions, OperationEvent, MultiplayerSessionsChannel)
+		<< OperationEvent.Cycle(FPlatformTime::Cycles64())
+		<< OperationEvent.Generation(Generation)
+		<< OperationEvent.Phase(static_cast<uint8>(Phase))
+		<< OperationEvent.OperationType(OperationType)
+		<< OperationEvent.OperationStep(OperationStep)
+		<< OperationEvent.FailureReason(static_cast<uint8>(FailureReason));
+
+	if (Phase == EMultiplayerSessionTracePhase::Begin)
+	{
+		TRACE_BOOKMARK(TEXT("MultiplayerSessions %s begin (generation %llu)"), *OperationName, Generation);
+	}
+	else if (Phase == EMultiplayerSessionTracePhase::StepChanged)
+	{
+		TRACE_BOOKMARK(TEXT("MultiplayerSessions %s step %s (generation %llu)"), *OperationName, *StepName, Generation);
+	}
+	else
+	{
+		TRACE_BOOKMARK(TEXT("MultiplayerSessions %s completed: %s (generation %llu)"), *OperationName, *StaticEnum<EMultiplayerSessionFailureReason>()->GetNameStringByValue(static_cast<int64>(FailureReason)), Generation);
+	}
+#endif
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+#include "MultiplayerSessionsTypes.h"
+
+#define MULTIPLAYERSESSIONS_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if MULTIPLAYERSESSIONS_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(MultiplayerSessionsChannel)
+
+#define MULTIPLAYERSESSIONS_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, MultiplayerSessionsChannel)
+
+#else
+
+#define MULTIPLAYERSESSIONS_TRACE_SCOPE(Name)
+
+#endif
+
+enum class EMultiplayerSessionTracePhase : uint8
+{
+	Begin,
+	StepChanged,
+	Completed
+};
+
+namespace MultiplayerSessionsTrace
+{
+	bool IsChannelEnabled();
+	void OutputOperationEvent(EMultiplayerSessionTracePhase Phase, uint64 Generation, uint8 OperationType, const FString& OperationName, uint8 OperationStep, const FString& StepName, EMultiplayerSessionFailureReason FailureReason);
+}
@@ -35,8 +35,13 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void DebugPopulateFakeSessions();
 
+#if !UE_BUILD_SHIPPING
+	bool RunRenderBenchmark(int32 EntryCount, FOutputDevice& Ar);
+#endif
+
 protected:
 	virtual bool Initialize() override;
+	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
 
 private:
@@ -64,6 +69,12 @@ private:
 	UFUNCTION()
 	void HandleSessionSearchCompleted(bool bWasSuccessful, const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries);
 
+	UFUNCTION()
+	void HandleBrowserEntriesUpdated(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries);
+
+	UFUNCTION()
+	void HandleBrowserEntriesChanged(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, const FMultiplayerSessionBrowserChangeSet& ChangeSet);
+
 	UFUNCTION()
 	void HandleJoinSessionRequestCompleted(EMultiplayerJoinSessionResult Result);
 
@@ -74,12 +85,14 @@ private:
 	void HandleSessionFailure(EMultiplayerSessionFailureReason FailureReason);
 
 	void HandleSessionListSelectionChanged(UObject* SelectedItem);
+	void HandleNativeVisibilityChanged(ESlateVisibility InVisibility);
 	void BindSubsystemDelegates();
 	void UnbindSubsystemDelegates();
 	void ResolveSubsystemMode();
 	void RequestCreateSession();
 	void RequestFindSessions();
 	void BuildSessionListItems(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries);
+	void ApplyBrowserChangeSet(const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, const FMultiplayerSessionBrowserChangeSet& ChangeSet);
 	void ClearSessionListItems();
 	void SetBusyState(bool bInIsBusy);
 	void SetStatusText(const FString& InStatusText);
@@ -87,6 +100,7 @@ private:
 	void UpdateConnectionModeText();
 
 	bool ShouldUseLanMode() const;
+	bool IsEventForAnotherLocalPlayer() const;
 	FString ResolveLocalNicknameForSession() const;
 	FString ResolvePendingNicknameFromGameInstance() const;
 	FString BuildSessionDisplayName(const FString& InHostNickname) const;
@@ -133,6 +147,9 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Multiplayer")
 	int32 SessionBuildId = 0;
 
+	UPROPERTY(EditDefaultsOnly, Category = "Multiplayer", meta = (ToolTip = "After the first refresh, keep the session list current with background searches while the menu is visible."))
+	bool bAutoRefreshSessions = true;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UMultiplayerSessionsSubsystem> MultiplayerSessionsSubsystem;
 
@@ -20,7 +20,35 @@ public:
 		return BrowserEntry;
 	}
 
+	const FText& GetHostText() const
+	{
+		return HostText;
+	}
+
+	const FText& GetStatusText() const
+	{
+		return StatusText;
+	}
+
+	const FText& GetFreeSlotsText() const
+	{
+		return FreeSlotsText;
+	}
+
+	const FText& GetPingText() const
+	{
+		return PingText;
+	}
+
+private:
+	void BuildDisplayTexts();
+
 private:
 	UPROPERTY()
 	FMultiplayerSessionBrowserEntry BrowserEntry;
+
+	FText HostText;
+	FText StatusText;
+	FText FreeSlotsText;
+	FText PingText;
 };
@@ -0,0 +1,33 @@
+// Copyright (c) 2026 Zoxemik. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "UObject/Object.h"
+#include "MultiplayerSessionsTypes.h"
+#include "MultiplayerSessionScorer.generated.h"
+
+UINTERFACE(BlueprintType)
+class MULTIPLAYERSESSIONS_API UMultiplayerSessionScorer : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class MULTIPLAYERSESSIONS_API IMultiplayerSessionScorer
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	float ScoreSessionEntry(const FMultiplayerSessionBrowserEntry& BrowserEntry, const FMultiplayerSessionScoringWeights& ScoringWeights) const;
+};
+
+UCLASS(Blueprintable, BlueprintType)
+class MULTIPLAYERSESSIONS_API UMultiplayerSessionWeightedScorer : public UObject, public IMultiplayerSessionScorer
+{
+	GENERATED_BODY()
+
+public:
+	virtual float ScoreSessionEntry_Implementation(const FMultiplayerSessionBrowserEntry& BrowserEntry, const FMultiplayerSessionScoringWeights& ScoringWeights) const override;
+};
@@ -11,6 +11,17 @@
 #include "MultiplayerSessionsTypes.h"
 #include "MultiplayerSessionsSubsystem.generated.h"
 
+class AGameModeBase;
+class FMultiplayerSessionFlightRecorder;
+class FMultiplayerSessionLanHost;
+class FMultiplayerSessionLanSearch;
+class FMultiplayerSessionOperationStats;
+class FMultiplayerSessionSoakRun;
+class FMultiplayerSessionPingProber;
+class FMultiplayerSessionPingResponder;
+class FMultiplayerSessionSlotReserver;
+enum class EMultiplayerSessionFlightEvent : uint8;
+enum class EMultiplayerSessionTracePhase : uint8;
 class IOnlineSubsystem;
 class ULocalPlayer;
 class UNetDriver;
@@ -33,6 +44,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMultiplayerOnSessionInviteSent, bo
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMultiplayerOnPlatformInviteUIOpened, bool, bWasOpened, EMultiplayerSessionFailureReason, FailureReason);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMultiplayerOnSessionInviteAccepted, bool, bJoinStarted, EMultiplayerSessionFailureReason, FailureReason);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMultiplayerOnFriendSessionSearchCompleted, bool, bWasSuccessful, EMultiplayerSessionFailureReason, FailureReason);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerOnBrowserEntriesUpdated, const TArray<FMultiplayerSessionBrowserEntry>&, BrowserEntries);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMultiplayerOnBrowserEntriesChanged, const TArray<FMultiplayerSessionBrowserEntry>&, BrowserEntries, const FMultiplayerSessionBrowserChangeSet&, ChangeSet);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMultiplayerOnQuickMatchCompleted, const FMultiplayerQuickMatchReport&, Report);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMultiplayerOnHeadlessHostReady, bool, bWasSuccessful, float, BootToAdvertisedSeconds);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FMultiplayerOnRegisteredSessionChanged, FName, SessionName, EMultiplayerRegisteredSessionState, State, bool, bWasSuccessful);
 
 DECLARE_LOG_CATEGORY_EXTERN(LogMultiplayerSessionsSubsystem, Log, All);
 
@@ -67,6 +83,39 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions")
 	void FindSessionsForLocalPlayer(ULocalPlayer* LocalPlayer, const FMultiplayerSessionSearchRequest& SearchRequest);
 
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions")
+	bool CancelFindSessions();
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions")
+	bool CancelFindSessionsForLocalPlayer(ULocalPlayer* LocalPlayer);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	void StartAutoRefresh(ULocalPlayer* LocalPlayer, const FMultiplayerSessionSearchRequest& SearchRequest);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	void StopAutoRefresh();
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	void StopAutoRefreshForLocalPlayer(ULocalPlayer* LocalPlayer);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	void SetAutoRefreshPaused(bool bPaused);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	void SetAutoRefreshPausedForLocalPlayer(ULocalPlayer* LocalPlayer, bool bPaused);
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Browser")
+	bool IsAutoRefreshActive() const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Browser")
+	float GetAutoRefreshIntervalSeconds() const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Browser")
+	bool IsPublishingBackgroundRefresh() const
+	{
+		return bPublishingBackgroundRefresh;
+	}
+
 	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions")
 	bool JoinSessionBySearchResultIndex(int32 SearchResultIndex);
 
@@ -76,6 +125,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions")
 	bool JoinSessionByEntryIdForLocalPlayer(ULocalPlayer* LocalPlayer, const FString& EntryId);
 
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Quick Match")
+	bool QuickMatch(const FMultiplayerQuickMatchRequest& QuickMatchRequest);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Quick Match")
+	bool QuickMatchForLocalPlayer(ULocalPlayer* LocalPlayer, const FMultiplayerQuickMatchRequest& QuickMatchRequest);
+
 	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions")
 	bool SendSessionInviteToFriend(const FUniqueNetIdRepl& FriendId);
 
@@ -109,6 +164,90 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions")
 	void EndHostedSession();
 
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	void CreateNamedSessionForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName, const FMultiplayerSessionCreateRequest& CreateRequest);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	bool JoinNamedSessionByEntryIdForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName, const FString& EntryId);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	bool LeaveNamedSessionForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	bool SendNamedSessionInviteToFriendForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName, const FUniqueNetIdRepl& FriendId);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	bool ShowNamedSessionInviteUIForLocalPlayer(ULocalPlayer* LocalPlayer, FName SessionName);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	void UpdateNamedSessionStatus(FName SessionName, EMultiplayerAdvertisedSessionStatus NewStatus);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	void StartNamedSession(FName SessionName);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Named Sessions")
+	void EndNamedSession(FName SessionName);
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Named Sessions")
+	bool HasSessionNamed(FName SessionName) const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Named Sessions")
+	bool OwnsSessionNamed(FName SessionName) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Headless Host")
+	bool StartHeadlessHost();
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Headless Host")
+	bool IsHeadlessHostReady() const
+	{
+		return bHeadlessHostReady;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Headless Host")
+	float GetHeadlessHostBootToAdvertisedSeconds() const
+	{
+		return HeadlessHostBootToAdvertisedSeconds;
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Host Registry")
+	bool RegisterSession(FName SessionName, const FMultiplayerSessionCreateRequest& CreateRequest, int32 GamePort = 0);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Host Registry")
+	bool UpdateRegisteredSession(FName SessionName, const FMultiplayerSessionCreateRequest& CreateRequest);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Host Registry")
+	bool UpdateRegisteredSessionStatus(FName SessionName, EMultiplayerAdvertisedSessionStatus NewStatus);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Host Registry")
+	bool UnregisterSession(FName SessionName);
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Host Registry")
+	TArray<FMultiplayerRegisteredSessionInfo> GetRegisteredSessions() const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Host Registry")
+	int32 GetRegisteredSessionCallsInFlight() const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Join Admission")
+	bool IsAdvertisingJoinBusy() const
+	{
+		return bAdvertisedJoinBusy;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Join Admission")
+	float GetHostJoinAttemptsPerSecond() const
+	{
+		return HostJoinAttemptsPerSecond;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|LAN Discovery")
+	int32 GetLanDiscoveryHostPort() const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Named Sessions")
+	FName GetPublishingSessionName() const
+	{
+		return PublishingSessionName;
+	}
+
 	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions")
 	EMultiplayerSessionFlowState GetCurrentFlowState() const
 	{
@@ -118,15 +257,33 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions")
 	bool IsBusy() const
 	{
-		return CurrentFlowState != EMultiplayerSessionFlowState::Idle;
+		return CurrentFlowState != EMultiplayerSessionFlowState::Idle && ActiveOperation.bBackgroundRefresh == false;
 	}
 
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Local Players")
+	EMultiplayerSessionFlowState GetFlowStateForLocalPlayer(ULocalPlayer* LocalPlayer) const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Local Players")
+	bool IsBusyForLocalPlayer(ULocalPlayer* LocalPlayer) const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Local Players")
+	EMultiplayerSessionFailureReason GetLastFailureReasonForLocalPlayer(ULocalPlayer* LocalPlayer) const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Local Players")
+	TArray<FMultiplayerSessionBrowserEntry> GetCachedBrowserEntriesForLocalPlayer(ULocalPlayer* LocalPlayer) const;
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Local Players")
+	bool IsPublishingForLocalPlayer(ULocalPlayer* LocalPlayer) const;
+
 	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions")
 	bool HasNamedSession() const;
 
 	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions")
 	int32 GetLocalCompatibilityBuildId() const;
 
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Browser")
+	int32 GetDefaultMaxSearchResults() const;
+
 	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions")
 	EMultiplayerSessionFailureReason GetLastFailureReason() const
 	{
@@ -145,6 +302,49 @@ public:
 		return CachedBrowserEntries.Num();
 	}
 
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	bool StartPingProbes();
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	void StopPingProbes();
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Browser")
+	bool IsProbingPing() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Browser")
+	void SetSessionScorer(UObject* NewSessionScorer);
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Browser")
+	UObject* GetSessionScorer() const
+	{
+		return SessionScorer;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Multiplayer Sessions|Browser")
+	static float ScoreBrowserEntry(const FMultiplayerSessionBrowserEntry& BrowserEntry, const FMultiplayerSessionScoringWeights& ScoringWeights);
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Diagnostics")
+	TArray<FMultiplayerSessionLatencySummary> GetOperationLatencySummaries() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Diagnostics")
+	void ResetOperationLatencyStats();
+
+	UFUNCTION(BlueprintCallable, Category = "Multiplayer Sessions|Diagnostics")
+	FMultiplayerSessionCacheMemoryReport GetSearchCacheMemoryReport() const;
+
+#if !UE_BUILD_SHIPPING
+	void DumpOperationLatencyStats(FOutputDevice& Ar) const;
+	void DumpFlightRecorder(FOutputDevice& Ar) const;
+	void DumpSearchCacheMemory(FOutputDevice& Ar) const;
+	bool SaveFlightRecorder(FString& OutFilePath) const;
+	bool RunSearchBenchmark(int32 ResultCount, FOutputDevice& Ar);
+	bool SetSessionInterfaceOverride(IOnlineSessionPtr NewSessionInterface);
+	bool HasSessionInterfaceOverride() const;
+	bool StartSoakTest(int32 CycleCount, int32 Seed, FOutputDevice& Ar);
+	void StopSoakTest();
+	bool IsSoakTestRunning() const;
+#endif
+
 	UPROPERTY(BlueprintAssignable, Category = "Multiplayer Sessions")
 	FMultiplayerOnCreateSessionComplete OnCreateSessionRequestComplete;
 
@@ -187,6 +387,21 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Multiplayer Sessions|Friends")
 	FMultiplayerOnFriendSessionSearchCompleted OnFriendSessionSearchCompleted;
 
+	UPROPERTY(BlueprintAssignable, Category = "Multiplayer Sessions|Browser")
+	FMultiplayerOnBrowserEntriesUpdated OnBrowserEntriesUpdated;
+
+	UPROPERTY(BlueprintAssignable, Category = "Multiplayer Sessions|Browser")
+	FMultiplayerOnBrowserEntriesChanged OnBrowserEntriesChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "Multiplayer Sessions|Quick Match")
+	FMultiplayerOnQuickMatchCompleted OnQuickMatchCompleted;
+
+	UPROPERTY(BlueprintAssignable, Category = "Multiplayer Sessions|Headless Host")
+	FMultiplayerOnHeadlessHostReady OnHeadlessHostReady;
+
+	UPROPERTY(BlueprintAssignable, Category = "Multiplayer Sessions|Host Registry")
+	FMultiplayerOnRegisteredSessionChanged OnRegisteredSessionChanged;
+
 public:
 	FMultiplayerOnCreateSessionComplete MultiplayerOnCreateSessionComplete;
 	FMultiplayerOnFindSessionsComplete MultiplayerOnFindSessionsComplete;
@@ -213,12 +428,32 @@ private:
 		None,
 		DestroyExistingForCreate,
 		DestroyExistingForJoin,
+		AwaitingAdmission,
+		ReservingSlot,
 		Executing,
 		WaitingForTravel,
 		Recovering,
 		RecoveryDestroy
 	};
 
+	enum class EOperationTimeout : uint8
+	{
+		Create,
+		Find,
+		Join,
+		Destroy,
+		Update,
+		StartEnd,
+		Travel,
+		RecoveryGrace,
+		Recovery
+	};
+
+	static constexpr int32 NumOperationTypes = static_cast<int32>(EOperationType::DirectTravel) + 1;
+	static constexpr int32 NumOperationSteps = static_cast<int32>(EOperationStep::RecoveryDestroy) + 1;
+	static constexpr int32 QuickMatchStatsIndex = NumOperationTypes;
+	static constexpr int32 MaxLocalUsers = 4;
+
 	struct FLocalUserContext
 	{
 		TWeakObjectPtr<ULocalPlayer> LocalPlayer;
@@ -226,24 +461,117 @@ private:
 		int32 LocalUserNum = 0;
 	};
 
+	struct FQuickMatchContext
+	{
+		bool bActive = false;
+		bool bSearchCompleted = false;
+		FMultiplayerQuickMatchRequest Request;
+		FMultiplayerQuickMatchReport Report;
+		double StartSeconds = 0.0;
+		double PhaseStartSeconds = 0.0;
+	};
+
 	struct FOperationContext
 	{
 		uint64 Generation = 0;
 		EOperationType Type = EOperationType::None;
 		EOperationType RecoverySourceType = EOperationType::None;
 		EOperationStep Step = EOperationStep::None;
+		EOperationType StepOperationType = EOperationType::None;
 		FLocalUserContext LocalUser;
 		FMultiplayerSessionCreateRequest CreateRequest;
 		FMultiplayerSessionSearchRequest SearchRequest;
 		FOnlineSessionSearchResult JoinResult;
+		int32 JoinCachedResultIndex = INDEX_NONE;
+		FName SessionName = NAME_GameSession;
 		FUniqueNetIdPtr FriendId;
 		TSharedPtr<FOnlineSessionSettings> PendingSessionSettings;
 		TSharedPtr<FOnlineSessionSearch> PendingSearch;
+		TSharedPtr<FMultiplayerSessionSlotReserver> SlotReserver;
+		TSharedPtr<FMultiplayerSessionLanSearch> LanSearch;
 		EMultiplayerAdvertisedSessionStatus RequestedStatus = EMultiplayerAdvertisedSessionStatus::Unknown;
+		FQuickMatchContext QuickMatch;
+		double BeginSeconds = 0.0;
+		double StepBeginSeconds = 0.0;
 		double DeadlineSeconds = 0.0;
 		double RecoveryNotBeforeSeconds = 0.0;
+		double AdmissionNotBeforeSeconds = 0.0;
+		double LanSearchEndSeconds = 0.0;
+		double NextLanPublishSeconds = 0.0;
+		int32 LanPublishedResultCount = 0;
 		bool bResultBroadcast = false;
 		bool bRecoveryAttemptedDestroy = false;
+		bool bBackgroundRefresh = false;
+		bool bWaitingForSearchSlot = false;
+		bool bJoinAdmissionChecked = false;
+		bool bSlotReservationChecked = false;
+		bool bLanResultsPending = false;
+		bool bLanCachePublished = false;
+	};
+
+	struct FLocalUserState
+	{
+		FOperationContext Operation;
+		EMultiplayerSessionFlowState FlowState = EMultiplayerSessionFlowState::Idle;
+		EMultiplayerSessionFailureReason LastFailureReason = EMultiplayerSessionFailureReason::None;
+		FMultiplayerSessionSearchRequest CachedSearchRequest;
+		TArray<FOnlineSessionSearchResult> CachedSearchResults;
+		TArray<FMultiplayerSessionBrowserEntry> CachedBrowserEntries;
+		uint64 BrowserEntriesPublishCount = 0;
+		TWeakObjectPtr<ULocalPlayer> AutoRefreshLocalPlayer;
+		FMultiplayerSessionSearchRequest AutoRefreshRequest;
+		double NextAutoRefreshSeconds = 0.0;
+		float AutoRefreshIntervalSeconds = 0.0f;
+		float AutoRefreshChurn = 0.0f;
+		bool bAutoRefreshActive = false;
+		bool bAutoRefreshPaused = false;
+		TSharedPtr<FMultiplayerSessionPingProber> PingProber;
+	};
+
+	enum class ERegisteredSessionCall : uint8
+	{
+		None,
+		Create,
+		Update,
+		Destroy
+	};
+
+	struct FRegisteredSession
+	{
+		FMultiplayerSessionCreateRequest CreateRequest;
+		int32 GamePort = 0;
+		EMultiplayerRegisteredSessionState State = EMultiplayerRegisteredSessionState::Queued;
+		ERegisteredSessionCall CallInFlight = ERegisteredSessionCall::None;
+		double CallDeadlineSeconds = 0.0;
+		bool bUpdatePending = false;
+		bool bDestroyRequested = false;
+		TSharedPtr<FOnlineSessionSettings> PendingSessionSettings;
+	};
+
+	struct FNamedSessionState
+	{
+		TSharedPtr<FOnlineSessionSettings> CommittedSessionSettings;
+		bool bOwnsNamedSession = false;
+		bool bHasCommittedJoinInProgressPolicy = false;
+		bool bCommittedAllowJoinInProgress = true;
+	};
+
+	struct FScopedLocalUserBinding
+	{
+		FScopedLocalUserBinding(UMultiplayerSessionsSubsystem& InSubsystem, int32 LocalUserNum)
+			: Subsystem(InSubsystem)
+			, PreviousLocalUserNum(InSubsystem.BoundLocalUserNum)
+		{
+			Subsystem.BindLocalUser(LocalUserNum);
+		}
+
+		~FScopedLocalUserBinding()
+		{
+			Subsystem.BindLocalUser(PreviousLocalUserNum);
+		}
+
+		UMultiplayerSessionsSubsystem& Subsystem;
+		int32 PreviousLocalUserNum;
 	};
 
 private:
@@ -262,25 +590,97 @@ private:
 	void HandleTravelFailure(UWorld* World, ETravelFailure::Type FailureType, const FString& ErrorString);
 	void HandlePostLoadMap(UWorld* LoadedWorld);
 	bool TickOperationTimeouts(float DeltaTime);
+	void TickActiveOperation(double CurrentSeconds);
+	bool TickSoakTest(float DeltaTime);
+	void FinishSoakTest(bool bPassed, const FString& Summary);
+	bool GetSoakTimeoutSeconds(EOperationTimeout Timeout, float& OutTimeoutSeconds) const;
+	int32 GetNumSessionDelegateHandles() const;
+	bool TickPingProbes(float DeltaTime);
+	bool TickBoundPingProbes(double CurrentSeconds);
+	void StopAllPingProbes();
+	bool TickAutoRefresh(float DeltaTime);
+	void TickLocalUserAutoRefresh(double CurrentSeconds);
+	void CancelBackgroundRefresh();
+	bool StartFindOperation(ULocalPlayer* LocalPlayer, const FMultiplayerSessionSearchRequest& SearchRequest, bool bBackgroundRefresh);
+	void ScheduleNextAutoRefresh(const FMultiplayerSessionBrowserChangeSet* ChangeSet, int32 PreviousEntryCount);
+	void NoteSearchIssued(double CurrentSeconds);
+	void PruneRecentSearches(double CurrentSeconds);
+	bool ShouldAutoStartHeadlessHost() const;
+	bool IsHeadlessProcess() const;
+	void BuildHeadlessHostRequest(FMultiplayerSessionCreateRequest& OutCreateRequest) const;
+	void ResolveHeadlessHostIdentity(FLocalUserContext& OutLocalUser) const;
+	void FinishHeadlessHost(bool bWasSuccessful);
+	bool TickHostRegistry(float DeltaTime);
+	void EnsureHostRegistryTicker();
+	bool IssueRegisteredSessionCall(FName SessionName, ERegisteredSessionCall Call);
+	void BuildRegisteredSessionSettings(const FRegisteredSession& RegisteredSession, FOnlineSessionSettings& OutSessionSettings) const;
+	void ApplyAdvertisedGamePort(FName SessionName, FString& InOutConnectString) const;
+	void FinishRegisteredSessionCall(FName SessionName, ERegisteredSessionCall Call, bool bWasSuccessful);
+	void OnRegisteredSessionCreateComplete(FName SessionName, bool bWasSuccessful);
+	void OnRegisteredSessionUpdateComplete(FName SessionName, bool bWasSuccessful);
+	void OnRegisteredSessionDestroyComplete(FName SessionName, bool bWasSuccessful);
+	void AbandonRegisteredSessionCreate(FName SessionName);
+	void ReleaseRegisteredSessions();
+	bool BeginSlotReservation();
+	bool TickSlotReservations(float DeltaTime);
+	void TickHostSlotReservations(double CurrentSeconds);
+	void HandleGameModePreLogin(AGameModeBase* GameMode, const FUniqueNetIdRepl& NewPlayer, FString& ErrorMessage);
+	bool IsGameSessionOperationRunning() const;
+	void QueueGameSessionAdvertisedValue(FName Key, int32 Value, int32 AdvertisedValue);
+	void FlushGameSessionAdvertisedValues(double CurrentSeconds);
+	void OnGameSessionAdvertisedValuesUpdated(FName SessionName, bool bWasSuccessful);
+	void RequeueInFlightAdvertisedValues();
+	bool BeginJoinAdmissionDelay();
+	float ResolveJoinAdmissionDelaySeconds(const FOnlineSessionSearchResult& SearchResult) const;
+	void TickHostJoinLoad(double CurrentSeconds);
+	void ResetHostJoinLoad();
+	bool BeginLanDiscoveryFind();
+	bool TickLanDiscoverySearches(float DeltaTime);
+	void PublishLanDiscoveryResults();
+	void TickLanDiscoveryHost();
+	void StopLanDiscoveryHost();
+	int32 ResolveLanGamePort() const;
 
 	bool EnsureSessionInterface(const TCHAR* Context, EMultiplayerSessionFailureReason& OutFailureReason);
 	void RegisterPersistentSessionDelegates();
 	void ClearPersistentSessionDelegates();
 	bool ResolveLocalUser(ULocalPlayer* RequestedLocalPlayer, FLocalUserContext& OutLocalUser, EMultiplayerSessionFailureReason& OutFailureReason);
 	ULocalPlayer* ResolveDefaultLocalPlayer() const;
+	int32 ResolveLocalUserNum(ULocalPlayer* LocalPlayer) const;
+	void BindLocalUser(int32 LocalUserNum);
+	void SwapLocalUserState(FLocalUserState& LocalUserState);
+	const FOperationContext& GetLocalUserOperation(int32 LocalUserNum) const;
+	int32 FindLocalUserNumForGeneration(uint64 Generation) const;
+	int32 FindLocalUserNumInStep(EOperationStep Step) const;
+	bool IsSessionOperationRunningForOtherLocalUser(FName SessionName) const;
 	bool IsOnlineLoginRequired() const;
 	bool OperationRequiresSessionInterface(EOperationType OperationType) const;
 	bool OperationRequiresLocalPlayer(EOperationType OperationType) const;
 
-	bool TryBeginOperation(EOperationType OperationType, EMultiplayerSessionFlowState FlowState, ULocalPlayer* LocalPlayer, double TimeoutSeconds, EMultiplayerSessionFailureReason& OutFailureReason);
+	bool TryBeginOperation(EOperationType OperationType, EMultiplayerSessionFlowState FlowState, ULocalPlayer* LocalPlayer, double TimeoutSeconds, EMultiplayerSessionFailureReason& OutFailureReason, FName SessionName = NAME_GameSession);
 	bool IsCurrentOperation(uint64 CallbackGeneration, EOperationType ExpectedType, EOperationStep ExpectedStep) const;
 	void SetOperationStep(EOperationStep NewStep, double TimeoutSeconds);
+	void EnterOperationStep(EOperationStep NewStep);
+	void RecordActiveStepLatency(double CurrentSeconds);
+	void RecordCompletedOperationLatency(double CurrentSeconds);
+	void TraceOperationEvent(EMultiplayerSessionTracePhase Phase) const;
+	void RecordFlightEvent(EMultiplayerSessionFlightEvent Event, EMultiplayerSessionFailureReason FailureReason);
+	void BuildFlightRecorderLines(TArray<FString>& OutLines) const;
+	bool WriteFlightRecorderFile(FString& OutFilePath) const;
+	void NoteDelegateBroadcast();
+	void UpdateBroadcastRateStat(double CurrentSeconds);
+	void UpdateCachedSearchBytesStat() const;
+	SIZE_T GetCachedSearchAllocatedSize() const;
 	EMultiplayerSessionFlowState ResetActiveOperation();
 	void BroadcastIdleStateIfUnchanged(EMultiplayerSessionFlowState PreviousFlowState, uint64 ExpectedOperationGeneration);
 	void ClearOperationDelegate(EOperationType OperationType);
 	void ClearAllDelegateHandles();
-	void ResetCommittedSessionState();
+	void ResetAllCommittedSessionState();
+	void ResetCommittedSessionState(FName SessionName);
+	FNamedSessionState& GetNamedSessionState(FName SessionName);
+	FName ResolveSessionNameForResult(const FOnlineSessionSearchResult& SearchResult) const;
 
+	void BeginCreateAfterExistingSessionCleanup();
 	void BeginCreateOperation();
 	void BeginFindOperation();
 	void BeginFindFriendOperation();
@@ -308,6 +708,17 @@ private:
 	void HandleOperationTimeout();
 	void HandleTravelFailureInternal(EMultiplayerSessionFailureReason FailureReason);
 
+	void ContinueQuickMatchAfterSearch(EMultiplayerSessionFailureReason SearchFailureReason, TArray<FOnlineSessionSearchResult>&& SearchResults, TArray<FMultiplayerSessionBrowserEntry>&& BrowserEntries);
+	static int32 SelectQuickMatchEntryIndex(const FMultiplayerQuickMatchRequest& QuickMatchRequest, const TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, float& OutScore, int32& OutQualifiedCount);
+	void CompleteQuickMatchOperation(EMultiplayerSessionFailureReason FailureReason);
+	void BroadcastQuickMatchReport(const FQuickMatchContext& QuickMatch, EMultiplayerQuickMatchOutcome Outcome, EMultiplayerSessionFailureReason FailureReason);
+	void BroadcastImmediateQuickMatchFailure(EMultiplayerSessionFailureReason FailureReason);
+
+	bool StartPingResponder();
+	void StopPingResponder();
+	int32 GetPingResponderPort() const;
+	bool ApplyPingMeasurement(const FString& EntryId, int32 PingInMs);
+
 	void SetFlowState(EMultiplayerSessionFlowState NewState);
 	void BroadcastFailure(EMultiplayerSessionFailureReason FailureReason);
 	void SetLastFailureReason(EMultiplayerSessionFailureReason FailureReason);
@@ -316,14 +727,25 @@ private:
 	void SanitizeCreateRequest(FMultiplayerSessionCreateRequest& InOutCreateRequest) const;
 	void SanitizeSearchRequest(FMultiplayerSessionSearchRequest& InOutSearchRequest) const;
 	int32 ResolveBuildId(int32 RequestedBuildId) const;
+	float GetTimeoutSeconds(EOperationTimeout Timeout) const;
+	int32 GetSearchPingBucketSize() const;
 
 	void ApplyCreateRequestToSessionSettings(FOnlineSessionSettings& SessionSettings, const FMultiplayerSessionCreateRequest& CreateRequest) const;
 	bool IsSearchResultRelevantToRequest(const FOnlineSessionSearchResult& SearchResult, const FMultiplayerSessionSearchRequest& SearchRequest) const;
 	EMultiplayerJoinBlockReason ResolveJoinBlockReason(const FOnlineSessionSearchResult& SearchResult, const FMultiplayerSessionSearchRequest& SearchRequest) const;
+	void BuildBrowserResultsFromPendingSearch(TArray<FOnlineSessionSearchResult>& OutSearchResults, TArray<FMultiplayerSessionBrowserEntry>& OutBrowserEntries);
+	void FilterRelevantSearchResults(TArray<FOnlineSessionSearchResult>&& SourceSearchResults, const FMultiplayerSessionSearchRequest& SearchRequest, TArray<FOnlineSessionSearchResult>& OutSearchResults) const;
+	void BuildBrowserEntries(const TArray<FOnlineSessionSearchResult>& SearchResults, const FMultiplayerSessionSearchRequest& SearchRequest, TArray<FMultiplayerSessionBrowserEntry>& OutBrowserEntries) const;
 	FMultiplayerSessionBrowserEntry BuildBrowserEntry(const FOnlineSessionSearchResult& SearchResult, int32 SearchResultIndex, const FMultiplayerSessionSearchRequest& SearchRequest) const;
 	void ResolveJoinability(FMultiplayerSessionBrowserEntry& BrowserEntry, const FOnlineSessionSearchResult& SearchResult, const FMultiplayerSessionSearchRequest& SearchRequest) const;
-	void SortSearchResultsAndBrowserEntries(TArray<FOnlineSessionSearchResult>& SearchResults, TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries) const;
+	void ResolveFriendHosts(const TArray<FOnlineSessionSearchResult>& SearchResults, TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries) const;
+	void ScoreBrowserEntries(TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, const FMultiplayerSessionScoringWeights& ScoringWeights) const;
+	bool SortSearchResultsAndBrowserEntries(TArray<FOnlineSessionSearchResult>& SearchResults, TArray<FMultiplayerSessionBrowserEntry>& BrowserEntries, int32 DisplayedResultCount) const;
+	static bool IsBetterBrowserEntry(const FMultiplayerSessionBrowserEntry& Left, const FMultiplayerSessionBrowserEntry& Right);
+	void BuildBrowserChangeSet(const TArray<FMultiplayerSessionBrowserEntry>& PreviousEntries, const TArray<FMultiplayerSessionBrowserEntry>& CurrentEntries, FMultiplayerSessionBrowserChangeSet& OutChangeSet) const;
 	int32 FindCachedSearchResultIndexByEntryId(const FString& EntryId) const;
+	const FOnlineSessionSearchResult& GetJoinSearchResult() const;
+	void TrimCachedSearchResults();
 
 	static EMultiplayerAdvertisedSessionStatus ResolveDisplayStatus(EMultiplayerAdvertisedSessionStatus AdvertisedStatus, int32 OpenPublicConnections);
 	static FString ResolveDisplayStatusText(EMultiplayerAdvertisedSessionStatus Status);
@@ -332,23 +754,80 @@ private:
 	static EMultiplayerSessionFailureReason ResolveFailureReasonForJoinBlock(EMultiplayerJoinBlockReason JoinBlockReason);
 	static FString ResolveJoinBlockReasonText(EMultiplayerJoinBlockReason JoinBlockReason);
 	static FString SessionStatusToString(EMultiplayerAdvertisedSessionStatus Status);
+	static int32 ResolveOpenPublicConnections(const FOnlineSessionSearchResult& SearchResult);
 	static EMultiplayerAdvertisedSessionStatus SessionStatusFromString(const FString& StatusText);
 	static EMultiplayerJoinSessionResult MapJoinResult(EOnJoinSessionCompleteResult::Type Result);
+	static FString OperationTypeToString(EOperationType OperationType);
+	static FString OperationStepToString(EOperationStep OperationStep);
 
 private:
 	IOnlineSubsystem* CachedOnlineSubsystem = nullptr;
 	IOnlineSessionPtr SessionInterface;
+	IOnlineSessionPtr SessionInterfaceOverride;
 
-	TSharedPtr<FOnlineSessionSettings> CommittedSessionSettings;
-	bool bOwnsNamedSession = false;
-	bool bHasCommittedJoinInProgressPolicy = false;
-	bool bCommittedAllowJoinInProgress = true;
+	TMap<FName, FNamedSessionState> NamedSessionStates;
+	FName PublishingSessionName = NAME_GameSession;
 
+	FMultiplayerSessionSearchRequest CachedSearchRequest;
 	TArray<FOnlineSessionSearchResult> CachedSearchResults;
 	TArray<FMultiplayerSessionBrowserEntry> CachedBrowserEntries;
+	uint64 BrowserEntriesPublishCount = 0;
+
+	TSharedPtr<FMultiplayerSessionPingProber> PingProber;
+	TSharedPtr<FMultiplayerSessionPingResponder> PingResponder;
+	FTSTicker::FDelegateHandle PingProbeTickerHandle;
+	FTSTicker::FDelegateHandle SlotReservationTickerHandle;
+	int32 AdvertisedReservedSlots = 0;
+	TMap<FName, int32> PendingAdvertisedValues;
+	TMap<FName, int32> InFlightAdvertisedValues;
+	TSharedPtr<FOnlineSessionSettings> InFlightAdvertisedSettings;
+	double NextAdvertisedUpdateSeconds = 0.0;
+	double AdvertisedUpdateDeadlineSeconds = 0.0;
+	TArray<double> RecentHostJoinSeconds;
+	int32 JoinLoadLastOpenSlots = INDEX_NONE;
+	uint32 JoinLoadLastReservationRequests = 0;
+	float HostJoinAttemptsPerSecond = 0.0f;
+	bool bAdvertisedJoinBusy = false;
+	TSharedPtr<FMultiplayerSessionLanHost> LanDiscoveryHost;
+	FTSTicker::FDelegateHandle LanDiscoveryTickerHandle;
+	TArray<uint8> LanBeaconBody;
+
+	FTSTicker::FDelegateHandle AutoRefreshTickerHandle;
+	TWeakObjectPtr<ULocalPlayer> AutoRefreshLocalPlayer;
+	FMultiplayerSessionSearchRequest AutoRefreshRequest;
+	TArray<double> RecentSearchSeconds;
+	double NextAutoRefreshSeconds = 0.0;
+	float AutoRefreshIntervalSeconds = 0.0f;
+	float AutoRefreshChurn = 0.0f;
+	bool bAutoRefreshActive = false;
+	bool bAutoRefreshPaused = false;
+	bool bPublishingBackgroundRefresh = false;
+
+	bool bHeadlessHostPending = false;
+	bool bHeadlessHostCreating = false;
+	bool bHeadlessHostReady = false;
+	float HeadlessHostBootToAdvertisedSeconds = -1.0f;
+
+	TMap<FName, FRegisteredSession> RegisteredSessions;
+	TSet<FName> AbandonedRegisteredCreates;
+	FTSTicker::FDelegateHandle HostRegistryTickerHandle;
+	double NextRegisteredUpdateFlushSeconds = 0.0;
 
 	FOperationContext ActiveOperation;
+	FLocalUserState LocalUserStates[MaxLocalUsers];
+	int32 BoundLocalUserNum = 0;
+	int32 SearchOwnerLocalUserNum = INDEX_NONE;
 	uint64 NextOperationGeneration = 0;
+	TSharedPtr<FMultiplayerSessionOperationStats> OperationStats;
+	TSharedPtr<FMultiplayerSessionFlightRecorder> FlightRecorder;
+	double LastFlightRecorderSaveSeconds = 0.0;
+	EMultiplayerSessionFailureReason PendingFlightRecorderSaveReason = EMultiplayerSessionFailureReason::None;
+	uint32 DelegateBroadcastsInWindow = 0;
+	double DelegateBroadcastWindowStartSeconds = 0.0;
+	double OperationTickSeconds = 0.0;
+	int64 OperationTickCount = 0;
+	TSharedPtr<FMultiplayerSessionSoakRun> SoakRun;
+	FTSTicker::FDelegateHandle SoakTickerHandle;
 
 	FDelegateHandle CreateSessionCompleteDelegateHandle;
 	FDelegateHandle FindSessionsCompleteDelegateHandle;
@@ -361,10 +840,15 @@ private:
 	FDelegateHandle StartSessionCompleteDelegateHandle;
 	FDelegateHandle EndSessionCompleteDelegateHandle;
 	FDelegateHandle RecoveryDestroyCompleteDelegateHandle;
+	FDelegateHandle RegisteredCreateCompleteDelegateHandle;
+	FDelegateHandle RegisteredUpdateCompleteDelegateHandle;
+	FDelegateHandle RegisteredDestroyCompleteDelegateHandle;
+	FDelegateHandle AdvertisedUpdateCompleteDelegateHandle;
 
 	FDelegateHandle NetworkFailureDelegateHandle;
 	FDelegateHandle TravelFailureDelegateHandle;
 	FDelegateHandle PostLoadMapDelegateHandle;
+	FDelegateHandle GameModePreLoginDelegateHandle;
 	FTSTicker::FDelegateHandle OperationTickerHandle;
 
 	EMultiplayerSessionFlowState CurrentFlowState = EMultiplayerSessionFlowState::Idle;
@@ -399,4 +883,124 @@ private:
 
 	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Compatibility")
 	bool bAllowBuildIdOverride = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Browser", meta = (ClampMin = "1", ToolTip = "Result limit used by the entry widget and the ms.Find console command."))
+	int32 DefaultMaxSearchResults = 200;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Browser", meta = (ClampMin = "1", ToolTip = "Ping bucket size passed to the online search."))
+	int32 SearchPingBucketSize = 50;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Browser", meta = (ToolTip = "After browser entries are built, keep only the session info and owner of each search result and drop the advertised settings."))
+	bool bLeanSearchCache = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Browser", meta = (ClampMin = "1", EditCondition = "bLeanSearchCache", ToolTip = "Maximum number of cached results in lean mode. The lowest ranked results are dropped first."))
+	int32 LeanSearchCacheMaxEntries = 100;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Auto Refresh", meta = (ClampMin = "1.0", ToolTip = "Background refresh interval while the browser contents change a lot."))
+	float AutoRefreshMinIntervalSeconds = 10.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Auto Refresh", meta = (ClampMin = "1.0", ToolTip = "Background refresh interval while the browser contents are stable."))
+	float AutoRefreshMaxIntervalSeconds = 60.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Auto Refresh", meta = (ClampMin = "0.01", ToolTip = "Share of entries added, removed or changed per refresh at which the interval reaches its minimum. Ping changes are ignored."))
+	float AutoRefreshHighChurnRatio = 0.2f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Auto Refresh", meta = (ClampMin = "1", ToolTip = "Global search budget. Background refreshes wait while this many searches, manual ones included, started in the last minute."))
+	int32 MaxSearchesPerMinute = 6;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Auto Refresh")
+	bool bPauseAutoRefreshWhenUnfocused = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Ping")
+	bool bEnablePingProbes = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Ping", meta = (ClampMin = "0", ToolTip = "UDP port answering ping probes while hosting. Set to zero to disable the responder."))
+	int32 PingResponderPort = 7787;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Ping", meta = (ClampMin = "1"))
+	int32 MaxPingProbeTargets = 16;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Ping", meta = (ClampMin = "1"))
+	int32 MaxConcurrentPingProbes = 4;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Ping", meta = (ClampMin = "1"))
+	int32 PingProbeAttempts = 3;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Ping", meta = (ClampMin = "0.05"))
+	float PingProbeTimeoutSeconds = 1.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Slot Reservations", meta = (ToolTip = "Hosts grant slots through the ping responder, and clients reserve one before joining. Rejected clients fail with SessionIsFull before they travel."))
+	bool bEnableSlotReservations = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Slot Reservations", meta = (ClampMin = "1.0", ToolTip = "How long the host holds a granted slot for a client that has not arrived yet."))
+	float SlotReservationSeconds = 30.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Slot Reservations", meta = (ClampMin = "1", ToolTip = "Most slots the host holds at once for one client address. Split-screen guests and players behind one NAT share an address."))
+	int32 SlotReservationsPerAddress = 4;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Slot Reservations", meta = (ClampMin = "1"))
+	int32 SlotReservationAttempts = 3;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Slot Reservations", meta = (ClampMin = "0.05", ToolTip = "Time to wait for the host's answer before resending. Without any answer the join goes ahead unreserved."))
+	float SlotReservationAttemptTimeoutSeconds = 0.5f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Join Admission", meta = (ToolTip = "Clients wait a random delay before joining a nearly full or busy host, and hosts advertise a busy hint while many clients arrive at once."))
+	bool bEnableJoinAdmission = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Join Admission", meta = (ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Share of filled slots above which clients start spreading their joins. The delay grows until the session is full."))
+	float JoinAdmissionFillThreshold = 0.75f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Join Admission", meta = (ClampMin = "0.0", ToolTip = "Upper bound of the random delay. Clients use the full range while the host advertises it is busy."))
+	float JoinAdmissionMaxDelaySeconds = 3.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Join Admission", meta = (ClampMin = "1.0", ToolTip = "Window over which the host counts arriving clients."))
+	float JoinBusyWindowSeconds = 5.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Join Admission", meta = (ClampMin = "1", ToolTip = "Arrivals within the window at which the host advertises it is busy. The hint clears once arrivals fall below half of this."))
+	int32 JoinBusyArrivalsPerWindow = 8;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|LAN Discovery", meta = (ToolTip = "LAN searches and LAN hosts use the plugin's own UDP beacon instead of the online subsystem's LAN search. Joins travel straight to the address in the beacon."))
+	bool bUseNativeLanDiscovery = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|LAN Discovery", meta = (ClampMin = "1", ClampMax = "65535", ToolTip = "First UDP port LAN hosts listen on for discovery queries."))
+	int32 LanDiscoveryPort = 7788;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|LAN Discovery", meta = (ClampMin = "1", ClampMax = "64", ToolTip = "Hosts bind the first free port of this range, so several hosts can share one machine. Searches query every port in the range."))
+	int32 LanDiscoveryPortCount = 4;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|LAN Discovery", meta = (ClampMin = "0.1", ToolTip = "How long a LAN search collects beacons. Results reach the browser while the search runs."))
+	float LanDiscoverySearchSeconds = 0.75f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|LAN Discovery", meta = (ClampMin = "1"))
+	int32 LanDiscoveryQueryAttempts = 3;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|LAN Discovery", meta = (ClampMin = "0.01"))
+	float LanDiscoveryQueryIntervalSeconds = 0.15f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|LAN Discovery", meta = (ClampMin = "1", ToolTip = "Beacons a host sends per second at most. Queries above the budget are dropped."))
+	int32 LanDiscoveryMaxRepliesPerSecond = 200;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Headless Host", meta = (ToolTip = "Creates and advertises the game session as soon as a dedicated server loads its first map. The -MSHeadlessHost switch enables it too."))
+	bool bHeadlessHostOnDedicatedServer = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Headless Host", meta = (ToolTip = "Session advertised by the headless host. -MSMatchType=, -MSMaxPlayers=, -MSDisplayName=, -MSRegion= and -MSLan override single fields. An empty MapName uses the loaded map."))
+	FMultiplayerSessionCreateRequest HeadlessHostRequest;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Host Registry", meta = (ClampMin = "1", ToolTip = "Backend calls the host registry keeps in flight at once across all hosted sessions."))
+	int32 HostRegistryMaxConcurrentCalls = 4;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Host Registry", meta = (ClampMin = "0.0", ToolTip = "Hosted session updates are collected for this long and then sent together, one call per changed session."))
+	float HostRegistryUpdateBatchSeconds = 1.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Diagnostics", meta = (ToolTip = "Writes the flow-state flight recorder to Saved/Logs/MultiplayerSessions when an operation fails."))
+	bool bSaveFlightRecorderOnFailure = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Diagnostics", meta = (ClampMin = "0.0", ToolTip = "Minimum time between flight recorder files written on failure."))
+	float FlightRecorderSaveCooldownSeconds = 30.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Multiplayer Sessions|Browser", meta = (MustImplement = "/Script/MultiplayerSessions.MultiplayerSessionScorer"))
+	TSoftClassPtr<UObject> SessionScorerClass;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UObject> SessionScorer;
 };
@@ -72,7 +72,9 @@ enum class EMultiplayerSessionFailureReason : uint8
 	InvalidFriendId UMETA(DisplayName = "Invalid Friend Id"),
 	InviteFailed UMETA(DisplayName = "Invite Failed"),
 	PlatformUiUnavailable UMETA(DisplayName = "Platform UI Unavailable"),
-	FriendSessionNotFound UMETA(DisplayName = "Friend Session Not Found")
+	FriendSessionNotFound UMETA(DisplayName = "Friend Session Not Found"),
+	NoMatchFound UMETA(DisplayName = "No Match Found"),
+	SessionNameMismatch UMETA(DisplayName = "Session Name Mismatch")
 };
 
 UENUM(BlueprintType)
@@ -92,6 +94,63 @@ enum class EMultiplayerJoinSessionResult : uint8
 	IncompatibleSchema UMETA(DisplayName = "Incompatible Session Schema")
 };
 
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EMultiplayerSessionEntryField : uint8
+{
+	None = 0 UMETA(Hidden),
+	Players = 1 << 0 UMETA(DisplayName = "Players"),
+	Status = 1 << 1 UMETA(DisplayName = "Status"),
+	Ping = 1 << 2 UMETA(DisplayName = "Ping"),
+	Joinability = 1 << 3 UMETA(DisplayName = "Joinability"),
+	Details = 1 << 4 UMETA(DisplayName = "Details")
+};
+ENUM_CLASS_FLAGS(EMultiplayerSessionEntryField);
+
+UENUM(BlueprintType)
+enum class EMultiplayerQuickMatchOutcome : uint8
+{
+	None UMETA(DisplayName = "None"),
+	Joined UMETA(DisplayName = "Joined"),
+	Hosted UMETA(DisplayName = "Hosted"),
+	Failed UMETA(DisplayName = "Failed")
+};
+
+UENUM(BlueprintType)
+enum class EMultiplayerRegisteredSessionState : uint8
+{
+	Queued UMETA(DisplayName = "Queued"),
+	Creating UMETA(DisplayName = "Creating"),
+	Advertised UMETA(DisplayName = "Advertised"),
+	Updating UMETA(DisplayName = "Updating"),
+	Destroying UMETA(DisplayName = "Destroying"),
+	Destroyed UMETA(DisplayName = "Destroyed"),
+	Failed UMETA(DisplayName = "Failed")
+};
+
+USTRUCT(BlueprintType)
+struct FMultiplayerSessionScoringWeights
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Scoring", meta = (ToolTip = "Score removed for every millisecond of ping."))
+	float PingWeight = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Scoring", meta = (ClampMin = "0", ToolTip = "Ping assumed for sessions that report no ping."))
+	int32 UnknownPingMs = 250;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Scoring", meta = (ToolTip = "Score added for a completely filled session. Scaled by the current fill ratio."))
+	float FillRatioWeight = 100.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Scoring", meta = (ToolTip = "Score added for a session in the lobby. Less preferable statuses receive a fraction of it."))
+	float StatusWeight = 200.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Scoring", meta = (ToolTip = "Score added for a session advertised in the preferred region."))
+	float RegionWeight = 150.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Scoring", meta = (ToolTip = "Score added for a session hosted by a friend of the searching user."))
+	float FriendWeight = 300.0f;
+};
+
 USTRUCT(BlueprintType)
 struct FMultiplayerSessionCreateRequest
 {
@@ -115,6 +174,9 @@ struct FMultiplayerSessionCreateRequest
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session")
 	EMultiplayerAdvertisedSessionStatus InitialStatus = EMultiplayerAdvertisedSessionStatus::Lobby;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session")
+	FString RegionTag;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session", meta = (ToolTip = "Set to zero to use the local Unreal network version automatically."))
 	int32 BuildId = 0;
 
@@ -159,6 +221,15 @@ struct FMultiplayerSessionSearchRequest
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Search")
 	bool bUseLan = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Search")
+	FString PreferredRegionTag;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Search")
+	FMultiplayerSessionScoringWeights ScoringWeights;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Search", meta = (ClampMin = "0", ToolTip = "Only the best entries up to this count are strictly ordered. Set to zero to order every result."))
+	int32 DisplayedResultCount = 0;
 };
 
 USTRUCT(BlueprintType)
@@ -220,6 +291,18 @@ struct FMultiplayerSessionBrowserEntry
 	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
 	bool bIsLan = false;
 
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
+	FString RegionTag;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
+	bool bIsPreferredRegion = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
+	bool bHostIsFriend = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
+	float Score = 0.0f;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
 	bool bCanJoin = false;
 
@@ -229,3 +312,193 @@ struct FMultiplayerSessionBrowserEntry
 	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
 	FString JoinDisabledReasonText;
 };
+
+USTRUCT(BlueprintType)
+struct FMultiplayerSessionEntryUpdate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
+	int32 EntryIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser", meta = (Bitmask, BitmaskEnum = "/Script/MultiplayerSessions.EMultiplayerSessionEntryField"))
+	int32 ChangedFields = 0;
+
+	bool HasChanged(EMultiplayerSessionEntryField Field) const
+	{
+		return (ChangedFields & static_cast<int32>(Field)) != 0;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FMultiplayerSessionBrowserChangeSet
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser", meta = (ToolTip = "Indices of new entries in the browser entries broadcast with this change set."))
+	TArray<int32> AddedEntryIndices;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser", meta = (ToolTip = "Entries present before and after whose fields changed, indexed into the broadcast browser entries."))
+	TArray<FMultiplayerSessionEntryUpdate> UpdatedEntries;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser")
+	TArray<FString> RemovedEntryIds;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Session Browser", meta = (ToolTip = "True when entries present before and after are now in a different relative order."))
+	bool bOrderChanged = false;
+
+	bool IsEmpty() const
+	{
+		return AddedEntryIndices.Num() == 0 && UpdatedEntries.Num() == 0 && RemovedEntryIds.Num() == 0 && bOrderChanged == false;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FMultiplayerQuickMatchRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+	FMultiplayerSessionSearchRequest SearchRequest;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+	FMultiplayerSessionCreateRequest CreateRequest;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match", meta = (ClampMin = "1.0", ToolTip = "Search results that arrived before this deadline are used to pick a session."))
+	float SearchDeadlineSeconds = 8.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match", meta = (ClampMin = "0", ToolTip = "Set to zero to accept any ping."))
+	int32 MaxAcceptablePingMs = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quick Match")
+	bool bHostIfNoneFound = true;
+};
+
+USTRUCT(BlueprintType)
+struct FMultiplayerQuickMatchReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	EMultiplayerQuickMatchOutcome Outcome = EMultiplayerQuickMatchOutcome::None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	EMultiplayerSessionFailureReason FailureReason = EMultiplayerSessionFailureReason::None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	FString SelectedEntryId;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	float SelectedScore = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	int32 CandidateCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	int32 QualifiedCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	float SearchSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	float JoinSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	float HostSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quick Match")
+	float TotalSeconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FMultiplayerRegisteredSessionInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Host Registry")
+	FName SessionName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Host Registry")
+	EMultiplayerRegisteredSessionState State = EMultiplayerRegisteredSessionState::Queued;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Host Registry")
+	EMultiplayerAdvertisedSessionStatus Status = EMultiplayerAdvertisedSessionStatus::Unknown;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Host Registry")
+	int32 NumPublicConnections = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Host Registry", meta = (ToolTip = "Port clients travel to for this session. 0 uses the process game port."))
+	int32 GamePort = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Host Registry", meta = (ToolTip = "Settings changed since the last committed update. They go out with the next batch."))
+	bool bUpdatePending = false;
+};
+
+USTRUCT(BlueprintType)
+struct FMultiplayerSessionLatencySummary
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	FString OperationName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics", meta = (ToolTip = "Empty for the end-to-end row of an operation."))
+	FString StepName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	int32 SampleCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	float MinMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	float MeanMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	float P50Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	float P95Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	float P99Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	float MaxMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	int32 SuccessCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	int32 FailureCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	TMap<EMultiplayerSessionFailureReason, int32> FailureReasonCounts;
+};
+
+USTRUCT(BlueprintType)
+struct FMultiplayerSessionCacheMemoryReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	int32 EntryCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	bool bLeanCache = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	int64 TotalBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics", meta = (ToolTip = "Search results kept as join handles, including their advertised settings."))
+	int64 SearchResultBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	int64 BrowserEntryBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics")
+	int64 BytesPerEntry = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Diagnostics", meta = (ToolTip = "Bytes held by each advertised setting key across all cached search results."))
+	TMap<FName, int64> SettingBytesByKey;
+};